@@ -696,6 +696,11 @@ static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttrib
                                                     lastChallenge:(AWSCognitoIdentityProviderRespondToAuthChallengeResponse*) lastChallenge
                                          isInitialCustomChallenge:(BOOL) isInitialCustomChallenge {
     
+    // have SRP key pairs ready by the time the end user has entered the password
+    if (!self.pool.userPoolConfiguration.migrationEnabled) {
+        [[AWSCognitoIdentityProviderSrpKeyPool sharedPool] refill];
+    }
+
     AWSCognitoIdentityPasswordAuthenticationInput * input = [[AWSCognitoIdentityPasswordAuthenticationInput alloc] initWithLastKnownUsername:[self.pool currentUsername]];
     AWSTaskCompletionSource<AWSCognitoIdentityPasswordAuthenticationDetails*>*passwordAuthenticationDetails = [AWSTaskCompletionSource<AWSCognitoIdentityPasswordAuthenticationDetails*> new];
     [authenticationDelegate getPasswordAuthenticationDetails:input
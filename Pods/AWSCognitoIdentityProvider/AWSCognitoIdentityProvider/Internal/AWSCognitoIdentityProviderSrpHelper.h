@@ -13,6 +13,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 /* State shared between client and server */
 @interface AWSCognitoIdentityProviderSrpCommonState : NSObject
+/* The default group, N and g parsed and k hashed once per process; -init shares its values */
++ (instancetype)defaultState;
 - (instancetype)init;
 - (instancetype)initN:(AWSJKBigInteger *)N g:(AWSJKBigInteger *)g;
 - (instancetype)initN:(AWSJKBigInteger *)N g:(AWSJKBigInteger *)g k:(AWSJKBigInteger *)k;
@@ -59,6 +61,42 @@ NS_ASSUME_NONNULL_BEGIN
 @property(nonatomic, strong) NSData *serviceSecretBlock;
 @end
 
+/* An ephemeral client key pair: a random a < N and A = g^a % N */
+@interface AWSCognitoIdentityProviderSrpKeyPair : NSObject
++ (instancetype)keyPairForCommonState:(AWSCognitoIdentityProviderSrpCommonState *)commonState;
+
+@property(nonatomic, strong, readonly) AWSJKBigInteger *privateA;
+@property(nonatomic, strong, readonly) AWSJKBigInteger *publicA;
+@end
+
+/* Key pairs for the default group, generated ahead of time on a low priority
+ * background queue so a sign-in can send SRP_A without waiting for g^a.
+ * Each pair is handed out once. All properties are thread safe and KVO
+ * compliant, the counters change on whichever thread takes or makes a pair.
+ */
+@interface AWSCognitoIdentityProviderSrpKeyPool : NSObject
++ (instancetype)sharedPool;
+
+// Pairs kept ready, 0 turns the pool off and drops what it holds. Defaults to 2.
+@property(atomic) NSUInteger depth;
+// A refill up to depth starts once fewer than this many pairs are left, right away if
+// there already are when it is set. Defaults to 1.
+@property(atomic) NSUInteger refillThreshold;
+
+@property(atomic, readonly) NSUInteger count;
+// Pairs taken from the pool, requests it could not serve, and pairs it made
+@property(atomic, readonly) NSUInteger hits;
+@property(atomic, readonly) NSUInteger misses;
+@property(atomic, readonly) NSUInteger generated;
+
+/* A ready pair, or nil if none is (the caller makes its own); either way starts a refill when due */
+- (nullable AWSCognitoIdentityProviderSrpKeyPair *)takeKeyPair;
+/* Fills the pool up to depth in the background, a no-op if it is full or already filling */
+- (void)refill;
+- (void)drain;
+- (void)resetCounters;
+@end
+
 @interface AWSCognitoIdentityProviderSrpHelper : NSObject
 
 @property(nonatomic, strong) AWSCognitoIdentityProviderSrpCommonState *commonState;
@@ -95,6 +133,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (AWSJKBigInteger*) generatePrivateABigInt:(AWSJKBigInteger*)N;
 + (AWSJKBigInteger*) generatePublicABigInt:(AWSJKBigInteger*)privateA N:(AWSJKBigInteger*)N g:(AWSJKBigInteger*)g;
++ (AWSJKBigInteger*) powGenerator:(AWSJKBigInteger*)g exponent:(AWSJKBigInteger*)exponent N:(AWSJKBigInteger*)N;
 + (NSString*) generateDateString:(NSDate *)date;
 
 + (AWSJKBigInteger*) hashSignedBigInts:(NSArray*)bigInts;
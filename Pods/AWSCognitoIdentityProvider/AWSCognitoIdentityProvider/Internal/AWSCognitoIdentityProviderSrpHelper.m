@@ -7,6 +7,7 @@
 
 #import "AWSCognitoIdentityProviderSrpHelper.h"
 #import "AWSCognitoIdentityProviderHKDF.h"
+#import "AWSCognitoIdentityProviderSrpMath.h"
 #import "AWSJKBigInteger.h"
 #import <AWSCore/AWSCocoaLumberjack.h>
 #import <CommonCrypto/CommonCrypto.h>
@@ -16,24 +17,66 @@
 
 #import "NSData+AWSCognitoIdentityProvider.h"
 
-void updateHashWithUnsignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt, uint8_t *buffer, size_t bufferSize);
-void updateHashWithSignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt, uint8_t *buffer, size_t bufferSize);
+void updateHashWithUnsignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt);
+void updateHashWithSignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt);
+void updateHashWithSignedBigIntData(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt);
 AWSJKBigInteger* finalizeUnsignedBigIntHash(CC_SHA256_CTX *ctx);
 AWSJKBigInteger* finalizeSignedBigIntHash(CC_SHA256_CTX *ctx);
 
 static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22514A08798E3404DDEF9519B3CD3A431B302B0A6DF25F14374FE1356D6D51C245E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F24117C4B1FE649286651ECE45B3DC2007CB8A163BF0598DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F356208552BB9ED529077096966D670C354E4ABC9804F1746C08CA18217C32905E462E36CE3BE39E772C180E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF6955817183995497CEA956AE515D2261898FA051015728E5A8AAAC42DAD33170D04507A33A85521ABDF1CBA64ECFB850458DBEF0A8AEA71575D060C7DB3970F85A6E1E4C7ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06D98A0864D87602733EC86A64521F2B18177B200CBBE117577A615D6C770988C0BAD946E208E24FA074E5AB3143DB5BFCE0FD108E4B82D120A93AD2CAFFFFFFFFFFFFFFFF";
 
+// Montgomery context and comb table for g = 2 against the default N, set up
+// once and shared by every authentication.
+typedef struct {
+    aws_mp_int N;
+    aws_mp_int g;
+    aws_mp_mod_ctx ctx;
+    aws_mp_comb comb;
+} AWSCognitoIdentityProviderSrpGroup;
+
+static AWSCognitoIdentityProviderSrpGroup *srpDefaultGroup(void) {
+    static AWSCognitoIdentityProviderSrpGroup group;
+    static BOOL groupReady = NO;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        if (aws_mp_init_multi(&group.N, &group.g, NULL) != AWS_MP_OKAY) {
+            return;
+        }
+        if (aws_mp_read_radix(&group.N, N_IN_HEX.UTF8String, 16) == AWS_MP_OKAY &&
+            aws_mp_set_int(&group.g, 2) == AWS_MP_OKAY &&
+            aws_mp_mod_ctx_init_mode(&group.ctx, &group.N, AWS_MP_REDUCE_MONTGOMERY) == AWS_MP_OKAY) {
+            if (aws_mp_comb_init(&group.comb, &group.g, &group.ctx, 256, 6) == AWS_MP_OKAY) {
+                groupReady = YES;
+                return;
+            }
+            aws_mp_mod_ctx_clear(&group.ctx);
+        }
+        aws_mp_clear_multi(&group.N, &group.g, NULL);
+    });
+    return groupReady ? &group : NULL;
+}
+
+static BOOL srpIsDefaultGroup(AWSCognitoIdentityProviderSrpGroup *group, aws_mp_int *N, aws_mp_int *g) {
+    return group != NULL && aws_mp_cmp(N, &group->N) == AWS_MP_EQ && aws_mp_cmp(g, &group->g) == AWS_MP_EQ;
+}
+
 #pragma mark - Srp State
 @implementation AWSCognitoIdentityProviderSrpCommonState
-- (instancetype)init {
-    if (self = [super init]) {
-            self.N = [[AWSJKBigInteger alloc] initWithString:N_IN_HEX
-                                               andRadix:16];
++ (instancetype)defaultState {
+    static AWSCognitoIdentityProviderSrpCommonState *defaultState = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        defaultState = [[AWSCognitoIdentityProviderSrpCommonState alloc]
+                        initN:[[AWSJKBigInteger alloc] initWithString:N_IN_HEX andRadix:16]
+                            g:[[AWSJKBigInteger alloc] initWithUnsignedLong:2l]];
+    });
+    return defaultState;
+}
 
-            self.g = [[AWSJKBigInteger alloc] initWithUnsignedLong:2l];
-            self.k = [self calculateK:self.N g:self.g];
-    }
-    return self;
+// AWSJKBigInteger is immutable, so every default state shares the parsed N, g and k.
+- (instancetype)init {
+    AWSCognitoIdentityProviderSrpCommonState *defaultState = [AWSCognitoIdentityProviderSrpCommonState defaultState];
+    return [self initN:defaultState.N g:defaultState.g k:defaultState.k];
 }
 
 - (instancetype)initN:(AWSJKBigInteger *)N g:(AWSJKBigInteger *)g k:(AWSJKBigInteger *)k {
@@ -55,28 +98,30 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
 }
 
 - (AWSJKBigInteger*)calculateK:(AWSJKBigInteger*)N g:(AWSJKBigInteger*)g {
-
-    // + 1 to allow for a sign byte
-    unsigned int maxNumBytes = [N countBytes] + 1;
-
-    uint8_t *bytes = malloc(sizeof(uint8_t) * maxNumBytes);
-    if (bytes == NULL) {
-        // this situation is irrecoverable and we don't want to return something corrupted, so we raise an exception (avoiding NSAssert that may be disabled)
-        [NSException raise:@"NSInternalInconsistencyException" format:@"failed malloc" arguments:nil];
-        return nil;
-    }
-
     CC_SHA256_CTX ctx;
     CC_SHA256_Init(&ctx);
-    updateHashWithSignedBigInt(&ctx, N, bytes, maxNumBytes);
-    updateHashWithUnsignedBigInt(&ctx, g, bytes, maxNumBytes);
-
-    free(bytes);
+    updateHashWithSignedBigInt(&ctx, N);
+    updateHashWithUnsignedBigInt(&ctx, g);
 
     return finalizeUnsignedBigIntHash(&ctx);
 }
 @end
 
+// A pooled key pair when commonState is the default group and the pool has one,
+// otherwise a fresh one.
+static AWSCognitoIdentityProviderSrpKeyPair *srpKeyPairForCommonState(AWSCognitoIdentityProviderSrpCommonState *commonState) {
+    AWSCognitoIdentityProviderSrpCommonState *defaultState = [AWSCognitoIdentityProviderSrpCommonState defaultState];
+    AWSCognitoIdentityProviderSrpKeyPair *keyPair = nil;
+
+    if ([commonState.N compare:defaultState.N] == NSOrderedSame && [commonState.g compare:defaultState.g] == NSOrderedSame) {
+        keyPair = [[AWSCognitoIdentityProviderSrpKeyPool sharedPool] takeKeyPair];
+    }
+    if (keyPair == nil) {
+        keyPair = [AWSCognitoIdentityProviderSrpKeyPair keyPairForCommonState:commonState];
+    }
+    return keyPair;
+}
+
 @implementation AWSCognitoIdentityProviderSrpClientState
 
 + (instancetype)clientStateForUserName:(NSString*)userName
@@ -87,13 +132,9 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
     me.userName = userName;
     me.password = password;
 
-    me.privateA = [AWSCognitoIdentityProviderSrpHelper
-            generatePrivateABigInt:commonState.N];
-
-    me.publicA = [AWSCognitoIdentityProviderSrpHelper
-            generatePublicABigInt:me.privateA
-                                N:commonState.N
-                                g:commonState.g];
+    AWSCognitoIdentityProviderSrpKeyPair *keyPair = srpKeyPairForCommonState(commonState);
+    me.privateA = keyPair.privateA;
+    me.publicA = keyPair.publicA;
 
     me.timestamp = [NSDate date];
     return me;
@@ -135,6 +176,163 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
 }
 @end
 
+#pragma mark - Srp Key Pairs
+
+@interface AWSCognitoIdentityProviderSrpKeyPair ()
+@property(nonatomic, strong, readwrite) AWSJKBigInteger *privateA;
+@property(nonatomic, strong, readwrite) AWSJKBigInteger *publicA;
+@end
+
+@implementation AWSCognitoIdentityProviderSrpKeyPair
++ (instancetype)keyPairForCommonState:(AWSCognitoIdentityProviderSrpCommonState *)commonState {
+    AWSCognitoIdentityProviderSrpKeyPair *keyPair = [[AWSCognitoIdentityProviderSrpKeyPair alloc] init];
+    keyPair.privateA = [AWSCognitoIdentityProviderSrpHelper generatePrivateABigInt:commonState.N];
+    keyPair.publicA = [AWSCognitoIdentityProviderSrpHelper generatePublicABigInt:keyPair.privateA
+                                                                               N:commonState.N
+                                                                               g:commonState.g];
+    return keyPair;
+}
+@end
+
+@interface AWSCognitoIdentityProviderSrpKeyPool ()
+@property(atomic, readwrite) NSUInteger count;
+@property(atomic, readwrite) NSUInteger hits;
+@property(atomic, readwrite) NSUInteger misses;
+@property(atomic, readwrite) NSUInteger generated;
+@end
+
+@implementation AWSCognitoIdentityProviderSrpKeyPool {
+    NSMutableArray<AWSCognitoIdentityProviderSrpKeyPair *> *_keyPairs;
+    NSUInteger _depth;
+    NSUInteger _refillThreshold;
+    dispatch_queue_t _refillQueue;
+    BOOL _refilling;
+}
+
++ (instancetype)sharedPool {
+    static AWSCognitoIdentityProviderSrpKeyPool *sharedPool = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedPool = [[AWSCognitoIdentityProviderSrpKeyPool alloc] init];
+    });
+    return sharedPool;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _keyPairs = [NSMutableArray new];
+        _depth = 2;
+        _refillThreshold = 1;
+        _refillQueue = dispatch_queue_create("com.amazonaws.AWSCognitoIdentityProviderSrpKeyPool",
+                                             dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+    }
+    return self;
+}
+
+- (NSUInteger)depth {
+    @synchronized(self) {
+        return _depth;
+    }
+}
+
+- (void)setDepth:(NSUInteger)depth {
+    @synchronized(self) {
+        _depth = depth;
+        if (_keyPairs.count > depth) {
+            [_keyPairs removeObjectsInRange:NSMakeRange(depth, _keyPairs.count - depth)];
+            self.count = _keyPairs.count;
+        }
+        if (_keyPairs.count >= _refillThreshold) {
+            return;
+        }
+    }
+    [self refill];
+}
+
+- (NSUInteger)refillThreshold {
+    @synchronized(self) {
+        return _refillThreshold;
+    }
+}
+
+- (void)setRefillThreshold:(NSUInteger)refillThreshold {
+    @synchronized(self) {
+        _refillThreshold = refillThreshold;
+        if (_keyPairs.count >= refillThreshold) {
+            return;
+        }
+    }
+    [self refill];
+}
+
+- (AWSCognitoIdentityProviderSrpKeyPair *)takeKeyPair {
+    AWSCognitoIdentityProviderSrpKeyPair *keyPair = nil;
+    @synchronized(self) {
+        if (_depth == 0) {
+            return nil;
+        }
+        keyPair = _keyPairs.firstObject;
+        if (keyPair != nil) {
+            [_keyPairs removeObjectAtIndex:0];
+            self.count = _keyPairs.count;
+            self.hits = self.hits + 1;
+        } else {
+            self.misses = self.misses + 1;
+        }
+        if (_keyPairs.count >= _refillThreshold) {
+            return keyPair;
+        }
+    }
+    [self refill];
+    return keyPair;
+}
+
+- (void)refill {
+    @synchronized(self) {
+        if (_refilling || _keyPairs.count >= _depth) {
+            return;
+        }
+        _refilling = YES;
+    }
+
+    dispatch_async(_refillQueue, ^{
+        AWSCognitoIdentityProviderSrpCommonState *commonState = [AWSCognitoIdentityProviderSrpCommonState defaultState];
+        for (;;) {
+            @synchronized(self) {
+                if (self->_keyPairs.count >= self->_depth) {
+                    self->_refilling = NO;
+                    return;
+                }
+            }
+            // outside the lock, this is the part that takes time
+            AWSCognitoIdentityProviderSrpKeyPair *keyPair = [AWSCognitoIdentityProviderSrpKeyPair keyPairForCommonState:commonState];
+            @synchronized(self) {
+                if (self->_keyPairs.count < self->_depth) {
+                    [self->_keyPairs addObject:keyPair];
+                    self.count = self->_keyPairs.count;
+                }
+                self.generated = self.generated + 1;
+            }
+        }
+    });
+}
+
+- (void)drain {
+    @synchronized(self) {
+        [_keyPairs removeAllObjects];
+        self.count = 0;
+    }
+}
+
+- (void)resetCounters {
+    @synchronized(self) {
+        self.hits = 0;
+        self.misses = 0;
+        self.generated = 0;
+    }
+}
+@end
+
 #pragma mark - Srp Helper
 
 @implementation AWSCognitoIdentityProviderSrpHelper {
@@ -156,11 +354,10 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
     if (self = [super init]) {
         self.commonState = [[AWSCognitoIdentityProviderSrpCommonState alloc] init];
 
-        AWSJKBigInteger *privateA = [AWSCognitoIdentityProviderSrpHelper generatePrivateABigInt:self.commonState.N];
-        AWSJKBigInteger *publicA = [AWSCognitoIdentityProviderSrpHelper generatePublicABigInt:privateA N:self.commonState.N g:self.commonState.g];
+        AWSCognitoIdentityProviderSrpKeyPair *keyPair = srpKeyPairForCommonState(self.commonState);
 
         self.clientState = [AWSCognitoIdentityProviderSrpClientState
-                clientStateForUserName:userName password:password privateA:privateA publicA:publicA];
+                clientStateForUserName:userName password:password privateA:keyPair.privateA publicA:keyPair.publicA];
     }
     return self;
 }
@@ -183,12 +380,10 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
                               password:password
                               salt:self.salt];
 
-        AWSJKBigInteger *N = [[AWSJKBigInteger alloc] initWithString:N_IN_HEX
-                                       andRadix:16];
-        AWSJKBigInteger *g = [[AWSJKBigInteger alloc] initWithUnsignedLong:2l];
-        
+        AWSCognitoIdentityProviderSrpCommonState *defaultState = [AWSCognitoIdentityProviderSrpCommonState defaultState];
+
         //calculate v
-        self.v = [g pow:x andMod:N];
+        self.v = [AWSCognitoIdentityProviderSrpHelper powGenerator:defaultState.g exponent:x N:defaultState.N];
     }
     return self;
 }
@@ -269,21 +464,26 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
     
     self.u = [AWSCognitoIdentityProviderSrpHelper hashBigInts:@[self.clientState.publicA, B]];
 
-    AWSJKBigInteger *k = self.commonState.k;
-    AWSJKBigInteger *g = self.commonState.g;
-    AWSJKBigInteger *N = self.commonState.N;
-
-    AWSJKBigInteger *a = self.clientState.privateA;
-    AWSJKBigInteger *exp = [a add:[self.u multiply:self.x]];
-    AWSJKBigInteger *base = [B subtract:[k multiply:[g pow:self.x andMod:N]]];
-
-    //Need this for negative base #s
-    base = [AWSCognitoIdentityProviderSrpHelper mod:base divisor:N];
+    aws_mp_int S;
+    if (aws_mp_init(&S) != AWS_MP_OKAY) {
+        // this situation is irrecoverable and we don't want to return something corrupted, so we raise an exception (avoiding NSAssert that may be disabled)
+        [NSException raise:@"NSInternalInconsistencyException" format:@"failed malloc" arguments:nil];
+        return nil;
+    }
+    // the default group's context and its comb for g^x, which cover the 256-bit x
+    AWSCognitoIdentityProviderSrpGroup *group = srpDefaultGroup();
+    BOOL isDefaultGroup = srpIsDefaultGroup(group, [self.commonState.N value], [self.commonState.g value]);
+    if (calculateSrpS([B value], [self.commonState.k value], [self.commonState.g value], [self.x value],
+                      [self.clientState.privateA value], [self.u value], [self.commonState.N value],
+                      isDefaultGroup ? &group->ctx : NULL, isDefaultGroup ? &group->comb : NULL, &S) != AWS_MP_OKAY) {
+        aws_mp_clear(&S);
+        [NSException raise:@"NSInternalInconsistencyException" format:@"failed to calculate S" arguments:nil];
+        return nil;
+    }
 
-    AWSJKBigInteger *S = [base pow:exp andMod:N];
-    S = [AWSCognitoIdentityProviderSrpHelper mod:S divisor:N];
-    
-    return S;
+    AWSJKBigInteger *result = [[AWSJKBigInteger alloc] initWithValue:&S];
+    aws_mp_clear(&S);
+    return result;
 }
 
 + (NSString *)generateDateString:(NSDate *)date {
@@ -301,12 +501,41 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
 }
 
 + (AWSJKBigInteger*) generatePublicABigInt:(AWSJKBigInteger*)privateA N:(AWSJKBigInteger*)N g:(AWSJKBigInteger*)g {
-    AWSJKBigInteger *publicA = [g pow:privateA andMod:N];
+    AWSJKBigInteger *publicA = [self powGenerator:g exponent:privateA N:N];
     return publicA;
 }
 
+// g^exponent % N for the secret a and x. For the default group the powers of g
+// are precomputed once in a comb table, which covers the 256-bit a and x
+// without the squarings. Both paths run in constant time.
++ (AWSJKBigInteger*) powGenerator:(AWSJKBigInteger*)g exponent:(AWSJKBigInteger*)exponent N:(AWSJKBigInteger*)N {
+    AWSCognitoIdentityProviderSrpGroup *group = srpDefaultGroup();
+    if (!srpIsDefaultGroup(group, [N value], [g value])) {
+        return [g constantTimePow:exponent andMod:N];
+    }
+
+    aws_mp_int output;
+    if (aws_mp_init(&output) != AWS_MP_OKAY) {
+        return [g constantTimePow:exponent andMod:N];
+    }
+    if (aws_mp_exptmod_comb_ct(&group->comb, [exponent value], &output) != AWS_MP_OKAY) {
+        aws_mp_clear(&output);
+        return [g constantTimePow:exponent andMod:N];
+    }
+    AWSJKBigInteger *result = [[AWSJKBigInteger alloc] initWithValue:&output];
+    aws_mp_clear(&output);
+    return result;
+}
+
+// dividend % divisor in [0, divisor); reduced in place, handed out as an immutable copy
+// since the result ends up in the key pool and the helper's state
 + (AWSJKBigInteger*) mod:(AWSJKBigInteger*)dividend divisor:(AWSJKBigInteger*) divisor {
-    return [[divisor add:[dividend remainder:divisor]] remainder:divisor];
+    AWSJKMutableBigInteger *remainder = [[AWSJKMutableBigInteger alloc] initWithValue:[dividend value]];
+    if (![remainder modInPlace:divisor]) {
+        [NSException raise:@"NSInternalInconsistencyException" format:@"failed to reduce" arguments:nil];
+        return nil;
+    }
+    return [remainder bigIntegerValue];
 }
 
 #pragma mark - Hashing
@@ -316,44 +545,44 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
     CC_SHA256_Init(&ctx);
     
     for (AWSJKBigInteger *i in bigInts) {
-        NSData *data = [NSData aws_dataWithSignedBigInteger:i];
-        CC_SHA256_Update(&ctx, data.bytes, (CC_LONG)data.length);        
+        updateHashWithSignedBigIntData(&ctx, i);
     }
     
     return finalizeSignedBigIntHash(&ctx);
 }
 
-void updateHashWithUnsignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt, uint8_t *buffer, size_t bufferSize) {
-    unsigned int byteCount = [bigInt countBytes];
-    uint8_t *targetBuffer = buffer;
-    
-    if (byteCount <= bufferSize) {
-        targetBuffer = malloc(sizeof(uint8_t) * byteCount);
-    }
-    
-    [bigInt toByteArrayUnsigned:targetBuffer];
-    CC_SHA256_Update(ctx, targetBuffer, byteCount);
-    
-    if (targetBuffer != buffer) {
-        free(targetBuffer);
-    }
+// Hands each piece of a big-endian encoding from tommath to the SHA-256 context in dat
+static int srpHashUpdate(const unsigned char *src, unsigned long len, void *dat) {
+    CC_SHA256_Update((CC_SHA256_CTX *)dat, src, (CC_LONG)len);
+    return AWS_MP_OKAY;
 }
 
-void updateHashWithSignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt, uint8_t *buffer, size_t bufferSize) {
-    // + 1 to allow for a sign byte TODO: add a function to JKBigInteger to provide a countBytesForSigned
-    unsigned int byteCount = [bigInt countBytes] + 1;
-    uint8_t *targetBuffer = buffer;
+// The digits go into the hash in small pieces, without a buffer the size of the number.
+void updateHashWithUnsignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt) {
+    aws_mp_to_unsigned_bin_stream([bigInt value], srpHashUpdate, ctx);
+}
 
-    if (byteCount <= bufferSize) {
-        targetBuffer = malloc(sizeof(uint8_t) * byteCount);
-    }
+// The tommath signed format, a sign byte and the magnitude
+void updateHashWithSignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt) {
+    aws_mp_to_signed_bin_stream([bigInt value], srpHashUpdate, ctx);
+}
 
-    [bigInt toByteArraySigned:targetBuffer];
-    CC_SHA256_Update(ctx, targetBuffer, byteCount);
+// The bytes of [NSData aws_dataWithSignedBigInteger:bigInt] without the NSData. For a
+// non-negative value of two bytes or more [every N, A, B, S, u and salt] that is the
+// magnitude, after a zero byte if its top bit is set. Anything else takes the NSData route.
+void updateHashWithSignedBigIntData(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt) {
+    aws_mp_int *value = [bigInt value];
 
-    if (targetBuffer != buffer) {
-        free(targetBuffer);
+    if (value->sign != AWS_MP_ZPOS || aws_mp_unsigned_bin_size(value) < 2) {
+        NSData *data = [NSData aws_dataWithSignedBigInteger:bigInt];
+        CC_SHA256_Update(ctx, data.bytes, (CC_LONG)data.length);
+        return;
     }
+    if (aws_mp_count_bits(value) % 8 == 0) {
+        const uint8_t signByte = 0;
+        CC_SHA256_Update(ctx, &signByte, sizeof(signByte));
+    }
+    aws_mp_to_unsigned_bin_stream(value, srpHashUpdate, ctx);
 }
 
 AWSJKBigInteger* finalizeUnsignedBigIntHash(CC_SHA256_CTX *ctx) {
@@ -376,25 +605,22 @@ AWSJKBigInteger* finalizeSignedBigIntHash(CC_SHA256_CTX *ctx) {
     // hash goes in [1..CC_SHA256_DIGEST_LENGTH; keep hash[0] for the sign byte required by AWSJKBigInteger
     CC_SHA256_Final(hash+1, ctx);
     
-    AWSJKBigInteger *twosComplementMinusOneMaybe = nil;
     hash[0] = (hash[1] & 0x80) == 0x80;
     if (hash[0]) { //two's complement; need to convert to unsigned
-        
-        twosComplementMinusOneMaybe = [[AWSJKBigInteger alloc] initWithString:@"-1"];
-        
         for( int i = 1; i < bufferLength; i++) {
             hash[i] = ~hash[i];
         }
-    } else {
-        twosComplementMinusOneMaybe = [[AWSJKBigInteger alloc] initWithString:@"0"];
     }
     
     aws_mp_int hashBigInt;
     aws_mp_init(&hashBigInt);
     aws_mp_read_signed_bin(&hashBigInt, hash, bufferLength);
+    // -(~h) - 1 is the two's complement value, subtracted here rather than by adding a -1 object
+    if (hash[0]) {
+        aws_mp_sub_d(&hashBigInt, 1, &hashBigInt);
+    }
     
     AWSJKBigInteger *result = [[AWSJKBigInteger alloc] initWithValue:&hashBigInt];
-    result = [result add:twosComplementMinusOneMaybe];
     
     aws_mp_clear(&hashBigInt);
     
@@ -414,12 +640,10 @@ AWSJKBigInteger* finalizeSignedBigIntHash(CC_SHA256_CTX *ctx) {
     CC_SHA256_Update(&identityHashCtx, [password UTF8String], (CC_LONG)[password lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
     CC_SHA256_Final(identityHash, &identityHashCtx);
     
-    NSData *saltData = [NSData aws_dataWithSignedBigInteger:salt];
-    
     uint8_t finalHash[CC_SHA256_DIGEST_LENGTH];
     CC_SHA256_CTX ctx;
     CC_SHA256_Init(&ctx);
-    CC_SHA256_Update(&ctx, saltData.bytes, (CC_LONG)saltData.length);
+    updateHashWithSignedBigIntData(&ctx, salt);
     CC_SHA256_Update(&ctx, identityHash, sizeof(identityHash));
     CC_SHA256_Final(finalHash, &ctx);
     return [NSData dataWithBytes:finalHash length:CC_SHA256_DIGEST_LENGTH];
@@ -438,10 +662,9 @@ AWSJKBigInteger* finalizeSignedBigIntHash(CC_SHA256_CTX *ctx) {
     CC_SHA256_Update(&identityHashCtx, password.UTF8String, (CC_LONG)[password lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
     CC_SHA256_Final(identityHash, &identityHashCtx);
     
-    NSData *saltData = [NSData aws_dataWithSignedBigInteger:salt];
     CC_SHA256_CTX ctx;
     CC_SHA256_Init(&ctx);
-    CC_SHA256_Update(&ctx, saltData.bytes, (CC_LONG)saltData.length);
+    updateHashWithSignedBigIntData(&ctx, salt);
     CC_SHA256_Update(&ctx, identityHash, sizeof(identityHash));
     
 
@@ -453,8 +676,7 @@ AWSJKBigInteger* finalizeSignedBigIntHash(CC_SHA256_CTX *ctx) {
     CC_SHA256_Init(&ctx);
     
     for (AWSJKBigInteger *i in bigInts) {
-        NSData *data = [NSData aws_dataWithSignedBigInteger:i];
-        CC_SHA256_Update(&ctx, data.bytes, (CC_LONG)data.length);
+        updateHashWithSignedBigIntData(&ctx, i);
     }
     
     return finalizeUnsignedBigIntHash(&ctx);
@@ -0,0 +1,70 @@
+//
+// Copyright 2014-2016 Amazon.com,
+// Inc. or its affiliates. All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "AWSCognitoIdentityProviderSrpMath.h"
+
+// g^exponent % N through the fastest routine that takes N: the comb, then the
+// Montgomery context, both constant time, then aws_mp_exptmod for the moduli
+// they turn down with AWS_MP_VAL [above AWS_MP_MONTGOMERY_DIGS digits], like
+// constantTimePow:andMod:.
+static int srpExptmod(aws_mp_int *g, aws_mp_int *exponent, aws_mp_int *N, aws_mp_mod_ctx *ctx, aws_mp_comb *comb, aws_mp_int *output) {
+    int err = AWS_MP_VAL;
+
+    if (comb != NULL) {
+        err = aws_mp_exptmod_comb_ct(comb, exponent, output);
+    }
+    if (err == AWS_MP_VAL && ctx != NULL) {
+        err = aws_mp_exptmod_multi(g, exponent, 1, ctx, output);
+    }
+    if (err == AWS_MP_VAL) {
+        err = aws_mp_exptmod(g, exponent, N, output);
+    }
+    return err;
+}
+
+// Straight on the tommath values, without an AWSJKBigInteger per step. Without
+// a context from the caller one is set up here if N has a Montgomery form.
+int calculateSrpS(aws_mp_int *B, aws_mp_int *k, aws_mp_int *g, aws_mp_int *x, aws_mp_int *a, aws_mp_int *u, aws_mp_int *N,
+                  aws_mp_mod_ctx *ctx, aws_mp_comb *comb, aws_mp_int *S) {
+    aws_mp_mod_ctx localCtx;
+    aws_mp_int base, exponent;
+    int err;
+
+    if (ctx == NULL && aws_mp_mod_ctx_init_mode(&localCtx, N, AWS_MP_REDUCE_MONTGOMERY) == AWS_MP_OKAY) {
+        ctx = &localCtx;
+    }
+
+    if ((err = aws_mp_init_multi(&base, &exponent, NULL)) != AWS_MP_OKAY) {
+        goto cleanupCtx;
+    }
+
+    // base = (B - k * g^x) % N, kept non-negative
+    if ((err = srpExptmod(g, x, N, ctx, comb, &base)) == AWS_MP_OKAY) {
+        err = (ctx != NULL) ? aws_mp_mulmod_ctx(k, &base, ctx, &base) : aws_mp_mulmod(k, &base, N, &base);
+    }
+    if (err != AWS_MP_OKAY ||
+        (err = aws_mp_sub(B, &base, &base)) != AWS_MP_OKAY ||
+        (err = aws_mp_mod(&base, N, &base)) != AWS_MP_OKAY) {
+        goto cleanup;
+    }
+
+    // exponent = a + u * x
+    if ((err = aws_mp_mul(u, x, &exponent)) != AWS_MP_OKAY ||
+        (err = aws_mp_add(&exponent, a, &exponent)) != AWS_MP_OKAY) {
+        goto cleanup;
+    }
+
+    err = srpExptmod(&base, &exponent, N, ctx, NULL, S);
+
+cleanup:
+    aws_mp_clear_multi(&base, &exponent, NULL);
+cleanupCtx:
+    if (ctx == &localCtx) {
+        aws_mp_mod_ctx_clear(&localCtx);
+    }
+    return err;
+}
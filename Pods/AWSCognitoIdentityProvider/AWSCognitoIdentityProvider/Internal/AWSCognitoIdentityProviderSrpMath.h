@@ -0,0 +1,27 @@
+//
+// Copyright 2014-2016 Amazon.com,
+// Inc. or its affiliates. All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef AWSCognitoIdentityProviderSrpMath_h
+#define AWSCognitoIdentityProviderSrpMath_h
+
+#include "aws_tommath.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// S = ((B - k * g^x) ^ (a + u * x)) % N, the client's SRP premaster secret.
+// ctx is a Montgomery context of N and comb a comb table of g over it, either
+// may be NULL. Plain C so that it can be checked off the device.
+int calculateSrpS(aws_mp_int *B, aws_mp_int *k, aws_mp_int *g, aws_mp_int *x, aws_mp_int *a, aws_mp_int *u, aws_mp_int *N,
+                  aws_mp_mod_ctx *ctx, aws_mp_comb *comb, aws_mp_int *S);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -30,6 +30,7 @@
 
 - (id)pow:(unsigned int)exponent;
 - (id)pow:(AWSJKBigInteger*)exponent andMod:(AWSJKBigInteger*)modulus;
+- (id)constantTimePow:(AWSJKBigInteger*)exponent andMod:(AWSJKBigInteger*)modulus;
 - (id)negate;
 - (id)abs;
 
@@ -54,3 +55,10 @@
 - (void)toByteArrayUnsigned: (unsigned char*) byteArray;
 
 @end
+
+@interface AWSJKMutableBigInteger : AWSJKBigInteger
+
+- (BOOL)modInPlace:(AWSJKBigInteger *)modulus;
+- (AWSJKBigInteger *)bigIntegerValue;
+
+@end
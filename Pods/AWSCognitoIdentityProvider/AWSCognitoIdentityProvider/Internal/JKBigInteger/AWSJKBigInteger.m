@@ -36,6 +36,7 @@
     self = [super init];
     
     if (self) {
+        aws_mp_init(&m_value);
         aws_mp_set_int(&m_value, unsignedLong);
     }
     
@@ -248,6 +249,27 @@
     return newBigInteger;
 }
 
+// Same as pow:andMod: but the time taken does not depend on the bits of the
+// exponent, for secret exponents. Moduli the constant time code doesn't
+// support (even ones) fall back to pow:andMod:.
+- (id)constantTimePow:(AWSJKBigInteger*)exponent andMod: (AWSJKBigInteger*)modulus {
+
+    int result;
+    aws_mp_int output;
+    aws_mp_init(&output);
+    
+    result = aws_mp_exptmod_ct(&m_value, &exponent->m_value, &modulus->m_value, &output);
+    if (result == AWS_MP_VAL) {
+        aws_mp_clear(&output);
+        return [self pow:exponent andMod:modulus];
+    }
+    
+    AWSJKBigInteger *newBigInteger = [[AWSJKBigInteger alloc] initWithValue:&output];
+    aws_mp_clear(&output);
+    
+    return newBigInteger;
+}
+
 - (id)negate {
 
     aws_mp_int negate;
@@ -414,3 +436,16 @@
 }
 
 @end
+
+@implementation AWSJKMutableBigInteger
+
+// In [0, modulus) whatever the sign of the receiver
+- (BOOL)modInPlace:(AWSJKBigInteger *)modulus {
+    return aws_mp_mod([self value], [modulus value], [self value]) == AWS_MP_OKAY;
+}
+
+- (AWSJKBigInteger *)bigIntegerValue {
+    return [[AWSJKBigInteger alloc] initWithValue:[self value]];
+}
+
+@end
@@ -45,9 +45,16 @@ extern "C" {
 #endif
 
 
-/* detect 64-bit mode if possible */
-#if defined(__x86_64__) 
-   #if !(defined(AWS_MP_64BIT) && defined(AWS_MP_16BIT) && defined(AWS_MP_8BIT))
+/* detect 64-bit mode if possible
+ *
+ * Any target whose compiler provides a 128-bit integer (x86_64, arm64) can hold
+ * a 2*60+1 bit mp_word, so 60-bit digits are selected there automatically.  A
+ * 3072-bit operand is then 52 digits instead of 110.  Define AWS_MP_28BIT (or
+ * one of the other digit sizes) to force the portable configuration.
+ */
+#if !(defined(AWS_MP_8BIT) || defined(AWS_MP_16BIT) || defined(AWS_MP_28BIT) || \
+      defined(AWS_MP_31BIT) || defined(AWS_MP_64BIT))
+   #if defined(__x86_64__) || defined(__SIZEOF_INT128__)
       #define AWS_MP_64BIT
    #endif
 #endif
@@ -74,7 +81,11 @@ extern "C" {
 #endif
 
    typedef unsigned long      aws_mp_digit;
+#ifdef __SIZEOF_INT128__
+   typedef __uint128_t        aws_mp_word;
+#else
    typedef unsigned long      aws_mp_word __attribute__ ((mode(TI)));
+#endif
 
    #define AWS_DIGIT_BIT          60
 #else
@@ -100,7 +111,9 @@ extern "C" {
 #else
    /* default case is 28-bit digits, defines MP_28BIT as a handy macro to test */
    #define AWS_DIGIT_BIT          28
-   #define AWS_MP_28BIT
+   #ifndef AWS_MP_28BIT
+      #define AWS_MP_28BIT
+   #endif
 #endif   
 #endif
 
@@ -154,11 +167,60 @@ extern "C" {
 
 typedef int aws_mp_err;
 
-/* you'll have to tune these... */
-extern int AWS_KARATSUBA_MUL_CUTOFF,
+/* crossover points, in digits, for Karatsuba, Toom-Cook and transform multiplication/squaring
+ * and for recursive division
+ *
+ * tools/tommath/tune.c times aws_mp_mul/aws_mp_sqr/aws_mp_div on the build machine and writes them to
+ * aws_tommath_cutoffs.h, which is picked up when AWS_MP_TUNED_CUTOFFS is defined.
+ * They can also be replaced at run time with aws_mp_set_cutoffs().
+ */
+#ifdef AWS_MP_TUNED_CUTOFFS
+   #include "aws_tommath_cutoffs.h"
+#endif
+#ifndef AWS_MP_KARATSUBA_MUL_DEFAULT
+   #define AWS_MP_KARATSUBA_MUL_DEFAULT   80
+#endif
+#ifndef AWS_MP_KARATSUBA_SQR_DEFAULT
+   #define AWS_MP_KARATSUBA_SQR_DEFAULT   120
+#endif
+#ifndef AWS_MP_TOOM_MUL_DEFAULT
+   #define AWS_MP_TOOM_MUL_DEFAULT        350
+#endif
+#ifndef AWS_MP_TOOM_SQR_DEFAULT
+   #define AWS_MP_TOOM_SQR_DEFAULT        400
+#endif
+#ifndef AWS_MP_DIV_RECURSIVE_DEFAULT
+   #define AWS_MP_DIV_RECURSIVE_DEFAULT   40
+#endif
+#ifndef AWS_MP_NTT_DEFAULT
+   /* about 120k bits with 60-bit digits, 42k bits with 28-bit ones */
+   #ifdef AWS_MP_64BIT
+      #define AWS_MP_NTT_DEFAULT          2000
+   #else
+      #define AWS_MP_NTT_DEFAULT          1500
+   #endif
+#endif
+
+/* smallest cutoffs the routines can split at, and the largest one that is stored
+ * [a cutoff of AWS_MP_CUTOFF_MAX digits or more, AWS_MP_NTT_CUTOFF_MAX for the transforms,
+ * switches the algorithm off; AWS_MP_CUTOFF_OFF says so explicitly and is what
+ * aws_mp_get_cutoffs() reports for it] */
+#define AWS_MP_KARATSUBA_MIN       2
+#define AWS_MP_TOOM_MIN            3
+#define AWS_MP_DIV_RECURSIVE_MIN   4
+#define AWS_MP_NTT_MIN             1
+#define AWS_MP_CUTOFF_MAX          0x3FF
+#define AWS_MP_NTT_CUTOFF_MAX      0x3FFF
+#define AWS_MP_CUTOFF_OFF          INT_MAX
+
+/* the compiled-in defaults, read-only: aws_mp_set_cutoffs() changes the cutoffs in
+ * effect and aws_mp_get_cutoffs() reads them */
+extern const int AWS_KARATSUBA_MUL_CUTOFF,
         AWS_KARATSUBA_SQR_CUTOFF,
         AWS_TOOM_MUL_CUTOFF,
-        AWS_TOOM_SQR_CUTOFF;
+        AWS_TOOM_SQR_CUTOFF,
+        AWS_DIV_RECURSIVE_CUTOFF,
+        AWS_NTT_CUTOFF;
 
 /* define this to use lower memory usage routines (exptmods mostly) */
 /* #define AWS_MP_LOW_MEM */
@@ -172,15 +234,128 @@ extern int AWS_KARATSUBA_MUL_CUTOFF,
    #endif   
 #endif
 
-/* size of comba arrays, should be at least 2 * 2**(BITS_PER_WORD - BITS_PER_DIGIT*2) */
-#define AWS_MP_WARRAY               (1 << (sizeof(aws_mp_word) * CHAR_BIT - 2 * AWS_DIGIT_BIT + 1))
+/* size of comba arrays, should be at least 2 * 2**(BITS_PER_WORD - BITS_PER_DIGIT*2)
+ *
+ * Both the 28-bit and 60-bit configurations leave 8 bits of headroom in a column
+ * so the comba routines handle operands of up to 256 digits (7168 and 15360 bits
+ * respectively).  The comba kernels only touch the columns they need, so a
+ * smaller value may be defined to save stack on constrained targets.
+ */
+#ifndef AWS_MP_WARRAY
+   #define AWS_MP_WARRAY            (1 << (sizeof(aws_mp_word) * CHAR_BIT - 2 * AWS_DIGIT_BIT + 1))
+#endif
+
+/* largest modulus, in digits, handled by the fused Montgomery multiply/square kernels
+ *
+ * 4096 bits, as long as a column of 2n products still fits an aws_mp_word
+ * [this caps the 28-bit configuration at 127 digits]
+ */
+#ifndef AWS_MP_MONTGOMERY_DIGS
+   #define AWS_MP_MONTGOMERY_DIGS   (((4096 + AWS_DIGIT_BIT - 1) / AWS_DIGIT_BIT) < (AWS_MP_WARRAY / 4 - 1) ? \
+                                     ((4096 + AWS_DIGIT_BIT - 1) / AWS_DIGIT_BIT) : (AWS_MP_WARRAY / 4 - 1))
+#endif
+
+/* modulus size, in bits, the spelled out Montgomery kernels in aws_tommath_fixed.h are for
+ *
+ * tools/tommath/fixed.c writes that header, as shipped for 3072 bits [the SRP group].  Every
+ * modulus with as many digits uses them, any size the header was not written for
+ * [or 0] leaves them out.
+ */
+#ifndef AWS_MP_FIXED_BITS
+   #define AWS_MP_FIXED_BITS        3072
+#endif
+
+/* smallest operand, in digits, for which the comba routines form their columns on
+ * the vector unit [AVX2 or NEON, 28-bit digits only] instead of the scalar loops
+ */
+#ifndef AWS_MP_SIMD_CUTOFF
+   #define AWS_MP_SIMD_CUTOFF       16
+#endif
+
+/* size, in digits, below which radix conversions stop splitting and work digit by digit */
+#ifndef AWS_MP_RADIX_DC_CUTOFF
+   #define AWS_MP_RADIX_DC_CUTOFF   32
+#endif
+
+/* size, in digits, from which aws_mp_gcd() uses Lehmer's method instead of the binary one
+ * [which only wins below about 16 bits]
+ */
+#ifndef AWS_MP_LEHMER_CUTOFF
+   #define AWS_MP_LEHMER_CUTOFF     1
+#endif
+
+/* largest per thread scratch arena, in digits, and how deep scratch scopes may nest
+ *
+ * Temporaries that don't fit are taken from the heap as usual.
+ */
+#ifndef AWS_MP_SCRATCH_DIGS
+   #define AWS_MP_SCRATCH_DIGS      (1 << 16)
+#endif
+
+#ifndef AWS_MP_SCRATCH_DEPTH
+   #define AWS_MP_SCRATCH_DEPTH     32
+#endif
+
+/* define this to a digit count to give every aws_mp_int that many digits of
+ * inline storage, e.g. 8 holds a 256-bit hash with 60-bit digits.  Integers
+ * that fit never touch the heap, larger ones move out on the first grow.
+ *
+ * With inline storage an aws_mp_int [or a struct holding one] must not be
+ * copied or moved by value, dp may point into the struct itself.
+ */
+/* #define AWS_MP_INLINE_DIGS 8 */
 
 /* the infamous mp_int structure */
 typedef struct  {
     int used, alloc, sign;
     aws_mp_digit *dp;
+#ifdef AWS_MP_INLINE_DIGS
+    aws_mp_digit inl[AWS_MP_INLINE_DIGS];
+#endif
 } aws_mp_int;
 
+/* reduction methods an aws_mp_mod_ctx can be set up for */
+#define AWS_MP_REDUCE_MONTGOMERY  0   /* odd moduli */
+#define AWS_MP_REDUCE_DR          1   /* diminished radix, B**k - b */
+#define AWS_MP_REDUCE_2K          2   /* unrestricted diminished radix, 2**p - b */
+#define AWS_MP_REDUCE_BARRETT     3   /* any other modulus */
+#define AWS_MP_REDUCE_2K_L        4   /* 2**p - d with a multi digit d */
+
+/* precomputed reduction state for a fixed modulus, set up once with
+ * aws_mp_mod_ctx_init() and shared by every exptmod/mulmod/sqrmod against
+ * that modulus.  Treat the members as private.
+ */
+typedef struct {
+    int          mode;    /* one of the AWS_MP_REDUCE_* methods */
+    aws_mp_digit mp;      /* Montgomery rho, or the DR/2k setup digit */
+    aws_mp_int   N,       /* copy of the modulus */
+                 mu,      /* Barrett mu, or the 2k_l multiplier */
+                 RR;      /* R**2 mod N (Montgomery only) */
+} aws_mp_mod_ctx;
+
+/* a full set of multiplication and division cutoffs, see aws_mp_set_cutoffs() */
+typedef struct {
+    int karatsuba_mul,
+        karatsuba_sqr,
+        toom_mul,
+        toom_sqr,
+        div_recursive,   /* smallest divisor and quotient, in digits, aws_mp_div() recurses on */
+        ntt;             /* smallest operand, in digits, aws_mp_mul()/aws_mp_sqr() transform */
+} aws_mp_cutoffs;
+
+/* Lim-Lee comb table for a fixed base g against a fixed modulus, built once
+ * with aws_mp_comb_init() and then used read-only by aws_mp_exptmod_comb().
+ * The modulus context is borrowed and must outlive the comb.
+ */
+typedef struct {
+    int             teeth,    /* h, the table has 2**h entries */
+                    spacing,  /* a = ceil(bits/h), squarings per exponentiation */
+                    bits;     /* largest exponent the table covers */
+    aws_mp_int      G,        /* copy of the base */
+                   *T;        /* T[i] = prod g**(2**(j*a)) over the set bits j of i */
+    aws_mp_mod_ctx *ctx;
+} aws_mp_comb;
+
 /* callback for mp_prime_random, should fill dst with random bytes and return how many read [upto len] */
 typedef int aws_ltm_prime_callback(unsigned char *dst, int len, void *dat);
 
@@ -217,6 +392,23 @@ int aws_mp_grow(aws_mp_int *a, int size);
 /* init to a given number of digits */
 int aws_mp_init_size(aws_mp_int *a, int size);
 
+/* ---> per thread scratch arena for temporaries <--- */
+/* open/close a scratch scope, scopes nest */
+void aws_mp_scratch_begin(void);
+void aws_mp_scratch_end(void);
+
+/* init to a given number of digits taken from the current scope [heap if there is none or it is full] */
+int aws_mp_init_scratch(aws_mp_int *a, int size);
+
+/* init a null terminated series of arguments from the current scope */
+int aws_mp_init_multi_scratch(int size, aws_mp_int *mp, ...);
+
+/* AWS_MP_YES if dp points into this thread's arena */
+int aws_mp_scratch_owns(const aws_mp_digit *dp);
+
+/* free this thread's arena [only outside of any scope] */
+void aws_mp_scratch_release(void);
+
 /* ---> Basic Manipulations <--- */
 #define aws_mp_iszero(a) (((a)->used == 0) ? AWS_MP_YES : AWS_MP_NO)
 #define aws_mp_iseven(a) (((a)->used > 0 && (((a)->dp[0] & 1) == 0)) ? AWS_MP_YES : AWS_MP_NO)
@@ -319,6 +511,14 @@ int aws_mp_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
 /* b = a*a  */
 int aws_mp_sqr(aws_mp_int *a, aws_mp_int *b);
 
+/* replaces all the cutoffs at once, threads multiplying or dividing at the
+ * same time see either the old or the new set, never a mix
+ */
+int aws_mp_set_cutoffs(const aws_mp_cutoffs *c);
+
+/* reads the cutoffs in effect */
+void aws_mp_get_cutoffs(aws_mp_cutoffs *c);
+
 /* a/b => cb + d == a */
 int aws_mp_div(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, aws_mp_int *d);
 
@@ -443,6 +643,54 @@ int aws_mp_reduce_2k_l(aws_mp_int *a, aws_mp_int *n, aws_mp_int *d);
 /* d = a**b (mod c) */
 int aws_mp_exptmod(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, aws_mp_int *d);
 
+/* d = a**b (mod c) in time independent of the bits of b [c odd, 0 <= b] */
+int aws_mp_exptmod_ct(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, aws_mp_int *d);
+
+/* ---> fixed modulus contexts <--- */
+
+/* picks the reduction method for the (positive) modulus b and precomputes its setup values */
+int aws_mp_mod_ctx_init(aws_mp_mod_ctx *ctx, aws_mp_int *b);
+
+/* sets up a context for a specific AWS_MP_REDUCE_* method */
+int aws_mp_mod_ctx_init_mode(aws_mp_mod_ctx *ctx, aws_mp_int *b, int mode);
+
+/* free a context */
+void aws_mp_mod_ctx_clear(aws_mp_mod_ctx *ctx);
+
+/* c = a**b (mod N) */
+int aws_mp_exptmod_ctx(aws_mp_int *a, aws_mp_int *b, aws_mp_mod_ctx *ctx, aws_mp_int *c);
+
+/* b[i] = 1/a[i] (mod N) for 0 <= i < n with a single modular inversion [b may be a] */
+int aws_mp_invmod_batch(aws_mp_int *a, aws_mp_int *b, int n, aws_mp_mod_ctx *ctx);
+
+/* c = a * b (mod N) */
+int aws_mp_mulmod_ctx(aws_mp_int *a, aws_mp_int *b, aws_mp_mod_ctx *ctx, aws_mp_int *c);
+
+/* b = a * a (mod N) */
+int aws_mp_sqrmod_ctx(aws_mp_int *a, aws_mp_mod_ctx *ctx, aws_mp_int *b);
+
+/* precomputes a comb of 2**teeth entries for g**e (mod N) with 0 <= e < 2**bits */
+int aws_mp_comb_init(aws_mp_comb *comb, aws_mp_int *g, aws_mp_mod_ctx *ctx, int bits, int teeth);
+
+/* free a comb */
+void aws_mp_comb_clear(aws_mp_comb *comb);
+
+/* c = g**b (mod N) using the comb [exponents it doesn't cover fall back to aws_mp_exptmod_ctx] */
+int aws_mp_exptmod_comb(aws_mp_comb *comb, aws_mp_int *b, aws_mp_int *c);
+
+/* constant time versions of the above for secret exponents [Montgomery contexts only] */
+int aws_mp_exptmod_ctx_ct(aws_mp_int *a, aws_mp_int *b, aws_mp_mod_ctx *ctx, aws_mp_int *c);
+int aws_mp_exptmod_comb_ct(aws_mp_comb *comb, aws_mp_int *b, aws_mp_int *c);
+
+/* c = a[0]**b[0] * ... * a[n-1]**b[n-1] (mod N) with shared squarings, constant time like the above */
+int aws_mp_exptmod_multi(aws_mp_int *a, aws_mp_int *b, int n, aws_mp_mod_ctx *ctx, aws_mp_int *c);
+
+/* c[i] = a[i]**b[i] (mod N) for 0 <= i < n, spread over "threads" threads [<= 0 for one per core] */
+int aws_mp_exptmod_batch(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int n, aws_mp_mod_ctx *ctx, int threads);
+
+/* the same for secret exponents, constant time per item [Montgomery contexts only] */
+int aws_mp_exptmod_batch_ct(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int n, aws_mp_mod_ctx *ctx, int threads);
+
 /* ---> Primes <--- */
 
 /* number of primes */
@@ -489,6 +737,11 @@ int aws_mp_prime_is_prime(aws_mp_int *a, int t, int *result);
  */
 int aws_mp_prime_next_prime(aws_mp_int *a, int t, int bbs_style);
 
+/* the same with the Miller-Rabin tests spread over "threads" threads [<= 0 for one per core],
+ * the prime found is the same whatever the number
+ */
+int aws_mp_prime_next_prime_mt(aws_mp_int *a, int t, int bbs_style, int threads);
+
 /* makes a truly random prime of a given size (bytes),
  * call with bbs = 1 if you want it to be congruent to 3 mod 4 
  *
@@ -516,6 +769,10 @@ int aws_mp_prime_next_prime(aws_mp_int *a, int t, int bbs_style);
  */
 int aws_mp_prime_random_ex(aws_mp_int *a, int t, int size, int flags, aws_ltm_prime_callback cb, void *dat);
 
+/* the same with the Miller-Rabin tests spread over "threads" threads [<= 0 for one per core] */
+int aws_mp_prime_random_ex_mt(aws_mp_int *a, int t, int size, int flags, int threads, aws_ltm_prime_callback cb,
+                              void *dat);
+
 /* ---> radix conversion <--- */
 int aws_mp_count_bits(aws_mp_int *a);
 
@@ -529,6 +786,18 @@ int aws_mp_read_signed_bin(aws_mp_int *a, const unsigned char *b, int c);
 int aws_mp_to_signed_bin(aws_mp_int *a, unsigned char *b);
 int aws_mp_to_signed_bin_n(aws_mp_int *a, unsigned char *b, unsigned long *outlen);
 
+/* the same formats handed to "cb" a piece at a time [at most AWS_MP_BIN_CHUNK
+ * bytes, most significant first] instead of stored, e.g. straight into a hash.
+ * A result other than AWS_MP_OKAY from cb stops the output and is returned.
+ */
+#ifndef AWS_MP_BIN_CHUNK
+   #define AWS_MP_BIN_CHUNK 64
+#endif
+typedef int aws_ltm_bin_callback(const unsigned char *src, unsigned long len, void *dat);
+
+int aws_mp_to_unsigned_bin_stream(aws_mp_int *a, aws_ltm_bin_callback cb, void *dat);
+int aws_mp_to_signed_bin_stream(aws_mp_int *a, aws_ltm_bin_callback cb, void *dat);
+
 int aws_mp_read_radix(aws_mp_int *a, const char *str, int radix);
 int aws_mp_toradix(aws_mp_int *a, char *str, int radix);
 int aws_mp_toradix_n(aws_mp_int *a, char *str, int radix, int maxlen);
@@ -563,12 +832,41 @@ int aws_mp_karatsuba_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
 int aws_mp_toom_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
 int aws_mp_karatsuba_sqr(aws_mp_int *a, aws_mp_int *b);
 int aws_mp_toom_sqr(aws_mp_int *a, aws_mp_int *b);
+int aws_mp_ntt_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
+int aws_mp_ntt_sqr(aws_mp_int *a, aws_mp_int *b);
 int aws_fast_mp_invmod(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
 int aws_mp_invmod_slow(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
 int aws_fast_mp_montgomery_reduce(aws_mp_int *a, aws_mp_int *m, aws_mp_digit mp);
+int aws_fast_mp_montgomery_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *m, aws_mp_digit mp, aws_mp_int *c);
+int aws_fast_mp_montgomery_sqr(aws_mp_int *a, aws_mp_int *m, aws_mp_digit mp, aws_mp_int *b);
+int aws_fast_mp_montgomery_mul_ct(aws_mp_int *a, aws_mp_int *b, aws_mp_int *m, aws_mp_digit mp, aws_mp_int *c);
+int aws_fast_mp_montgomery_sqr_ct(aws_mp_int *a, aws_mp_int *m, aws_mp_digit mp, aws_mp_int *b);
 int aws_mp_exptmod_fast(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int *Y, int mode);
 int aws_s_mp_exptmod(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int *Y, int mode);
+int aws_mp_mod_ctx_reduce(aws_mp_int *a, aws_mp_mod_ctx *ctx);
+int aws_mp_mod_ctx_to(aws_mp_int *a, aws_mp_mod_ctx *ctx, aws_mp_int *b);
+int aws_mp_mod_ctx_from(aws_mp_int *a, aws_mp_mod_ctx *ctx);
+int aws_mp_mod_ctx_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_mod_ctx *ctx, aws_mp_int *c);
+int aws_mp_mod_ctx_sqr(aws_mp_int *a, aws_mp_mod_ctx *ctx, aws_mp_int *b);
 void aws_bn_reverse(unsigned char *s, int len);
+int aws_s_mp_gcd_lehmer(aws_mp_int *a, aws_mp_int *b, aws_mp_int *g, aws_mp_int *U);
+int aws_s_mp_div_recursive(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, aws_mp_int *d);
+int aws_s_mp_montgomery_fixed(aws_mp_int *a, aws_mp_int *b, aws_mp_int *m, aws_mp_digit mp, aws_mp_int *c, int ct);
+int aws_s_mp_montgomery_fixed_reduce(aws_mp_int *x, aws_mp_int *n, aws_mp_digit rho);
+int aws_s_mp_ntt(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
+int aws_s_mp_comba_simd(aws_mp_int *a, aws_mp_int *b, int lo, int hi, aws_mp_digit *W);
+int aws_s_mp_prime_search(aws_mp_int *a, int t, int flags, int windows, int threads, int *result);
+typedef struct aws_s_mp_pool aws_s_mp_pool;
+int aws_s_mp_pool_run(void (*job)(aws_s_mp_pool *, void *), void *arg, int threads, int limit);
+void aws_s_mp_pool_lock(aws_s_mp_pool *pool);
+void aws_s_mp_pool_unlock(aws_s_mp_pool *pool);
+void aws_s_mp_pool_fail(aws_s_mp_pool *pool, int err);
+int aws_s_mp_pool_failed(aws_s_mp_pool *pool);
+int aws_s_mp_radix_pow2(int radix);
+int aws_s_mp_toradix_pow2(aws_mp_int *a, char *str, int radix, int limit);
+int aws_s_mp_read_radix_pow2(aws_mp_int *a, const char *str, int radix);
+int aws_s_mp_toradix_dc(aws_mp_int *a, char *str, int radix, int *len);
+int aws_s_mp_read_radix_dc(aws_mp_int *a, const char *str, int radix);
 
 extern const char *aws_mp_s_rmap;
 
@@ -10,6 +10,7 @@
 #if defined(AWS_LTM_ALL)
 #define AWS_BN_ERROR_C
 #define AWS_BN_FAST_MP_INVMOD_C
+#define AWS_BN_FAST_MP_MONTGOMERY_MUL_C
 #define AWS_BN_FAST_MP_MONTGOMERY_REDUCE_C
 #define AWS_BN_FAST_S_MP_MUL_DIGS_C
 #define AWS_BN_FAST_S_MP_MUL_HIGH_DIGS_C
@@ -40,6 +41,10 @@
 #define AWS_BN_MP_EXCH_C
 #define AWS_BN_MP_EXPT_D_C
 #define AWS_BN_MP_EXPTMOD_C
+#define AWS_BN_MP_EXPTMOD_BATCH_C
+#define AWS_BN_MP_EXPTMOD_COMB_C
+#define AWS_BN_MP_EXPTMOD_CT_C
+#define AWS_BN_MP_EXPTMOD_CTX_C
 #define AWS_BN_MP_EXPTMOD_FAST_C
 #define AWS_BN_MP_EXTEUCLID_C
 #define AWS_BN_MP_FREAD_C
@@ -54,6 +59,7 @@
 #define AWS_BN_MP_INIT_SET_INT_C
 #define AWS_BN_MP_INIT_SIZE_C
 #define AWS_BN_MP_INVMOD_C
+#define AWS_BN_MP_INVMOD_BATCH_C
 #define AWS_BN_MP_INVMOD_SLOW_C
 #define AWS_BN_MP_IS_SQUARE_C
 #define AWS_BN_MP_JACOBI_C
@@ -63,6 +69,7 @@
 #define AWS_BN_MP_LSHD_C
 #define AWS_BN_MP_MOD_C
 #define AWS_BN_MP_MOD_2D_C
+#define AWS_BN_MP_MOD_CTX_C
 #define AWS_BN_MP_MOD_D_C
 #define AWS_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C
 #define AWS_BN_MP_MONTGOMERY_REDUCE_C
@@ -74,6 +81,8 @@
 #define AWS_BN_MP_MULMOD_C
 #define AWS_BN_MP_N_ROOT_C
 #define AWS_BN_MP_NEG_C
+#define AWS_BN_MP_NTT_MUL_C
+#define AWS_BN_MP_NTT_SQR_C
 #define AWS_BN_MP_OR_C
 #define AWS_BN_MP_PRIME_FERMAT_C
 #define AWS_BN_MP_PRIME_IS_DIVISIBLE_C
@@ -97,6 +106,7 @@
 #define AWS_BN_MP_REDUCE_IS_2K_L_C
 #define AWS_BN_MP_REDUCE_SETUP_C
 #define AWS_BN_MP_RSHD_C
+#define AWS_BN_MP_SCRATCH_C
 #define AWS_BN_MP_SET_C
 #define AWS_BN_MP_SET_INT_C
 #define AWS_BN_MP_SHRINK_C
@@ -109,8 +119,10 @@
 #define AWS_BN_MP_SUBMOD_C
 #define AWS_BN_MP_TO_SIGNED_BIN_C
 #define AWS_BN_MP_TO_SIGNED_BIN_N_C
+#define AWS_BN_MP_TO_SIGNED_BIN_STREAM_C
 #define AWS_BN_MP_TO_UNSIGNED_BIN_C
 #define AWS_BN_MP_TO_UNSIGNED_BIN_N_C
+#define AWS_BN_MP_TO_UNSIGNED_BIN_STREAM_C
 #define AWS_BN_MP_TOOM_MUL_C
 #define AWS_BN_MP_TOOM_SQR_C
 #define AWS_BN_MP_TORADIX_C
@@ -121,9 +133,18 @@
 #define AWS_BN_PRIME_TAB_C
 #define AWS_BN_REVERSE_C
 #define AWS_BN_S_MP_ADD_C
+#define AWS_BN_S_MP_COMBA_SIMD_C
+#define AWS_BN_S_MP_DIV_RECURSIVE_C
 #define AWS_BN_S_MP_EXPTMOD_C
+#define AWS_BN_S_MP_GCD_LEHMER_C
+#define AWS_BN_S_MP_MONTGOMERY_FIXED_C
 #define AWS_BN_S_MP_MUL_DIGS_C
 #define AWS_BN_S_MP_MUL_HIGH_DIGS_C
+#define AWS_BN_S_MP_NTT_C
+#define AWS_BN_S_MP_POOL_C
+#define AWS_BN_S_MP_PRIME_SEARCH_C
+#define AWS_BN_S_MP_RADIX_DC_C
+#define AWS_BN_S_MP_RADIX_POW2_C
 #define AWS_BN_S_MP_SQR_C
 #define AWS_BN_S_MP_SUB_C
 #define AWS_BNCORE_C
@@ -150,27 +171,39 @@
    #define AWS_BN_MP_CLEAR_MULTI_C
 #endif
 
+#if defined(AWS_BN_FAST_MP_MONTGOMERY_MUL_C)
+   #define AWS_BN_MP_GROW_C
+   #define AWS_BN_MP_CLAMP_C
+   #define AWS_BN_MP_CMP_MAG_C
+   #define AWS_BN_S_MP_SUB_C
+   #define AWS_BN_S_MP_MONTGOMERY_FIXED_C
+#endif
+
 #if defined(AWS_BN_FAST_MP_MONTGOMERY_REDUCE_C)
    #define AWS_BN_MP_GROW_C
    #define AWS_BN_MP_RSHD_C
    #define AWS_BN_MP_CLAMP_C
    #define AWS_BN_MP_CMP_MAG_C
    #define AWS_BN_S_MP_SUB_C
+   #define AWS_BN_S_MP_MONTGOMERY_FIXED_C
 #endif
 
 #if defined(AWS_BN_FAST_S_MP_MUL_DIGS_C)
    #define AWS_BN_MP_GROW_C
    #define AWS_BN_MP_CLAMP_C
+   #define AWS_BN_S_MP_COMBA_SIMD_C
 #endif
 
 #if defined(AWS_BN_FAST_S_MP_MUL_HIGH_DIGS_C)
    #define AWS_BN_MP_GROW_C
    #define AWS_BN_MP_CLAMP_C
+   #define AWS_BN_S_MP_COMBA_SIMD_C
 #endif
 
 #if defined(AWS_BN_FAST_S_MP_SQR_C)
    #define AWS_BN_MP_GROW_C
    #define AWS_BN_MP_CLAMP_C
+   #define AWS_BN_S_MP_COMBA_SIMD_C
 #endif
 
 #if defined(AWS_BN_MP_2EXPT_C)
@@ -240,6 +273,8 @@
 #endif
 
 #if defined(AWS_BN_MP_DIV_C)
+   #define AWS_BN_S_MP_DIV_RECURSIVE_C
+   #define AWS_BN_MP_SCRATCH_C
    #define AWS_BN_MP_ISZERO_C
    #define AWS_BN_MP_CMP_MAG_C
    #define AWS_BN_MP_COPY_C
@@ -324,41 +359,75 @@
 #endif
 
 #if defined(AWS_BN_MP_EXPTMOD_C)
+   #define AWS_BN_MP_MOD_CTX_C
+   #define AWS_BN_MP_EXPTMOD_CTX_C
+#endif
+
+#if defined(AWS_BN_MP_EXPTMOD_BATCH_C)
+   #define AWS_BN_MP_EXPTMOD_CTX_C
+   #define AWS_BN_MP_EXPTMOD_CT_C
+   #define AWS_BN_S_MP_POOL_C
+#endif
+
+#if defined(AWS_BN_MP_EXPTMOD_COMB_C)
+   #define AWS_BN_MP_SCRATCH_C
+   #define AWS_BN_MP_MOD_CTX_C
+   #define AWS_BN_MP_EXPTMOD_CTX_C
    #define AWS_BN_MP_INIT_C
-   #define AWS_BN_MP_INVMOD_C
+   #define AWS_BN_MP_INIT_COPY_C
    #define AWS_BN_MP_CLEAR_C
-   #define AWS_BN_MP_ABS_C
-   #define AWS_BN_MP_CLEAR_MULTI_C
-   #define AWS_BN_MP_REDUCE_IS_2K_L_C
-   #define AWS_BN_S_MP_EXPTMOD_C
-   #define AWS_BN_MP_DR_IS_MODULUS_C
-   #define AWS_BN_MP_REDUCE_IS_2K_C
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_SET_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_SQR_C
+   #define AWS_BN_MP_MUL_C
+   #define AWS_BN_MP_EXCH_C
+#endif
+
+#if defined(AWS_BN_MP_EXPTMOD_CT_C)
+   #define AWS_BN_MP_SCRATCH_C
+   #define AWS_BN_MP_GROW_C
    #define AWS_BN_MP_ISODD_C
-   #define AWS_BN_MP_EXPTMOD_FAST_C
+   #define AWS_BN_MP_MOD_CTX_C
+   #define AWS_BN_MP_INIT_SIZE_C
+   #define AWS_BN_MP_SET_C
+   #define AWS_BN_FAST_MP_MONTGOMERY_MUL_C
+   #define AWS_BN_MP_CLEAR_C
+   #define AWS_BN_MP_CLAMP_C
+   #define AWS_BN_MP_CMP_MAG_C
+   #define AWS_BN_MP_MOD_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_EXCH_C
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_INIT_COPY_C
 #endif
 
-#if defined(AWS_BN_MP_EXPTMOD_FAST_C)
+#if defined(AWS_BN_MP_EXPTMOD_CTX_C)
+   #define AWS_BN_MP_SCRATCH_C
+   #define AWS_BN_MP_INVMOD_C
+   #define AWS_BN_MP_INIT_MULTI_C
+   #define AWS_BN_MP_ABS_C
+   #define AWS_BN_MP_CLEAR_MULTI_C
    #define AWS_BN_MP_COUNT_BITS_C
    #define AWS_BN_MP_INIT_C
    #define AWS_BN_MP_CLEAR_C
-   #define AWS_BN_MP_MONTGOMERY_SETUP_C
-   #define AWS_BN_FAST_MP_MONTGOMERY_REDUCE_C
-   #define AWS_BN_MP_MONTGOMERY_REDUCE_C
-   #define AWS_BN_MP_DR_SETUP_C
-   #define AWS_BN_MP_DR_REDUCE_C
-   #define AWS_BN_MP_REDUCE_2K_SETUP_C
-   #define AWS_BN_MP_REDUCE_2K_C
-   #define AWS_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C
-   #define AWS_BN_MP_MULMOD_C
+   #define AWS_BN_MP_MOD_CTX_C
    #define AWS_BN_MP_SET_C
-   #define AWS_BN_MP_MOD_C
    #define AWS_BN_MP_COPY_C
    #define AWS_BN_MP_SQR_C
    #define AWS_BN_MP_MUL_C
    #define AWS_BN_MP_EXCH_C
 #endif
 
+#if defined(AWS_BN_MP_EXPTMOD_FAST_C)
+   #define AWS_BN_MP_MOD_CTX_C
+   #define AWS_BN_MP_EXPTMOD_CTX_C
+#endif
+
 #if defined(AWS_BN_MP_EXTEUCLID_C)
+   #define AWS_BN_S_MP_GCD_LEHMER_C
+   #define AWS_BN_MP_NEG_C
+   #define AWS_BN_MP_SCRATCH_C
    #define AWS_BN_MP_INIT_MULTI_C
    #define AWS_BN_MP_SET_C
    #define AWS_BN_MP_COPY_C
@@ -387,6 +456,7 @@
 #if defined(AWS_BN_MP_GCD_C)
    #define AWS_BN_MP_ISZERO_C
    #define AWS_BN_MP_ABS_C
+   #define AWS_BN_S_MP_GCD_LEHMER_C
    #define AWS_BN_MP_ZERO_C
    #define AWS_BN_MP_INIT_COPY_C
    #define AWS_BN_MP_CNT_LSB_C
@@ -433,11 +503,28 @@
 
 #if defined(AWS_BN_MP_INVMOD_C)
    #define AWS_BN_MP_ISZERO_C
+   #define AWS_BN_S_MP_GCD_LEHMER_C
+   #define AWS_BN_MP_INIT_MULTI_C
+   #define AWS_BN_MP_CMP_D_C
+   #define AWS_BN_MP_NEG_C
+   #define AWS_BN_MP_MOD_C
+   #define AWS_BN_MP_CLEAR_MULTI_C
    #define AWS_BN_MP_ISODD_C
    #define AWS_BN_FAST_MP_INVMOD_C
    #define AWS_BN_MP_INVMOD_SLOW_C
 #endif
 
+#if defined(AWS_BN_MP_INVMOD_BATCH_C)
+   #define AWS_BN_MP_SCRATCH_C
+   #define AWS_BN_MP_MOD_CTX_C
+   #define AWS_BN_MP_CMP_MAG_C
+   #define AWS_BN_MP_MOD_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_ISZERO_C
+   #define AWS_BN_MP_INVMOD_C
+   #define AWS_BN_MP_CLEAR_C
+#endif
+
 #if defined(AWS_BN_MP_INVMOD_SLOW_C)
    #define AWS_BN_MP_ISZERO_C
    #define AWS_BN_MP_INIT_MULTI_C
@@ -478,6 +565,7 @@
 #endif
 
 #if defined(AWS_BN_MP_KARATSUBA_MUL_C)
+   #define AWS_BN_MP_SCRATCH_C
    #define AWS_BN_MP_MUL_C
    #define AWS_BN_MP_INIT_SIZE_C
    #define AWS_BN_MP_CLAMP_C
@@ -488,6 +576,7 @@
 #endif
 
 #if defined(AWS_BN_MP_KARATSUBA_SQR_C)
+   #define AWS_BN_MP_SCRATCH_C
    #define AWS_BN_MP_INIT_SIZE_C
    #define AWS_BN_MP_CLAMP_C
    #define AWS_BN_MP_SQR_C
@@ -526,6 +615,36 @@
    #define AWS_BN_MP_CLAMP_C
 #endif
 
+#if defined(AWS_BN_MP_MOD_CTX_C)
+   #define AWS_BN_MP_REDUCE_IS_2K_L_C
+   #define AWS_BN_MP_DR_IS_MODULUS_C
+   #define AWS_BN_MP_REDUCE_IS_2K_C
+   #define AWS_BN_MP_ISODD_C
+   #define AWS_BN_MP_INIT_COPY_C
+   #define AWS_BN_MP_INIT_MULTI_C
+   #define AWS_BN_MP_CLEAR_MULTI_C
+   #define AWS_BN_MP_MONTGOMERY_SETUP_C
+   #define AWS_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C
+   #define AWS_BN_MP_SQRMOD_C
+   #define AWS_BN_MP_DR_SETUP_C
+   #define AWS_BN_MP_REDUCE_2K_SETUP_C
+   #define AWS_BN_MP_REDUCE_SETUP_C
+   #define AWS_BN_MP_REDUCE_2K_SETUP_L_C
+   #define AWS_BN_FAST_MP_MONTGOMERY_REDUCE_C
+   #define AWS_BN_MP_MONTGOMERY_REDUCE_C
+   #define AWS_BN_MP_DR_REDUCE_C
+   #define AWS_BN_MP_REDUCE_2K_C
+   #define AWS_BN_MP_REDUCE_C
+   #define AWS_BN_MP_REDUCE_2K_L_C
+   #define AWS_BN_MP_CMP_MAG_C
+   #define AWS_BN_MP_MOD_C
+   #define AWS_BN_FAST_MP_MONTGOMERY_MUL_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_MUL_C
+   #define AWS_BN_MP_SQR_C
+   #define AWS_BN_MP_EXCH_C
+#endif
+
 #if defined(AWS_BN_MP_MOD_D_C)
    #define AWS_BN_MP_DIV_D_C
 #endif
@@ -602,6 +721,14 @@
    #define AWS_BN_MP_ISZERO_C
 #endif
 
+#if defined(AWS_BN_MP_NTT_MUL_C)
+   #define AWS_BN_S_MP_NTT_C
+#endif
+
+#if defined(AWS_BN_MP_NTT_SQR_C)
+   #define AWS_BN_S_MP_NTT_C
+#endif
+
 #if defined(AWS_BN_MP_OR_C)
    #define AWS_BN_MP_INIT_COPY_C
    #define AWS_BN_MP_CLAMP_C
@@ -647,11 +774,8 @@
    #define AWS_BN_MP_SET_C
    #define AWS_BN_MP_SUB_D_C
    #define AWS_BN_MP_ISEVEN_C
-   #define AWS_BN_MP_MOD_D_C
-   #define AWS_BN_MP_INIT_C
    #define AWS_BN_MP_ADD_D_C
-   #define AWS_BN_MP_PRIME_MILLER_RABIN_C
-   #define AWS_BN_MP_CLEAR_C
+   #define AWS_BN_S_MP_PRIME_SEARCH_C
 #endif
 
 #if defined(AWS_BN_MP_PRIME_RABIN_MILLER_TRIALS_C)
@@ -659,6 +783,9 @@
 
 #if defined(AWS_BN_MP_PRIME_RANDOM_EX_C)
    #define AWS_BN_MP_READ_UNSIGNED_BIN_C
+   #define AWS_BN_MP_CMP_D_C
+   #define AWS_BN_S_MP_PRIME_SEARCH_C
+   #define AWS_BN_MP_COUNT_BITS_C
    #define AWS_BN_MP_PRIME_IS_PRIME_C
    #define AWS_BN_MP_SUB_D_C
    #define AWS_BN_MP_DIV_2_C
@@ -667,11 +794,10 @@
 #endif
 
 #if defined(AWS_BN_MP_RADIX_SIZE_C)
+   #define AWS_BN_S_MP_RADIX_POW2_C
+   #define AWS_BN_S_MP_RADIX_DC_C
    #define AWS_BN_MP_COUNT_BITS_C
-   #define AWS_BN_MP_INIT_COPY_C
    #define AWS_BN_MP_ISZERO_C
-   #define AWS_BN_MP_DIV_D_C
-   #define AWS_BN_MP_CLEAR_C
 #endif
 
 #if defined(AWS_BN_MP_RADIX_SMAP_C)
@@ -685,11 +811,9 @@
 #endif
 
 #if defined(AWS_BN_MP_READ_RADIX_C)
+   #define AWS_BN_S_MP_RADIX_POW2_C
+   #define AWS_BN_S_MP_RADIX_DC_C
    #define AWS_BN_MP_ZERO_C
-   #define AWS_BN_MP_S_RMAP_C
-   #define AWS_BN_MP_RADIX_SMAP_C
-   #define AWS_BN_MP_MUL_D_C
-   #define AWS_BN_MP_ADD_D_C
    #define AWS_BN_MP_ISZERO_C
 #endif
 
@@ -778,6 +902,11 @@
    #define AWS_BN_MP_ZERO_C
 #endif
 
+#if defined(AWS_BN_MP_SCRATCH_C)
+   #define AWS_BN_MP_INIT_SIZE_C
+   #define AWS_BN_MP_CLEAR_C
+#endif
+
 #if defined(AWS_BN_MP_SET_C)
    #define AWS_BN_MP_ZERO_C
 #endif
@@ -851,6 +980,10 @@
    #define AWS_BN_MP_TO_SIGNED_BIN_C
 #endif
 
+#if defined(AWS_BN_MP_TO_SIGNED_BIN_STREAM_C)
+   #define AWS_BN_MP_TO_UNSIGNED_BIN_STREAM_C
+#endif
+
 #if defined(AWS_BN_MP_TO_UNSIGNED_BIN_C)
    #define AWS_BN_MP_INIT_COPY_C
    #define AWS_BN_MP_ISZERO_C
@@ -863,7 +996,12 @@
    #define AWS_BN_MP_TO_UNSIGNED_BIN_C
 #endif
 
+#if defined(AWS_BN_MP_TO_UNSIGNED_BIN_STREAM_C)
+   #define AWS_BN_MP_UNSIGNED_BIN_SIZE_C
+#endif
+
 #if defined(AWS_BN_MP_TOOM_MUL_C)
+   #define AWS_BN_MP_SCRATCH_C
    #define AWS_BN_MP_INIT_MULTI_C
    #define AWS_BN_MP_MOD_2D_C
    #define AWS_BN_MP_COPY_C
@@ -881,6 +1019,7 @@
 #endif
 
 #if defined(AWS_BN_MP_TOOM_SQR_C)
+   #define AWS_BN_MP_SCRATCH_C
    #define AWS_BN_MP_INIT_MULTI_C
    #define AWS_BN_MP_MOD_2D_C
    #define AWS_BN_MP_COPY_C
@@ -898,14 +1037,15 @@
 #endif
 
 #if defined(AWS_BN_MP_TORADIX_C)
+   #define AWS_BN_S_MP_RADIX_POW2_C
+   #define AWS_BN_S_MP_RADIX_DC_C
    #define AWS_BN_MP_ISZERO_C
-   #define AWS_BN_MP_INIT_COPY_C
-   #define AWS_BN_MP_DIV_D_C
-   #define AWS_BN_MP_CLEAR_C
-   #define AWS_BN_MP_S_RMAP_C
 #endif
 
 #if defined(AWS_BN_MP_TORADIX_N_C)
+   #define AWS_BN_S_MP_RADIX_POW2_C
+   #define AWS_BN_S_MP_RADIX_DC_C
+   #define AWS_BN_MP_COUNT_BITS_C
    #define AWS_BN_MP_ISZERO_C
    #define AWS_BN_MP_INIT_COPY_C
    #define AWS_BN_MP_DIV_D_C
@@ -938,20 +1078,70 @@
    #define AWS_BN_MP_CLAMP_C
 #endif
 
-#if defined(AWS_BN_S_MP_EXPTMOD_C)
-   #define AWS_BN_MP_COUNT_BITS_C
-   #define AWS_BN_MP_INIT_C
-   #define AWS_BN_MP_CLEAR_C
-   #define AWS_BN_MP_REDUCE_SETUP_C
-   #define AWS_BN_MP_REDUCE_C
-   #define AWS_BN_MP_REDUCE_2K_SETUP_L_C
-   #define AWS_BN_MP_REDUCE_2K_L_C
-   #define AWS_BN_MP_MOD_C
+#if defined(AWS_BN_S_MP_COMBA_SIMD_C)
+#endif
+
+#if defined(AWS_BN_S_MP_DIV_RECURSIVE_C)
+   #define AWS_BN_MP_SCRATCH_C
+   #define AWS_BN_MP_MOD_2D_C
    #define AWS_BN_MP_COPY_C
-   #define AWS_BN_MP_SQR_C
+   #define AWS_BN_MP_RSHD_C
+   #define AWS_BN_MP_DIV_C
+   #define AWS_BN_MP_LSHD_C
+   #define AWS_BN_MP_ADD_C
    #define AWS_BN_MP_MUL_C
+   #define AWS_BN_MP_SUB_C
+   #define AWS_BN_MP_SUB_D_C
+   #define AWS_BN_MP_CLEAR_MULTI_C
+   #define AWS_BN_MP_MUL_2D_C
+   #define AWS_BN_MP_DIV_2D_C
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_ISZERO_C
+#endif
+
+#if defined(AWS_BN_S_MP_EXPTMOD_C)
+   #define AWS_BN_MP_MOD_CTX_C
+   #define AWS_BN_MP_EXPTMOD_CTX_C
+#endif
+
+#if defined(AWS_BN_S_MP_GCD_LEHMER_C)
+   #define AWS_BN_MP_SCRATCH_C
+   #define AWS_BN_MP_CMP_MAG_C
+   #define AWS_BN_MP_ABS_C
    #define AWS_BN_MP_SET_C
+   #define AWS_BN_MP_ISZERO_C
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_DIV_C
    #define AWS_BN_MP_EXCH_C
+   #define AWS_BN_MP_MUL_C
+   #define AWS_BN_MP_ADD_C
+   #define AWS_BN_MP_GROW_C
+   #define AWS_BN_MP_CLAMP_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_CLEAR_MULTI_C
+#endif
+
+#if defined(AWS_BN_S_MP_MONTGOMERY_FIXED_C)
+   #define AWS_BN_MP_GROW_C
+   #define AWS_BN_MP_CLAMP_C
+   #define AWS_BN_MP_CMP_MAG_C
+   #define AWS_BN_S_MP_SUB_C
+#endif
+
+#if defined(AWS_BN_S_MP_POOL_C)
+   #define AWS_BN_MP_SCRATCH_C
+#endif
+
+#if defined(AWS_BN_S_MP_PRIME_SEARCH_C)
+   #define AWS_BN_MP_ADD_D_C
+   #define AWS_BN_MP_DIV_2_C
+   #define AWS_BN_MP_SET_C
+   #define AWS_BN_MP_PRIME_MILLER_RABIN_C
+   #define AWS_BN_MP_INIT_MULTI_C
+   #define AWS_BN_MP_CLEAR_MULTI_C
+   #define AWS_BN_S_MP_POOL_C
+   #define AWS_BN_MP_MOD_D_C
+   #define AWS_BN_PRIME_TAB_C
 #endif
 
 #if defined(AWS_BN_S_MP_MUL_DIGS_C)
@@ -970,6 +1160,39 @@
    #define AWS_BN_MP_CLEAR_C
 #endif
 
+#if defined(AWS_BN_S_MP_NTT_C)
+   #define AWS_BN_MP_ZERO_C
+   #define AWS_BN_MP_GROW_C
+   #define AWS_BN_MP_CLAMP_C
+#endif
+
+#if defined(AWS_BN_S_MP_RADIX_DC_C)
+   #define AWS_BN_MP_INIT_C
+   #define AWS_BN_MP_SET_C
+   #define AWS_BN_MP_SQR_C
+   #define AWS_BN_MP_CLEAR_C
+   #define AWS_BN_MP_INIT_COPY_C
+   #define AWS_BN_MP_ISZERO_C
+   #define AWS_BN_MP_DIV_D_C
+   #define AWS_BN_MP_S_RMAP_C
+   #define AWS_BN_REVERSE_C
+   #define AWS_BN_MP_CMP_MAG_C
+   #define AWS_BN_MP_SCRATCH_C
+   #define AWS_BN_MP_DIV_C
+   #define AWS_BN_MP_ZERO_C
+   #define AWS_BN_MP_MUL_D_C
+   #define AWS_BN_MP_ADD_D_C
+   #define AWS_BN_MP_MUL_C
+   #define AWS_BN_MP_ADD_C
+#endif
+
+#if defined(AWS_BN_S_MP_RADIX_POW2_C)
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_ZERO_C
+   #define AWS_BN_MP_GROW_C
+   #define AWS_BN_MP_CLAMP_C
+#endif
+
 #if defined(AWS_BN_S_MP_SQR_C)
    #define AWS_BN_MP_INIT_SIZE_C
    #define AWS_BN_MP_CLAMP_C
@@ -0,0 +1,1189 @@
+/* Montgomery kernels for 3072-bit moduli, written by tools/tommath/fixed.c -- do not edit
+ *
+ *    cd tools/tommath && make fixed && ./fixed 3072 $LTM/aws_tommath_fixed.h
+ *
+ * Only the section for the AWS_DIGIT_BIT the library is built with is used,
+ * and only when AWS_MP_FIXED_BITS is 3072.  It defines AWS_MP_FIXED_DIGS, the
+ * digit count of the moduli the kernels are for.
+ */
+
+#if AWS_MP_FIXED_BITS == 3072 && AWS_DIGIT_BIT == 60
+
+#define AWS_MP_FIXED_DIGS 52
+
+/* W = abR**-1 (mod m) as 52 uncarried columns, see s_mp_montgomery_mul_cols */
+static void s_mp_fixed_mul_cols(const aws_mp_digit *a, const aws_mp_digit *b, const aws_mp_digit *m,
+                                aws_mp_digit mp, aws_mp_word *W)
+{
+  int ix;
+  register aws_mp_digit bi, mu;
+  register aws_mp_word  r;
+
+  for (ix = 0; ix < 52; ix++) {
+    W[ix] = 0;
+  }
+
+  /* the top column only ever holds zero and is not touched */
+  for (ix = 0; ix < 52; ix++) {
+    bi = b[ix];
+    r  = W[0] + ((aws_mp_word)bi) * ((aws_mp_word)a[0]);
+    mu = (aws_mp_digit)(((r & ((aws_mp_word)AWS_MP_MASK)) * ((aws_mp_word)mp)) & ((aws_mp_word)AWS_MP_MASK));
+    r  = (r + ((aws_mp_word)mu) * ((aws_mp_word)m[0])) >> ((aws_mp_word)AWS_DIGIT_BIT);
+    W[0] = W[1] + ((aws_mp_word)bi) * ((aws_mp_word)a[1]) + ((aws_mp_word)mu) * ((aws_mp_word)m[1]);
+    W[1] = W[2] + ((aws_mp_word)bi) * ((aws_mp_word)a[2]) + ((aws_mp_word)mu) * ((aws_mp_word)m[2]);
+    W[2] = W[3] + ((aws_mp_word)bi) * ((aws_mp_word)a[3]) + ((aws_mp_word)mu) * ((aws_mp_word)m[3]);
+    W[3] = W[4] + ((aws_mp_word)bi) * ((aws_mp_word)a[4]) + ((aws_mp_word)mu) * ((aws_mp_word)m[4]);
+    W[4] = W[5] + ((aws_mp_word)bi) * ((aws_mp_word)a[5]) + ((aws_mp_word)mu) * ((aws_mp_word)m[5]);
+    W[5] = W[6] + ((aws_mp_word)bi) * ((aws_mp_word)a[6]) + ((aws_mp_word)mu) * ((aws_mp_word)m[6]);
+    W[6] = W[7] + ((aws_mp_word)bi) * ((aws_mp_word)a[7]) + ((aws_mp_word)mu) * ((aws_mp_word)m[7]);
+    W[7] = W[8] + ((aws_mp_word)bi) * ((aws_mp_word)a[8]) + ((aws_mp_word)mu) * ((aws_mp_word)m[8]);
+    W[8] = W[9] + ((aws_mp_word)bi) * ((aws_mp_word)a[9]) + ((aws_mp_word)mu) * ((aws_mp_word)m[9]);
+    W[9] = W[10] + ((aws_mp_word)bi) * ((aws_mp_word)a[10]) + ((aws_mp_word)mu) * ((aws_mp_word)m[10]);
+    W[10] = W[11] + ((aws_mp_word)bi) * ((aws_mp_word)a[11]) + ((aws_mp_word)mu) * ((aws_mp_word)m[11]);
+    W[11] = W[12] + ((aws_mp_word)bi) * ((aws_mp_word)a[12]) + ((aws_mp_word)mu) * ((aws_mp_word)m[12]);
+    W[12] = W[13] + ((aws_mp_word)bi) * ((aws_mp_word)a[13]) + ((aws_mp_word)mu) * ((aws_mp_word)m[13]);
+    W[13] = W[14] + ((aws_mp_word)bi) * ((aws_mp_word)a[14]) + ((aws_mp_word)mu) * ((aws_mp_word)m[14]);
+    W[14] = W[15] + ((aws_mp_word)bi) * ((aws_mp_word)a[15]) + ((aws_mp_word)mu) * ((aws_mp_word)m[15]);
+    W[15] = W[16] + ((aws_mp_word)bi) * ((aws_mp_word)a[16]) + ((aws_mp_word)mu) * ((aws_mp_word)m[16]);
+    W[16] = W[17] + ((aws_mp_word)bi) * ((aws_mp_word)a[17]) + ((aws_mp_word)mu) * ((aws_mp_word)m[17]);
+    W[17] = W[18] + ((aws_mp_word)bi) * ((aws_mp_word)a[18]) + ((aws_mp_word)mu) * ((aws_mp_word)m[18]);
+    W[18] = W[19] + ((aws_mp_word)bi) * ((aws_mp_word)a[19]) + ((aws_mp_word)mu) * ((aws_mp_word)m[19]);
+    W[19] = W[20] + ((aws_mp_word)bi) * ((aws_mp_word)a[20]) + ((aws_mp_word)mu) * ((aws_mp_word)m[20]);
+    W[20] = W[21] + ((aws_mp_word)bi) * ((aws_mp_word)a[21]) + ((aws_mp_word)mu) * ((aws_mp_word)m[21]);
+    W[21] = W[22] + ((aws_mp_word)bi) * ((aws_mp_word)a[22]) + ((aws_mp_word)mu) * ((aws_mp_word)m[22]);
+    W[22] = W[23] + ((aws_mp_word)bi) * ((aws_mp_word)a[23]) + ((aws_mp_word)mu) * ((aws_mp_word)m[23]);
+    W[23] = W[24] + ((aws_mp_word)bi) * ((aws_mp_word)a[24]) + ((aws_mp_word)mu) * ((aws_mp_word)m[24]);
+    W[24] = W[25] + ((aws_mp_word)bi) * ((aws_mp_word)a[25]) + ((aws_mp_word)mu) * ((aws_mp_word)m[25]);
+    W[25] = W[26] + ((aws_mp_word)bi) * ((aws_mp_word)a[26]) + ((aws_mp_word)mu) * ((aws_mp_word)m[26]);
+    W[26] = W[27] + ((aws_mp_word)bi) * ((aws_mp_word)a[27]) + ((aws_mp_word)mu) * ((aws_mp_word)m[27]);
+    W[27] = W[28] + ((aws_mp_word)bi) * ((aws_mp_word)a[28]) + ((aws_mp_word)mu) * ((aws_mp_word)m[28]);
+    W[28] = W[29] + ((aws_mp_word)bi) * ((aws_mp_word)a[29]) + ((aws_mp_word)mu) * ((aws_mp_word)m[29]);
+    W[29] = W[30] + ((aws_mp_word)bi) * ((aws_mp_word)a[30]) + ((aws_mp_word)mu) * ((aws_mp_word)m[30]);
+    W[30] = W[31] + ((aws_mp_word)bi) * ((aws_mp_word)a[31]) + ((aws_mp_word)mu) * ((aws_mp_word)m[31]);
+    W[31] = W[32] + ((aws_mp_word)bi) * ((aws_mp_word)a[32]) + ((aws_mp_word)mu) * ((aws_mp_word)m[32]);
+    W[32] = W[33] + ((aws_mp_word)bi) * ((aws_mp_word)a[33]) + ((aws_mp_word)mu) * ((aws_mp_word)m[33]);
+    W[33] = W[34] + ((aws_mp_word)bi) * ((aws_mp_word)a[34]) + ((aws_mp_word)mu) * ((aws_mp_word)m[34]);
+    W[34] = W[35] + ((aws_mp_word)bi) * ((aws_mp_word)a[35]) + ((aws_mp_word)mu) * ((aws_mp_word)m[35]);
+    W[35] = W[36] + ((aws_mp_word)bi) * ((aws_mp_word)a[36]) + ((aws_mp_word)mu) * ((aws_mp_word)m[36]);
+    W[36] = W[37] + ((aws_mp_word)bi) * ((aws_mp_word)a[37]) + ((aws_mp_word)mu) * ((aws_mp_word)m[37]);
+    W[37] = W[38] + ((aws_mp_word)bi) * ((aws_mp_word)a[38]) + ((aws_mp_word)mu) * ((aws_mp_word)m[38]);
+    W[38] = W[39] + ((aws_mp_word)bi) * ((aws_mp_word)a[39]) + ((aws_mp_word)mu) * ((aws_mp_word)m[39]);
+    W[39] = W[40] + ((aws_mp_word)bi) * ((aws_mp_word)a[40]) + ((aws_mp_word)mu) * ((aws_mp_word)m[40]);
+    W[40] = W[41] + ((aws_mp_word)bi) * ((aws_mp_word)a[41]) + ((aws_mp_word)mu) * ((aws_mp_word)m[41]);
+    W[41] = W[42] + ((aws_mp_word)bi) * ((aws_mp_word)a[42]) + ((aws_mp_word)mu) * ((aws_mp_word)m[42]);
+    W[42] = W[43] + ((aws_mp_word)bi) * ((aws_mp_word)a[43]) + ((aws_mp_word)mu) * ((aws_mp_word)m[43]);
+    W[43] = W[44] + ((aws_mp_word)bi) * ((aws_mp_word)a[44]) + ((aws_mp_word)mu) * ((aws_mp_word)m[44]);
+    W[44] = W[45] + ((aws_mp_word)bi) * ((aws_mp_word)a[45]) + ((aws_mp_word)mu) * ((aws_mp_word)m[45]);
+    W[45] = W[46] + ((aws_mp_word)bi) * ((aws_mp_word)a[46]) + ((aws_mp_word)mu) * ((aws_mp_word)m[46]);
+    W[46] = W[47] + ((aws_mp_word)bi) * ((aws_mp_word)a[47]) + ((aws_mp_word)mu) * ((aws_mp_word)m[47]);
+    W[47] = W[48] + ((aws_mp_word)bi) * ((aws_mp_word)a[48]) + ((aws_mp_word)mu) * ((aws_mp_word)m[48]);
+    W[48] = W[49] + ((aws_mp_word)bi) * ((aws_mp_word)a[49]) + ((aws_mp_word)mu) * ((aws_mp_word)m[49]);
+    W[49] = W[50] + ((aws_mp_word)bi) * ((aws_mp_word)a[50]) + ((aws_mp_word)mu) * ((aws_mp_word)m[50]);
+    W[50] = ((aws_mp_word)bi) * ((aws_mp_word)a[51]) + ((aws_mp_word)mu) * ((aws_mp_word)m[51]);
+    W[0] += r;
+  }
+}
+
+/* W = aaR**-1 (mod m) as 52 uncarried columns, see s_mp_montgomery_sqr_cols
+ *
+ * The columns below ix only see the reduction, the square of a[ix] and its
+ * doubled products with the digits above start at column ix, so the row is
+ * entered there.
+ */
+static void s_mp_fixed_sqr_cols(const aws_mp_digit *a, const aws_mp_digit *m, aws_mp_digit mp, aws_mp_word *W)
+{
+  int ix, iy;
+  register aws_mp_digit ai, mu;
+  register aws_mp_word  r;
+  aws_mp_digit a2[52];
+
+  /* a digit and its double both fit an aws_mp_digit, so 2a[iy] is taken once */
+  for (ix = 0; ix < 52; ix++) {
+    W[ix]  = 0;
+    a2[ix] = a[ix] << 1;
+  }
+
+  for (ix = 0; ix < 52; ix++) {
+    ai = a[ix];
+    r  = W[0];
+    if (ix == 0) {
+      r += ((aws_mp_word)ai) * ((aws_mp_word)ai);
+    }
+    mu = (aws_mp_digit)(((r & ((aws_mp_word)AWS_MP_MASK)) * ((aws_mp_word)mp)) & ((aws_mp_word)AWS_MP_MASK));
+    r  = (r + ((aws_mp_word)mu) * ((aws_mp_word)m[0])) >> ((aws_mp_word)AWS_DIGIT_BIT);
+
+    for (iy = 1; iy < ix; iy++) {
+      W[iy - 1] = W[iy] + ((aws_mp_word)mu) * ((aws_mp_word)m[iy]);
+    }
+    if (ix > 0) {
+      W[ix - 1] = W[ix] + ((aws_mp_word)ai) * ((aws_mp_word)ai) + ((aws_mp_word)mu) * ((aws_mp_word)m[ix]);
+    }
+
+    switch (ix) {
+    case 0: W[0] = W[1] + ((aws_mp_word)ai) * ((aws_mp_word)a2[1]) + ((aws_mp_word)mu) * ((aws_mp_word)m[1]); /* fall through */
+    case 1: W[1] = W[2] + ((aws_mp_word)ai) * ((aws_mp_word)a2[2]) + ((aws_mp_word)mu) * ((aws_mp_word)m[2]); /* fall through */
+    case 2: W[2] = W[3] + ((aws_mp_word)ai) * ((aws_mp_word)a2[3]) + ((aws_mp_word)mu) * ((aws_mp_word)m[3]); /* fall through */
+    case 3: W[3] = W[4] + ((aws_mp_word)ai) * ((aws_mp_word)a2[4]) + ((aws_mp_word)mu) * ((aws_mp_word)m[4]); /* fall through */
+    case 4: W[4] = W[5] + ((aws_mp_word)ai) * ((aws_mp_word)a2[5]) + ((aws_mp_word)mu) * ((aws_mp_word)m[5]); /* fall through */
+    case 5: W[5] = W[6] + ((aws_mp_word)ai) * ((aws_mp_word)a2[6]) + ((aws_mp_word)mu) * ((aws_mp_word)m[6]); /* fall through */
+    case 6: W[6] = W[7] + ((aws_mp_word)ai) * ((aws_mp_word)a2[7]) + ((aws_mp_word)mu) * ((aws_mp_word)m[7]); /* fall through */
+    case 7: W[7] = W[8] + ((aws_mp_word)ai) * ((aws_mp_word)a2[8]) + ((aws_mp_word)mu) * ((aws_mp_word)m[8]); /* fall through */
+    case 8: W[8] = W[9] + ((aws_mp_word)ai) * ((aws_mp_word)a2[9]) + ((aws_mp_word)mu) * ((aws_mp_word)m[9]); /* fall through */
+    case 9: W[9] = W[10] + ((aws_mp_word)ai) * ((aws_mp_word)a2[10]) + ((aws_mp_word)mu) * ((aws_mp_word)m[10]); /* fall through */
+    case 10: W[10] = W[11] + ((aws_mp_word)ai) * ((aws_mp_word)a2[11]) + ((aws_mp_word)mu) * ((aws_mp_word)m[11]); /* fall through */
+    case 11: W[11] = W[12] + ((aws_mp_word)ai) * ((aws_mp_word)a2[12]) + ((aws_mp_word)mu) * ((aws_mp_word)m[12]); /* fall through */
+    case 12: W[12] = W[13] + ((aws_mp_word)ai) * ((aws_mp_word)a2[13]) + ((aws_mp_word)mu) * ((aws_mp_word)m[13]); /* fall through */
+    case 13: W[13] = W[14] + ((aws_mp_word)ai) * ((aws_mp_word)a2[14]) + ((aws_mp_word)mu) * ((aws_mp_word)m[14]); /* fall through */
+    case 14: W[14] = W[15] + ((aws_mp_word)ai) * ((aws_mp_word)a2[15]) + ((aws_mp_word)mu) * ((aws_mp_word)m[15]); /* fall through */
+    case 15: W[15] = W[16] + ((aws_mp_word)ai) * ((aws_mp_word)a2[16]) + ((aws_mp_word)mu) * ((aws_mp_word)m[16]); /* fall through */
+    case 16: W[16] = W[17] + ((aws_mp_word)ai) * ((aws_mp_word)a2[17]) + ((aws_mp_word)mu) * ((aws_mp_word)m[17]); /* fall through */
+    case 17: W[17] = W[18] + ((aws_mp_word)ai) * ((aws_mp_word)a2[18]) + ((aws_mp_word)mu) * ((aws_mp_word)m[18]); /* fall through */
+    case 18: W[18] = W[19] + ((aws_mp_word)ai) * ((aws_mp_word)a2[19]) + ((aws_mp_word)mu) * ((aws_mp_word)m[19]); /* fall through */
+    case 19: W[19] = W[20] + ((aws_mp_word)ai) * ((aws_mp_word)a2[20]) + ((aws_mp_word)mu) * ((aws_mp_word)m[20]); /* fall through */
+    case 20: W[20] = W[21] + ((aws_mp_word)ai) * ((aws_mp_word)a2[21]) + ((aws_mp_word)mu) * ((aws_mp_word)m[21]); /* fall through */
+    case 21: W[21] = W[22] + ((aws_mp_word)ai) * ((aws_mp_word)a2[22]) + ((aws_mp_word)mu) * ((aws_mp_word)m[22]); /* fall through */
+    case 22: W[22] = W[23] + ((aws_mp_word)ai) * ((aws_mp_word)a2[23]) + ((aws_mp_word)mu) * ((aws_mp_word)m[23]); /* fall through */
+    case 23: W[23] = W[24] + ((aws_mp_word)ai) * ((aws_mp_word)a2[24]) + ((aws_mp_word)mu) * ((aws_mp_word)m[24]); /* fall through */
+    case 24: W[24] = W[25] + ((aws_mp_word)ai) * ((aws_mp_word)a2[25]) + ((aws_mp_word)mu) * ((aws_mp_word)m[25]); /* fall through */
+    case 25: W[25] = W[26] + ((aws_mp_word)ai) * ((aws_mp_word)a2[26]) + ((aws_mp_word)mu) * ((aws_mp_word)m[26]); /* fall through */
+    case 26: W[26] = W[27] + ((aws_mp_word)ai) * ((aws_mp_word)a2[27]) + ((aws_mp_word)mu) * ((aws_mp_word)m[27]); /* fall through */
+    case 27: W[27] = W[28] + ((aws_mp_word)ai) * ((aws_mp_word)a2[28]) + ((aws_mp_word)mu) * ((aws_mp_word)m[28]); /* fall through */
+    case 28: W[28] = W[29] + ((aws_mp_word)ai) * ((aws_mp_word)a2[29]) + ((aws_mp_word)mu) * ((aws_mp_word)m[29]); /* fall through */
+    case 29: W[29] = W[30] + ((aws_mp_word)ai) * ((aws_mp_word)a2[30]) + ((aws_mp_word)mu) * ((aws_mp_word)m[30]); /* fall through */
+    case 30: W[30] = W[31] + ((aws_mp_word)ai) * ((aws_mp_word)a2[31]) + ((aws_mp_word)mu) * ((aws_mp_word)m[31]); /* fall through */
+    case 31: W[31] = W[32] + ((aws_mp_word)ai) * ((aws_mp_word)a2[32]) + ((aws_mp_word)mu) * ((aws_mp_word)m[32]); /* fall through */
+    case 32: W[32] = W[33] + ((aws_mp_word)ai) * ((aws_mp_word)a2[33]) + ((aws_mp_word)mu) * ((aws_mp_word)m[33]); /* fall through */
+    case 33: W[33] = W[34] + ((aws_mp_word)ai) * ((aws_mp_word)a2[34]) + ((aws_mp_word)mu) * ((aws_mp_word)m[34]); /* fall through */
+    case 34: W[34] = W[35] + ((aws_mp_word)ai) * ((aws_mp_word)a2[35]) + ((aws_mp_word)mu) * ((aws_mp_word)m[35]); /* fall through */
+    case 35: W[35] = W[36] + ((aws_mp_word)ai) * ((aws_mp_word)a2[36]) + ((aws_mp_word)mu) * ((aws_mp_word)m[36]); /* fall through */
+    case 36: W[36] = W[37] + ((aws_mp_word)ai) * ((aws_mp_word)a2[37]) + ((aws_mp_word)mu) * ((aws_mp_word)m[37]); /* fall through */
+    case 37: W[37] = W[38] + ((aws_mp_word)ai) * ((aws_mp_word)a2[38]) + ((aws_mp_word)mu) * ((aws_mp_word)m[38]); /* fall through */
+    case 38: W[38] = W[39] + ((aws_mp_word)ai) * ((aws_mp_word)a2[39]) + ((aws_mp_word)mu) * ((aws_mp_word)m[39]); /* fall through */
+    case 39: W[39] = W[40] + ((aws_mp_word)ai) * ((aws_mp_word)a2[40]) + ((aws_mp_word)mu) * ((aws_mp_word)m[40]); /* fall through */
+    case 40: W[40] = W[41] + ((aws_mp_word)ai) * ((aws_mp_word)a2[41]) + ((aws_mp_word)mu) * ((aws_mp_word)m[41]); /* fall through */
+    case 41: W[41] = W[42] + ((aws_mp_word)ai) * ((aws_mp_word)a2[42]) + ((aws_mp_word)mu) * ((aws_mp_word)m[42]); /* fall through */
+    case 42: W[42] = W[43] + ((aws_mp_word)ai) * ((aws_mp_word)a2[43]) + ((aws_mp_word)mu) * ((aws_mp_word)m[43]); /* fall through */
+    case 43: W[43] = W[44] + ((aws_mp_word)ai) * ((aws_mp_word)a2[44]) + ((aws_mp_word)mu) * ((aws_mp_word)m[44]); /* fall through */
+    case 44: W[44] = W[45] + ((aws_mp_word)ai) * ((aws_mp_word)a2[45]) + ((aws_mp_word)mu) * ((aws_mp_word)m[45]); /* fall through */
+    case 45: W[45] = W[46] + ((aws_mp_word)ai) * ((aws_mp_word)a2[46]) + ((aws_mp_word)mu) * ((aws_mp_word)m[46]); /* fall through */
+    case 46: W[46] = W[47] + ((aws_mp_word)ai) * ((aws_mp_word)a2[47]) + ((aws_mp_word)mu) * ((aws_mp_word)m[47]); /* fall through */
+    case 47: W[47] = W[48] + ((aws_mp_word)ai) * ((aws_mp_word)a2[48]) + ((aws_mp_word)mu) * ((aws_mp_word)m[48]); /* fall through */
+    case 48: W[48] = W[49] + ((aws_mp_word)ai) * ((aws_mp_word)a2[49]) + ((aws_mp_word)mu) * ((aws_mp_word)m[49]); /* fall through */
+    case 49: W[49] = W[50] + ((aws_mp_word)ai) * ((aws_mp_word)a2[50]) + ((aws_mp_word)mu) * ((aws_mp_word)m[50]); /* fall through */
+    case 50: W[50] = ((aws_mp_word)ai) * ((aws_mp_word)a2[51]) + ((aws_mp_word)mu) * ((aws_mp_word)m[51]); /* fall through */
+    default: break;
+    }
+    W[0] += r;
+  }
+}
+
+/* c = W with the carries resolved and m subtracted unless that borrows,
+ * both results are formed and one is picked by mask
+ */
+static void s_mp_fixed_out(aws_mp_word *W, const aws_mp_digit *m, aws_mp_digit *c)
+{
+  register aws_mp_word  r;
+  register aws_mp_digit d, u, mask;
+  aws_mp_digit t[52];
+
+  r = 0;
+  u = 0;
+  r += W[0]; c[0] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[0] - m[0] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[0] = d & AWS_MP_MASK;
+  r += W[1]; c[1] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[1] - m[1] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[1] = d & AWS_MP_MASK;
+  r += W[2]; c[2] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[2] - m[2] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[2] = d & AWS_MP_MASK;
+  r += W[3]; c[3] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[3] - m[3] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[3] = d & AWS_MP_MASK;
+  r += W[4]; c[4] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[4] - m[4] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[4] = d & AWS_MP_MASK;
+  r += W[5]; c[5] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[5] - m[5] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[5] = d & AWS_MP_MASK;
+  r += W[6]; c[6] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[6] - m[6] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[6] = d & AWS_MP_MASK;
+  r += W[7]; c[7] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[7] - m[7] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[7] = d & AWS_MP_MASK;
+  r += W[8]; c[8] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[8] - m[8] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[8] = d & AWS_MP_MASK;
+  r += W[9]; c[9] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[9] - m[9] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[9] = d & AWS_MP_MASK;
+  r += W[10]; c[10] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[10] - m[10] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[10] = d & AWS_MP_MASK;
+  r += W[11]; c[11] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[11] - m[11] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[11] = d & AWS_MP_MASK;
+  r += W[12]; c[12] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[12] - m[12] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[12] = d & AWS_MP_MASK;
+  r += W[13]; c[13] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[13] - m[13] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[13] = d & AWS_MP_MASK;
+  r += W[14]; c[14] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[14] - m[14] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[14] = d & AWS_MP_MASK;
+  r += W[15]; c[15] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[15] - m[15] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[15] = d & AWS_MP_MASK;
+  r += W[16]; c[16] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[16] - m[16] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[16] = d & AWS_MP_MASK;
+  r += W[17]; c[17] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[17] - m[17] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[17] = d & AWS_MP_MASK;
+  r += W[18]; c[18] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[18] - m[18] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[18] = d & AWS_MP_MASK;
+  r += W[19]; c[19] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[19] - m[19] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[19] = d & AWS_MP_MASK;
+  r += W[20]; c[20] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[20] - m[20] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[20] = d & AWS_MP_MASK;
+  r += W[21]; c[21] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[21] - m[21] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[21] = d & AWS_MP_MASK;
+  r += W[22]; c[22] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[22] - m[22] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[22] = d & AWS_MP_MASK;
+  r += W[23]; c[23] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[23] - m[23] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[23] = d & AWS_MP_MASK;
+  r += W[24]; c[24] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[24] - m[24] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[24] = d & AWS_MP_MASK;
+  r += W[25]; c[25] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[25] - m[25] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[25] = d & AWS_MP_MASK;
+  r += W[26]; c[26] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[26] - m[26] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[26] = d & AWS_MP_MASK;
+  r += W[27]; c[27] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[27] - m[27] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[27] = d & AWS_MP_MASK;
+  r += W[28]; c[28] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[28] - m[28] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[28] = d & AWS_MP_MASK;
+  r += W[29]; c[29] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[29] - m[29] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[29] = d & AWS_MP_MASK;
+  r += W[30]; c[30] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[30] - m[30] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[30] = d & AWS_MP_MASK;
+  r += W[31]; c[31] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[31] - m[31] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[31] = d & AWS_MP_MASK;
+  r += W[32]; c[32] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[32] - m[32] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[32] = d & AWS_MP_MASK;
+  r += W[33]; c[33] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[33] - m[33] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[33] = d & AWS_MP_MASK;
+  r += W[34]; c[34] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[34] - m[34] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[34] = d & AWS_MP_MASK;
+  r += W[35]; c[35] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[35] - m[35] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[35] = d & AWS_MP_MASK;
+  r += W[36]; c[36] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[36] - m[36] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[36] = d & AWS_MP_MASK;
+  r += W[37]; c[37] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[37] - m[37] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[37] = d & AWS_MP_MASK;
+  r += W[38]; c[38] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[38] - m[38] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[38] = d & AWS_MP_MASK;
+  r += W[39]; c[39] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[39] - m[39] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[39] = d & AWS_MP_MASK;
+  r += W[40]; c[40] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[40] - m[40] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[40] = d & AWS_MP_MASK;
+  r += W[41]; c[41] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[41] - m[41] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[41] = d & AWS_MP_MASK;
+  r += W[42]; c[42] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[42] - m[42] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[42] = d & AWS_MP_MASK;
+  r += W[43]; c[43] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[43] - m[43] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[43] = d & AWS_MP_MASK;
+  r += W[44]; c[44] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[44] - m[44] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[44] = d & AWS_MP_MASK;
+  r += W[45]; c[45] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[45] - m[45] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[45] = d & AWS_MP_MASK;
+  r += W[46]; c[46] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[46] - m[46] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[46] = d & AWS_MP_MASK;
+  r += W[47]; c[47] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[47] - m[47] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[47] = d & AWS_MP_MASK;
+  r += W[48]; c[48] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[48] - m[48] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[48] = d & AWS_MP_MASK;
+  r += W[49]; c[49] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[49] - m[49] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[49] = d & AWS_MP_MASK;
+  r += W[50]; c[50] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[50] - m[50] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[50] = d & AWS_MP_MASK;
+  r += W[51]; c[51] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[51] - m[51] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[51] = d & AWS_MP_MASK;
+
+  /* keep c only if c - m went negative, i.e. borrowed past the top digit */
+  mask = (aws_mp_digit)0 - (u & (((aws_mp_digit)r) ^ 1u));
+  c[0] = (c[0] & mask) | (t[0] & ~mask);
+  c[1] = (c[1] & mask) | (t[1] & ~mask);
+  c[2] = (c[2] & mask) | (t[2] & ~mask);
+  c[3] = (c[3] & mask) | (t[3] & ~mask);
+  c[4] = (c[4] & mask) | (t[4] & ~mask);
+  c[5] = (c[5] & mask) | (t[5] & ~mask);
+  c[6] = (c[6] & mask) | (t[6] & ~mask);
+  c[7] = (c[7] & mask) | (t[7] & ~mask);
+  c[8] = (c[8] & mask) | (t[8] & ~mask);
+  c[9] = (c[9] & mask) | (t[9] & ~mask);
+  c[10] = (c[10] & mask) | (t[10] & ~mask);
+  c[11] = (c[11] & mask) | (t[11] & ~mask);
+  c[12] = (c[12] & mask) | (t[12] & ~mask);
+  c[13] = (c[13] & mask) | (t[13] & ~mask);
+  c[14] = (c[14] & mask) | (t[14] & ~mask);
+  c[15] = (c[15] & mask) | (t[15] & ~mask);
+  c[16] = (c[16] & mask) | (t[16] & ~mask);
+  c[17] = (c[17] & mask) | (t[17] & ~mask);
+  c[18] = (c[18] & mask) | (t[18] & ~mask);
+  c[19] = (c[19] & mask) | (t[19] & ~mask);
+  c[20] = (c[20] & mask) | (t[20] & ~mask);
+  c[21] = (c[21] & mask) | (t[21] & ~mask);
+  c[22] = (c[22] & mask) | (t[22] & ~mask);
+  c[23] = (c[23] & mask) | (t[23] & ~mask);
+  c[24] = (c[24] & mask) | (t[24] & ~mask);
+  c[25] = (c[25] & mask) | (t[25] & ~mask);
+  c[26] = (c[26] & mask) | (t[26] & ~mask);
+  c[27] = (c[27] & mask) | (t[27] & ~mask);
+  c[28] = (c[28] & mask) | (t[28] & ~mask);
+  c[29] = (c[29] & mask) | (t[29] & ~mask);
+  c[30] = (c[30] & mask) | (t[30] & ~mask);
+  c[31] = (c[31] & mask) | (t[31] & ~mask);
+  c[32] = (c[32] & mask) | (t[32] & ~mask);
+  c[33] = (c[33] & mask) | (t[33] & ~mask);
+  c[34] = (c[34] & mask) | (t[34] & ~mask);
+  c[35] = (c[35] & mask) | (t[35] & ~mask);
+  c[36] = (c[36] & mask) | (t[36] & ~mask);
+  c[37] = (c[37] & mask) | (t[37] & ~mask);
+  c[38] = (c[38] & mask) | (t[38] & ~mask);
+  c[39] = (c[39] & mask) | (t[39] & ~mask);
+  c[40] = (c[40] & mask) | (t[40] & ~mask);
+  c[41] = (c[41] & mask) | (t[41] & ~mask);
+  c[42] = (c[42] & mask) | (t[42] & ~mask);
+  c[43] = (c[43] & mask) | (t[43] & ~mask);
+  c[44] = (c[44] & mask) | (t[44] & ~mask);
+  c[45] = (c[45] & mask) | (t[45] & ~mask);
+  c[46] = (c[46] & mask) | (t[46] & ~mask);
+  c[47] = (c[47] & mask) | (t[47] & ~mask);
+  c[48] = (c[48] & mask) | (t[48] & ~mask);
+  c[49] = (c[49] & mask) | (t[49] & ~mask);
+  c[50] = (c[50] & mask) | (t[50] & ~mask);
+  c[51] = (c[51] & mask) | (t[51] & ~mask);
+}
+
+/* W = xR**-1 (mod m) as 52 uncarried columns for x < mR padded to 104 digits,
+ * see aws_fast_mp_montgomery_reduce
+ */
+static void s_mp_fixed_reduce_cols(const aws_mp_digit *x, const aws_mp_digit *m, aws_mp_digit rho, aws_mp_word *W)
+{
+  int ix;
+  register aws_mp_digit mu;
+  register aws_mp_word  r;
+
+  for (ix = 0; ix < 52; ix++) {
+    W[ix] = x[ix];
+  }
+
+  for (ix = 0; ix < 52; ix++) {
+    r  = W[0];
+    mu = (aws_mp_digit)(((r & ((aws_mp_word)AWS_MP_MASK)) * ((aws_mp_word)rho)) & ((aws_mp_word)AWS_MP_MASK));
+    r  = (r + ((aws_mp_word)mu) * ((aws_mp_word)m[0])) >> ((aws_mp_word)AWS_DIGIT_BIT);
+    W[0] = W[1] + ((aws_mp_word)mu) * ((aws_mp_word)m[1]);
+    W[1] = W[2] + ((aws_mp_word)mu) * ((aws_mp_word)m[2]);
+    W[2] = W[3] + ((aws_mp_word)mu) * ((aws_mp_word)m[3]);
+    W[3] = W[4] + ((aws_mp_word)mu) * ((aws_mp_word)m[4]);
+    W[4] = W[5] + ((aws_mp_word)mu) * ((aws_mp_word)m[5]);
+    W[5] = W[6] + ((aws_mp_word)mu) * ((aws_mp_word)m[6]);
+    W[6] = W[7] + ((aws_mp_word)mu) * ((aws_mp_word)m[7]);
+    W[7] = W[8] + ((aws_mp_word)mu) * ((aws_mp_word)m[8]);
+    W[8] = W[9] + ((aws_mp_word)mu) * ((aws_mp_word)m[9]);
+    W[9] = W[10] + ((aws_mp_word)mu) * ((aws_mp_word)m[10]);
+    W[10] = W[11] + ((aws_mp_word)mu) * ((aws_mp_word)m[11]);
+    W[11] = W[12] + ((aws_mp_word)mu) * ((aws_mp_word)m[12]);
+    W[12] = W[13] + ((aws_mp_word)mu) * ((aws_mp_word)m[13]);
+    W[13] = W[14] + ((aws_mp_word)mu) * ((aws_mp_word)m[14]);
+    W[14] = W[15] + ((aws_mp_word)mu) * ((aws_mp_word)m[15]);
+    W[15] = W[16] + ((aws_mp_word)mu) * ((aws_mp_word)m[16]);
+    W[16] = W[17] + ((aws_mp_word)mu) * ((aws_mp_word)m[17]);
+    W[17] = W[18] + ((aws_mp_word)mu) * ((aws_mp_word)m[18]);
+    W[18] = W[19] + ((aws_mp_word)mu) * ((aws_mp_word)m[19]);
+    W[19] = W[20] + ((aws_mp_word)mu) * ((aws_mp_word)m[20]);
+    W[20] = W[21] + ((aws_mp_word)mu) * ((aws_mp_word)m[21]);
+    W[21] = W[22] + ((aws_mp_word)mu) * ((aws_mp_word)m[22]);
+    W[22] = W[23] + ((aws_mp_word)mu) * ((aws_mp_word)m[23]);
+    W[23] = W[24] + ((aws_mp_word)mu) * ((aws_mp_word)m[24]);
+    W[24] = W[25] + ((aws_mp_word)mu) * ((aws_mp_word)m[25]);
+    W[25] = W[26] + ((aws_mp_word)mu) * ((aws_mp_word)m[26]);
+    W[26] = W[27] + ((aws_mp_word)mu) * ((aws_mp_word)m[27]);
+    W[27] = W[28] + ((aws_mp_word)mu) * ((aws_mp_word)m[28]);
+    W[28] = W[29] + ((aws_mp_word)mu) * ((aws_mp_word)m[29]);
+    W[29] = W[30] + ((aws_mp_word)mu) * ((aws_mp_word)m[30]);
+    W[30] = W[31] + ((aws_mp_word)mu) * ((aws_mp_word)m[31]);
+    W[31] = W[32] + ((aws_mp_word)mu) * ((aws_mp_word)m[32]);
+    W[32] = W[33] + ((aws_mp_word)mu) * ((aws_mp_word)m[33]);
+    W[33] = W[34] + ((aws_mp_word)mu) * ((aws_mp_word)m[34]);
+    W[34] = W[35] + ((aws_mp_word)mu) * ((aws_mp_word)m[35]);
+    W[35] = W[36] + ((aws_mp_word)mu) * ((aws_mp_word)m[36]);
+    W[36] = W[37] + ((aws_mp_word)mu) * ((aws_mp_word)m[37]);
+    W[37] = W[38] + ((aws_mp_word)mu) * ((aws_mp_word)m[38]);
+    W[38] = W[39] + ((aws_mp_word)mu) * ((aws_mp_word)m[39]);
+    W[39] = W[40] + ((aws_mp_word)mu) * ((aws_mp_word)m[40]);
+    W[40] = W[41] + ((aws_mp_word)mu) * ((aws_mp_word)m[41]);
+    W[41] = W[42] + ((aws_mp_word)mu) * ((aws_mp_word)m[42]);
+    W[42] = W[43] + ((aws_mp_word)mu) * ((aws_mp_word)m[43]);
+    W[43] = W[44] + ((aws_mp_word)mu) * ((aws_mp_word)m[44]);
+    W[44] = W[45] + ((aws_mp_word)mu) * ((aws_mp_word)m[45]);
+    W[45] = W[46] + ((aws_mp_word)mu) * ((aws_mp_word)m[46]);
+    W[46] = W[47] + ((aws_mp_word)mu) * ((aws_mp_word)m[47]);
+    W[47] = W[48] + ((aws_mp_word)mu) * ((aws_mp_word)m[48]);
+    W[48] = W[49] + ((aws_mp_word)mu) * ((aws_mp_word)m[49]);
+    W[49] = W[50] + ((aws_mp_word)mu) * ((aws_mp_word)m[50]);
+    W[50] = W[51] + ((aws_mp_word)mu) * ((aws_mp_word)m[51]);
+    W[51] = x[ix + 52];
+    W[0] += r;
+  }
+}
+
+
+#elif AWS_MP_FIXED_BITS == 3072 && AWS_DIGIT_BIT == 28
+
+#define AWS_MP_FIXED_DIGS 110
+
+/* W = abR**-1 (mod m) as 110 uncarried columns, see s_mp_montgomery_mul_cols */
+static void s_mp_fixed_mul_cols(const aws_mp_digit *a, const aws_mp_digit *b, const aws_mp_digit *m,
+                                aws_mp_digit mp, aws_mp_word *W)
+{
+  int ix;
+  register aws_mp_digit bi, mu;
+  register aws_mp_word  r;
+
+  for (ix = 0; ix < 110; ix++) {
+    W[ix] = 0;
+  }
+
+  /* the top column only ever holds zero and is not touched */
+  for (ix = 0; ix < 110; ix++) {
+    bi = b[ix];
+    r  = W[0] + ((aws_mp_word)bi) * ((aws_mp_word)a[0]);
+    mu = (aws_mp_digit)(((r & ((aws_mp_word)AWS_MP_MASK)) * ((aws_mp_word)mp)) & ((aws_mp_word)AWS_MP_MASK));
+    r  = (r + ((aws_mp_word)mu) * ((aws_mp_word)m[0])) >> ((aws_mp_word)AWS_DIGIT_BIT);
+    W[0] = W[1] + ((aws_mp_word)bi) * ((aws_mp_word)a[1]) + ((aws_mp_word)mu) * ((aws_mp_word)m[1]);
+    W[1] = W[2] + ((aws_mp_word)bi) * ((aws_mp_word)a[2]) + ((aws_mp_word)mu) * ((aws_mp_word)m[2]);
+    W[2] = W[3] + ((aws_mp_word)bi) * ((aws_mp_word)a[3]) + ((aws_mp_word)mu) * ((aws_mp_word)m[3]);
+    W[3] = W[4] + ((aws_mp_word)bi) * ((aws_mp_word)a[4]) + ((aws_mp_word)mu) * ((aws_mp_word)m[4]);
+    W[4] = W[5] + ((aws_mp_word)bi) * ((aws_mp_word)a[5]) + ((aws_mp_word)mu) * ((aws_mp_word)m[5]);
+    W[5] = W[6] + ((aws_mp_word)bi) * ((aws_mp_word)a[6]) + ((aws_mp_word)mu) * ((aws_mp_word)m[6]);
+    W[6] = W[7] + ((aws_mp_word)bi) * ((aws_mp_word)a[7]) + ((aws_mp_word)mu) * ((aws_mp_word)m[7]);
+    W[7] = W[8] + ((aws_mp_word)bi) * ((aws_mp_word)a[8]) + ((aws_mp_word)mu) * ((aws_mp_word)m[8]);
+    W[8] = W[9] + ((aws_mp_word)bi) * ((aws_mp_word)a[9]) + ((aws_mp_word)mu) * ((aws_mp_word)m[9]);
+    W[9] = W[10] + ((aws_mp_word)bi) * ((aws_mp_word)a[10]) + ((aws_mp_word)mu) * ((aws_mp_word)m[10]);
+    W[10] = W[11] + ((aws_mp_word)bi) * ((aws_mp_word)a[11]) + ((aws_mp_word)mu) * ((aws_mp_word)m[11]);
+    W[11] = W[12] + ((aws_mp_word)bi) * ((aws_mp_word)a[12]) + ((aws_mp_word)mu) * ((aws_mp_word)m[12]);
+    W[12] = W[13] + ((aws_mp_word)bi) * ((aws_mp_word)a[13]) + ((aws_mp_word)mu) * ((aws_mp_word)m[13]);
+    W[13] = W[14] + ((aws_mp_word)bi) * ((aws_mp_word)a[14]) + ((aws_mp_word)mu) * ((aws_mp_word)m[14]);
+    W[14] = W[15] + ((aws_mp_word)bi) * ((aws_mp_word)a[15]) + ((aws_mp_word)mu) * ((aws_mp_word)m[15]);
+    W[15] = W[16] + ((aws_mp_word)bi) * ((aws_mp_word)a[16]) + ((aws_mp_word)mu) * ((aws_mp_word)m[16]);
+    W[16] = W[17] + ((aws_mp_word)bi) * ((aws_mp_word)a[17]) + ((aws_mp_word)mu) * ((aws_mp_word)m[17]);
+    W[17] = W[18] + ((aws_mp_word)bi) * ((aws_mp_word)a[18]) + ((aws_mp_word)mu) * ((aws_mp_word)m[18]);
+    W[18] = W[19] + ((aws_mp_word)bi) * ((aws_mp_word)a[19]) + ((aws_mp_word)mu) * ((aws_mp_word)m[19]);
+    W[19] = W[20] + ((aws_mp_word)bi) * ((aws_mp_word)a[20]) + ((aws_mp_word)mu) * ((aws_mp_word)m[20]);
+    W[20] = W[21] + ((aws_mp_word)bi) * ((aws_mp_word)a[21]) + ((aws_mp_word)mu) * ((aws_mp_word)m[21]);
+    W[21] = W[22] + ((aws_mp_word)bi) * ((aws_mp_word)a[22]) + ((aws_mp_word)mu) * ((aws_mp_word)m[22]);
+    W[22] = W[23] + ((aws_mp_word)bi) * ((aws_mp_word)a[23]) + ((aws_mp_word)mu) * ((aws_mp_word)m[23]);
+    W[23] = W[24] + ((aws_mp_word)bi) * ((aws_mp_word)a[24]) + ((aws_mp_word)mu) * ((aws_mp_word)m[24]);
+    W[24] = W[25] + ((aws_mp_word)bi) * ((aws_mp_word)a[25]) + ((aws_mp_word)mu) * ((aws_mp_word)m[25]);
+    W[25] = W[26] + ((aws_mp_word)bi) * ((aws_mp_word)a[26]) + ((aws_mp_word)mu) * ((aws_mp_word)m[26]);
+    W[26] = W[27] + ((aws_mp_word)bi) * ((aws_mp_word)a[27]) + ((aws_mp_word)mu) * ((aws_mp_word)m[27]);
+    W[27] = W[28] + ((aws_mp_word)bi) * ((aws_mp_word)a[28]) + ((aws_mp_word)mu) * ((aws_mp_word)m[28]);
+    W[28] = W[29] + ((aws_mp_word)bi) * ((aws_mp_word)a[29]) + ((aws_mp_word)mu) * ((aws_mp_word)m[29]);
+    W[29] = W[30] + ((aws_mp_word)bi) * ((aws_mp_word)a[30]) + ((aws_mp_word)mu) * ((aws_mp_word)m[30]);
+    W[30] = W[31] + ((aws_mp_word)bi) * ((aws_mp_word)a[31]) + ((aws_mp_word)mu) * ((aws_mp_word)m[31]);
+    W[31] = W[32] + ((aws_mp_word)bi) * ((aws_mp_word)a[32]) + ((aws_mp_word)mu) * ((aws_mp_word)m[32]);
+    W[32] = W[33] + ((aws_mp_word)bi) * ((aws_mp_word)a[33]) + ((aws_mp_word)mu) * ((aws_mp_word)m[33]);
+    W[33] = W[34] + ((aws_mp_word)bi) * ((aws_mp_word)a[34]) + ((aws_mp_word)mu) * ((aws_mp_word)m[34]);
+    W[34] = W[35] + ((aws_mp_word)bi) * ((aws_mp_word)a[35]) + ((aws_mp_word)mu) * ((aws_mp_word)m[35]);
+    W[35] = W[36] + ((aws_mp_word)bi) * ((aws_mp_word)a[36]) + ((aws_mp_word)mu) * ((aws_mp_word)m[36]);
+    W[36] = W[37] + ((aws_mp_word)bi) * ((aws_mp_word)a[37]) + ((aws_mp_word)mu) * ((aws_mp_word)m[37]);
+    W[37] = W[38] + ((aws_mp_word)bi) * ((aws_mp_word)a[38]) + ((aws_mp_word)mu) * ((aws_mp_word)m[38]);
+    W[38] = W[39] + ((aws_mp_word)bi) * ((aws_mp_word)a[39]) + ((aws_mp_word)mu) * ((aws_mp_word)m[39]);
+    W[39] = W[40] + ((aws_mp_word)bi) * ((aws_mp_word)a[40]) + ((aws_mp_word)mu) * ((aws_mp_word)m[40]);
+    W[40] = W[41] + ((aws_mp_word)bi) * ((aws_mp_word)a[41]) + ((aws_mp_word)mu) * ((aws_mp_word)m[41]);
+    W[41] = W[42] + ((aws_mp_word)bi) * ((aws_mp_word)a[42]) + ((aws_mp_word)mu) * ((aws_mp_word)m[42]);
+    W[42] = W[43] + ((aws_mp_word)bi) * ((aws_mp_word)a[43]) + ((aws_mp_word)mu) * ((aws_mp_word)m[43]);
+    W[43] = W[44] + ((aws_mp_word)bi) * ((aws_mp_word)a[44]) + ((aws_mp_word)mu) * ((aws_mp_word)m[44]);
+    W[44] = W[45] + ((aws_mp_word)bi) * ((aws_mp_word)a[45]) + ((aws_mp_word)mu) * ((aws_mp_word)m[45]);
+    W[45] = W[46] + ((aws_mp_word)bi) * ((aws_mp_word)a[46]) + ((aws_mp_word)mu) * ((aws_mp_word)m[46]);
+    W[46] = W[47] + ((aws_mp_word)bi) * ((aws_mp_word)a[47]) + ((aws_mp_word)mu) * ((aws_mp_word)m[47]);
+    W[47] = W[48] + ((aws_mp_word)bi) * ((aws_mp_word)a[48]) + ((aws_mp_word)mu) * ((aws_mp_word)m[48]);
+    W[48] = W[49] + ((aws_mp_word)bi) * ((aws_mp_word)a[49]) + ((aws_mp_word)mu) * ((aws_mp_word)m[49]);
+    W[49] = W[50] + ((aws_mp_word)bi) * ((aws_mp_word)a[50]) + ((aws_mp_word)mu) * ((aws_mp_word)m[50]);
+    W[50] = W[51] + ((aws_mp_word)bi) * ((aws_mp_word)a[51]) + ((aws_mp_word)mu) * ((aws_mp_word)m[51]);
+    W[51] = W[52] + ((aws_mp_word)bi) * ((aws_mp_word)a[52]) + ((aws_mp_word)mu) * ((aws_mp_word)m[52]);
+    W[52] = W[53] + ((aws_mp_word)bi) * ((aws_mp_word)a[53]) + ((aws_mp_word)mu) * ((aws_mp_word)m[53]);
+    W[53] = W[54] + ((aws_mp_word)bi) * ((aws_mp_word)a[54]) + ((aws_mp_word)mu) * ((aws_mp_word)m[54]);
+    W[54] = W[55] + ((aws_mp_word)bi) * ((aws_mp_word)a[55]) + ((aws_mp_word)mu) * ((aws_mp_word)m[55]);
+    W[55] = W[56] + ((aws_mp_word)bi) * ((aws_mp_word)a[56]) + ((aws_mp_word)mu) * ((aws_mp_word)m[56]);
+    W[56] = W[57] + ((aws_mp_word)bi) * ((aws_mp_word)a[57]) + ((aws_mp_word)mu) * ((aws_mp_word)m[57]);
+    W[57] = W[58] + ((aws_mp_word)bi) * ((aws_mp_word)a[58]) + ((aws_mp_word)mu) * ((aws_mp_word)m[58]);
+    W[58] = W[59] + ((aws_mp_word)bi) * ((aws_mp_word)a[59]) + ((aws_mp_word)mu) * ((aws_mp_word)m[59]);
+    W[59] = W[60] + ((aws_mp_word)bi) * ((aws_mp_word)a[60]) + ((aws_mp_word)mu) * ((aws_mp_word)m[60]);
+    W[60] = W[61] + ((aws_mp_word)bi) * ((aws_mp_word)a[61]) + ((aws_mp_word)mu) * ((aws_mp_word)m[61]);
+    W[61] = W[62] + ((aws_mp_word)bi) * ((aws_mp_word)a[62]) + ((aws_mp_word)mu) * ((aws_mp_word)m[62]);
+    W[62] = W[63] + ((aws_mp_word)bi) * ((aws_mp_word)a[63]) + ((aws_mp_word)mu) * ((aws_mp_word)m[63]);
+    W[63] = W[64] + ((aws_mp_word)bi) * ((aws_mp_word)a[64]) + ((aws_mp_word)mu) * ((aws_mp_word)m[64]);
+    W[64] = W[65] + ((aws_mp_word)bi) * ((aws_mp_word)a[65]) + ((aws_mp_word)mu) * ((aws_mp_word)m[65]);
+    W[65] = W[66] + ((aws_mp_word)bi) * ((aws_mp_word)a[66]) + ((aws_mp_word)mu) * ((aws_mp_word)m[66]);
+    W[66] = W[67] + ((aws_mp_word)bi) * ((aws_mp_word)a[67]) + ((aws_mp_word)mu) * ((aws_mp_word)m[67]);
+    W[67] = W[68] + ((aws_mp_word)bi) * ((aws_mp_word)a[68]) + ((aws_mp_word)mu) * ((aws_mp_word)m[68]);
+    W[68] = W[69] + ((aws_mp_word)bi) * ((aws_mp_word)a[69]) + ((aws_mp_word)mu) * ((aws_mp_word)m[69]);
+    W[69] = W[70] + ((aws_mp_word)bi) * ((aws_mp_word)a[70]) + ((aws_mp_word)mu) * ((aws_mp_word)m[70]);
+    W[70] = W[71] + ((aws_mp_word)bi) * ((aws_mp_word)a[71]) + ((aws_mp_word)mu) * ((aws_mp_word)m[71]);
+    W[71] = W[72] + ((aws_mp_word)bi) * ((aws_mp_word)a[72]) + ((aws_mp_word)mu) * ((aws_mp_word)m[72]);
+    W[72] = W[73] + ((aws_mp_word)bi) * ((aws_mp_word)a[73]) + ((aws_mp_word)mu) * ((aws_mp_word)m[73]);
+    W[73] = W[74] + ((aws_mp_word)bi) * ((aws_mp_word)a[74]) + ((aws_mp_word)mu) * ((aws_mp_word)m[74]);
+    W[74] = W[75] + ((aws_mp_word)bi) * ((aws_mp_word)a[75]) + ((aws_mp_word)mu) * ((aws_mp_word)m[75]);
+    W[75] = W[76] + ((aws_mp_word)bi) * ((aws_mp_word)a[76]) + ((aws_mp_word)mu) * ((aws_mp_word)m[76]);
+    W[76] = W[77] + ((aws_mp_word)bi) * ((aws_mp_word)a[77]) + ((aws_mp_word)mu) * ((aws_mp_word)m[77]);
+    W[77] = W[78] + ((aws_mp_word)bi) * ((aws_mp_word)a[78]) + ((aws_mp_word)mu) * ((aws_mp_word)m[78]);
+    W[78] = W[79] + ((aws_mp_word)bi) * ((aws_mp_word)a[79]) + ((aws_mp_word)mu) * ((aws_mp_word)m[79]);
+    W[79] = W[80] + ((aws_mp_word)bi) * ((aws_mp_word)a[80]) + ((aws_mp_word)mu) * ((aws_mp_word)m[80]);
+    W[80] = W[81] + ((aws_mp_word)bi) * ((aws_mp_word)a[81]) + ((aws_mp_word)mu) * ((aws_mp_word)m[81]);
+    W[81] = W[82] + ((aws_mp_word)bi) * ((aws_mp_word)a[82]) + ((aws_mp_word)mu) * ((aws_mp_word)m[82]);
+    W[82] = W[83] + ((aws_mp_word)bi) * ((aws_mp_word)a[83]) + ((aws_mp_word)mu) * ((aws_mp_word)m[83]);
+    W[83] = W[84] + ((aws_mp_word)bi) * ((aws_mp_word)a[84]) + ((aws_mp_word)mu) * ((aws_mp_word)m[84]);
+    W[84] = W[85] + ((aws_mp_word)bi) * ((aws_mp_word)a[85]) + ((aws_mp_word)mu) * ((aws_mp_word)m[85]);
+    W[85] = W[86] + ((aws_mp_word)bi) * ((aws_mp_word)a[86]) + ((aws_mp_word)mu) * ((aws_mp_word)m[86]);
+    W[86] = W[87] + ((aws_mp_word)bi) * ((aws_mp_word)a[87]) + ((aws_mp_word)mu) * ((aws_mp_word)m[87]);
+    W[87] = W[88] + ((aws_mp_word)bi) * ((aws_mp_word)a[88]) + ((aws_mp_word)mu) * ((aws_mp_word)m[88]);
+    W[88] = W[89] + ((aws_mp_word)bi) * ((aws_mp_word)a[89]) + ((aws_mp_word)mu) * ((aws_mp_word)m[89]);
+    W[89] = W[90] + ((aws_mp_word)bi) * ((aws_mp_word)a[90]) + ((aws_mp_word)mu) * ((aws_mp_word)m[90]);
+    W[90] = W[91] + ((aws_mp_word)bi) * ((aws_mp_word)a[91]) + ((aws_mp_word)mu) * ((aws_mp_word)m[91]);
+    W[91] = W[92] + ((aws_mp_word)bi) * ((aws_mp_word)a[92]) + ((aws_mp_word)mu) * ((aws_mp_word)m[92]);
+    W[92] = W[93] + ((aws_mp_word)bi) * ((aws_mp_word)a[93]) + ((aws_mp_word)mu) * ((aws_mp_word)m[93]);
+    W[93] = W[94] + ((aws_mp_word)bi) * ((aws_mp_word)a[94]) + ((aws_mp_word)mu) * ((aws_mp_word)m[94]);
+    W[94] = W[95] + ((aws_mp_word)bi) * ((aws_mp_word)a[95]) + ((aws_mp_word)mu) * ((aws_mp_word)m[95]);
+    W[95] = W[96] + ((aws_mp_word)bi) * ((aws_mp_word)a[96]) + ((aws_mp_word)mu) * ((aws_mp_word)m[96]);
+    W[96] = W[97] + ((aws_mp_word)bi) * ((aws_mp_word)a[97]) + ((aws_mp_word)mu) * ((aws_mp_word)m[97]);
+    W[97] = W[98] + ((aws_mp_word)bi) * ((aws_mp_word)a[98]) + ((aws_mp_word)mu) * ((aws_mp_word)m[98]);
+    W[98] = W[99] + ((aws_mp_word)bi) * ((aws_mp_word)a[99]) + ((aws_mp_word)mu) * ((aws_mp_word)m[99]);
+    W[99] = W[100] + ((aws_mp_word)bi) * ((aws_mp_word)a[100]) + ((aws_mp_word)mu) * ((aws_mp_word)m[100]);
+    W[100] = W[101] + ((aws_mp_word)bi) * ((aws_mp_word)a[101]) + ((aws_mp_word)mu) * ((aws_mp_word)m[101]);
+    W[101] = W[102] + ((aws_mp_word)bi) * ((aws_mp_word)a[102]) + ((aws_mp_word)mu) * ((aws_mp_word)m[102]);
+    W[102] = W[103] + ((aws_mp_word)bi) * ((aws_mp_word)a[103]) + ((aws_mp_word)mu) * ((aws_mp_word)m[103]);
+    W[103] = W[104] + ((aws_mp_word)bi) * ((aws_mp_word)a[104]) + ((aws_mp_word)mu) * ((aws_mp_word)m[104]);
+    W[104] = W[105] + ((aws_mp_word)bi) * ((aws_mp_word)a[105]) + ((aws_mp_word)mu) * ((aws_mp_word)m[105]);
+    W[105] = W[106] + ((aws_mp_word)bi) * ((aws_mp_word)a[106]) + ((aws_mp_word)mu) * ((aws_mp_word)m[106]);
+    W[106] = W[107] + ((aws_mp_word)bi) * ((aws_mp_word)a[107]) + ((aws_mp_word)mu) * ((aws_mp_word)m[107]);
+    W[107] = W[108] + ((aws_mp_word)bi) * ((aws_mp_word)a[108]) + ((aws_mp_word)mu) * ((aws_mp_word)m[108]);
+    W[108] = ((aws_mp_word)bi) * ((aws_mp_word)a[109]) + ((aws_mp_word)mu) * ((aws_mp_word)m[109]);
+    W[0] += r;
+  }
+}
+
+/* W = aaR**-1 (mod m) as 110 uncarried columns, see s_mp_montgomery_sqr_cols
+ *
+ * The columns below ix only see the reduction, the square of a[ix] and its
+ * doubled products with the digits above start at column ix, so the row is
+ * entered there.
+ */
+static void s_mp_fixed_sqr_cols(const aws_mp_digit *a, const aws_mp_digit *m, aws_mp_digit mp, aws_mp_word *W)
+{
+  int ix, iy;
+  register aws_mp_digit ai, mu;
+  register aws_mp_word  r;
+  aws_mp_digit a2[110];
+
+  /* a digit and its double both fit an aws_mp_digit, so 2a[iy] is taken once */
+  for (ix = 0; ix < 110; ix++) {
+    W[ix]  = 0;
+    a2[ix] = a[ix] << 1;
+  }
+
+  for (ix = 0; ix < 110; ix++) {
+    ai = a[ix];
+    r  = W[0];
+    if (ix == 0) {
+      r += ((aws_mp_word)ai) * ((aws_mp_word)ai);
+    }
+    mu = (aws_mp_digit)(((r & ((aws_mp_word)AWS_MP_MASK)) * ((aws_mp_word)mp)) & ((aws_mp_word)AWS_MP_MASK));
+    r  = (r + ((aws_mp_word)mu) * ((aws_mp_word)m[0])) >> ((aws_mp_word)AWS_DIGIT_BIT);
+
+    for (iy = 1; iy < ix; iy++) {
+      W[iy - 1] = W[iy] + ((aws_mp_word)mu) * ((aws_mp_word)m[iy]);
+    }
+    if (ix > 0) {
+      W[ix - 1] = W[ix] + ((aws_mp_word)ai) * ((aws_mp_word)ai) + ((aws_mp_word)mu) * ((aws_mp_word)m[ix]);
+    }
+
+    switch (ix) {
+    case 0: W[0] = W[1] + ((aws_mp_word)ai) * ((aws_mp_word)a2[1]) + ((aws_mp_word)mu) * ((aws_mp_word)m[1]); /* fall through */
+    case 1: W[1] = W[2] + ((aws_mp_word)ai) * ((aws_mp_word)a2[2]) + ((aws_mp_word)mu) * ((aws_mp_word)m[2]); /* fall through */
+    case 2: W[2] = W[3] + ((aws_mp_word)ai) * ((aws_mp_word)a2[3]) + ((aws_mp_word)mu) * ((aws_mp_word)m[3]); /* fall through */
+    case 3: W[3] = W[4] + ((aws_mp_word)ai) * ((aws_mp_word)a2[4]) + ((aws_mp_word)mu) * ((aws_mp_word)m[4]); /* fall through */
+    case 4: W[4] = W[5] + ((aws_mp_word)ai) * ((aws_mp_word)a2[5]) + ((aws_mp_word)mu) * ((aws_mp_word)m[5]); /* fall through */
+    case 5: W[5] = W[6] + ((aws_mp_word)ai) * ((aws_mp_word)a2[6]) + ((aws_mp_word)mu) * ((aws_mp_word)m[6]); /* fall through */
+    case 6: W[6] = W[7] + ((aws_mp_word)ai) * ((aws_mp_word)a2[7]) + ((aws_mp_word)mu) * ((aws_mp_word)m[7]); /* fall through */
+    case 7: W[7] = W[8] + ((aws_mp_word)ai) * ((aws_mp_word)a2[8]) + ((aws_mp_word)mu) * ((aws_mp_word)m[8]); /* fall through */
+    case 8: W[8] = W[9] + ((aws_mp_word)ai) * ((aws_mp_word)a2[9]) + ((aws_mp_word)mu) * ((aws_mp_word)m[9]); /* fall through */
+    case 9: W[9] = W[10] + ((aws_mp_word)ai) * ((aws_mp_word)a2[10]) + ((aws_mp_word)mu) * ((aws_mp_word)m[10]); /* fall through */
+    case 10: W[10] = W[11] + ((aws_mp_word)ai) * ((aws_mp_word)a2[11]) + ((aws_mp_word)mu) * ((aws_mp_word)m[11]); /* fall through */
+    case 11: W[11] = W[12] + ((aws_mp_word)ai) * ((aws_mp_word)a2[12]) + ((aws_mp_word)mu) * ((aws_mp_word)m[12]); /* fall through */
+    case 12: W[12] = W[13] + ((aws_mp_word)ai) * ((aws_mp_word)a2[13]) + ((aws_mp_word)mu) * ((aws_mp_word)m[13]); /* fall through */
+    case 13: W[13] = W[14] + ((aws_mp_word)ai) * ((aws_mp_word)a2[14]) + ((aws_mp_word)mu) * ((aws_mp_word)m[14]); /* fall through */
+    case 14: W[14] = W[15] + ((aws_mp_word)ai) * ((aws_mp_word)a2[15]) + ((aws_mp_word)mu) * ((aws_mp_word)m[15]); /* fall through */
+    case 15: W[15] = W[16] + ((aws_mp_word)ai) * ((aws_mp_word)a2[16]) + ((aws_mp_word)mu) * ((aws_mp_word)m[16]); /* fall through */
+    case 16: W[16] = W[17] + ((aws_mp_word)ai) * ((aws_mp_word)a2[17]) + ((aws_mp_word)mu) * ((aws_mp_word)m[17]); /* fall through */
+    case 17: W[17] = W[18] + ((aws_mp_word)ai) * ((aws_mp_word)a2[18]) + ((aws_mp_word)mu) * ((aws_mp_word)m[18]); /* fall through */
+    case 18: W[18] = W[19] + ((aws_mp_word)ai) * ((aws_mp_word)a2[19]) + ((aws_mp_word)mu) * ((aws_mp_word)m[19]); /* fall through */
+    case 19: W[19] = W[20] + ((aws_mp_word)ai) * ((aws_mp_word)a2[20]) + ((aws_mp_word)mu) * ((aws_mp_word)m[20]); /* fall through */
+    case 20: W[20] = W[21] + ((aws_mp_word)ai) * ((aws_mp_word)a2[21]) + ((aws_mp_word)mu) * ((aws_mp_word)m[21]); /* fall through */
+    case 21: W[21] = W[22] + ((aws_mp_word)ai) * ((aws_mp_word)a2[22]) + ((aws_mp_word)mu) * ((aws_mp_word)m[22]); /* fall through */
+    case 22: W[22] = W[23] + ((aws_mp_word)ai) * ((aws_mp_word)a2[23]) + ((aws_mp_word)mu) * ((aws_mp_word)m[23]); /* fall through */
+    case 23: W[23] = W[24] + ((aws_mp_word)ai) * ((aws_mp_word)a2[24]) + ((aws_mp_word)mu) * ((aws_mp_word)m[24]); /* fall through */
+    case 24: W[24] = W[25] + ((aws_mp_word)ai) * ((aws_mp_word)a2[25]) + ((aws_mp_word)mu) * ((aws_mp_word)m[25]); /* fall through */
+    case 25: W[25] = W[26] + ((aws_mp_word)ai) * ((aws_mp_word)a2[26]) + ((aws_mp_word)mu) * ((aws_mp_word)m[26]); /* fall through */
+    case 26: W[26] = W[27] + ((aws_mp_word)ai) * ((aws_mp_word)a2[27]) + ((aws_mp_word)mu) * ((aws_mp_word)m[27]); /* fall through */
+    case 27: W[27] = W[28] + ((aws_mp_word)ai) * ((aws_mp_word)a2[28]) + ((aws_mp_word)mu) * ((aws_mp_word)m[28]); /* fall through */
+    case 28: W[28] = W[29] + ((aws_mp_word)ai) * ((aws_mp_word)a2[29]) + ((aws_mp_word)mu) * ((aws_mp_word)m[29]); /* fall through */
+    case 29: W[29] = W[30] + ((aws_mp_word)ai) * ((aws_mp_word)a2[30]) + ((aws_mp_word)mu) * ((aws_mp_word)m[30]); /* fall through */
+    case 30: W[30] = W[31] + ((aws_mp_word)ai) * ((aws_mp_word)a2[31]) + ((aws_mp_word)mu) * ((aws_mp_word)m[31]); /* fall through */
+    case 31: W[31] = W[32] + ((aws_mp_word)ai) * ((aws_mp_word)a2[32]) + ((aws_mp_word)mu) * ((aws_mp_word)m[32]); /* fall through */
+    case 32: W[32] = W[33] + ((aws_mp_word)ai) * ((aws_mp_word)a2[33]) + ((aws_mp_word)mu) * ((aws_mp_word)m[33]); /* fall through */
+    case 33: W[33] = W[34] + ((aws_mp_word)ai) * ((aws_mp_word)a2[34]) + ((aws_mp_word)mu) * ((aws_mp_word)m[34]); /* fall through */
+    case 34: W[34] = W[35] + ((aws_mp_word)ai) * ((aws_mp_word)a2[35]) + ((aws_mp_word)mu) * ((aws_mp_word)m[35]); /* fall through */
+    case 35: W[35] = W[36] + ((aws_mp_word)ai) * ((aws_mp_word)a2[36]) + ((aws_mp_word)mu) * ((aws_mp_word)m[36]); /* fall through */
+    case 36: W[36] = W[37] + ((aws_mp_word)ai) * ((aws_mp_word)a2[37]) + ((aws_mp_word)mu) * ((aws_mp_word)m[37]); /* fall through */
+    case 37: W[37] = W[38] + ((aws_mp_word)ai) * ((aws_mp_word)a2[38]) + ((aws_mp_word)mu) * ((aws_mp_word)m[38]); /* fall through */
+    case 38: W[38] = W[39] + ((aws_mp_word)ai) * ((aws_mp_word)a2[39]) + ((aws_mp_word)mu) * ((aws_mp_word)m[39]); /* fall through */
+    case 39: W[39] = W[40] + ((aws_mp_word)ai) * ((aws_mp_word)a2[40]) + ((aws_mp_word)mu) * ((aws_mp_word)m[40]); /* fall through */
+    case 40: W[40] = W[41] + ((aws_mp_word)ai) * ((aws_mp_word)a2[41]) + ((aws_mp_word)mu) * ((aws_mp_word)m[41]); /* fall through */
+    case 41: W[41] = W[42] + ((aws_mp_word)ai) * ((aws_mp_word)a2[42]) + ((aws_mp_word)mu) * ((aws_mp_word)m[42]); /* fall through */
+    case 42: W[42] = W[43] + ((aws_mp_word)ai) * ((aws_mp_word)a2[43]) + ((aws_mp_word)mu) * ((aws_mp_word)m[43]); /* fall through */
+    case 43: W[43] = W[44] + ((aws_mp_word)ai) * ((aws_mp_word)a2[44]) + ((aws_mp_word)mu) * ((aws_mp_word)m[44]); /* fall through */
+    case 44: W[44] = W[45] + ((aws_mp_word)ai) * ((aws_mp_word)a2[45]) + ((aws_mp_word)mu) * ((aws_mp_word)m[45]); /* fall through */
+    case 45: W[45] = W[46] + ((aws_mp_word)ai) * ((aws_mp_word)a2[46]) + ((aws_mp_word)mu) * ((aws_mp_word)m[46]); /* fall through */
+    case 46: W[46] = W[47] + ((aws_mp_word)ai) * ((aws_mp_word)a2[47]) + ((aws_mp_word)mu) * ((aws_mp_word)m[47]); /* fall through */
+    case 47: W[47] = W[48] + ((aws_mp_word)ai) * ((aws_mp_word)a2[48]) + ((aws_mp_word)mu) * ((aws_mp_word)m[48]); /* fall through */
+    case 48: W[48] = W[49] + ((aws_mp_word)ai) * ((aws_mp_word)a2[49]) + ((aws_mp_word)mu) * ((aws_mp_word)m[49]); /* fall through */
+    case 49: W[49] = W[50] + ((aws_mp_word)ai) * ((aws_mp_word)a2[50]) + ((aws_mp_word)mu) * ((aws_mp_word)m[50]); /* fall through */
+    case 50: W[50] = W[51] + ((aws_mp_word)ai) * ((aws_mp_word)a2[51]) + ((aws_mp_word)mu) * ((aws_mp_word)m[51]); /* fall through */
+    case 51: W[51] = W[52] + ((aws_mp_word)ai) * ((aws_mp_word)a2[52]) + ((aws_mp_word)mu) * ((aws_mp_word)m[52]); /* fall through */
+    case 52: W[52] = W[53] + ((aws_mp_word)ai) * ((aws_mp_word)a2[53]) + ((aws_mp_word)mu) * ((aws_mp_word)m[53]); /* fall through */
+    case 53: W[53] = W[54] + ((aws_mp_word)ai) * ((aws_mp_word)a2[54]) + ((aws_mp_word)mu) * ((aws_mp_word)m[54]); /* fall through */
+    case 54: W[54] = W[55] + ((aws_mp_word)ai) * ((aws_mp_word)a2[55]) + ((aws_mp_word)mu) * ((aws_mp_word)m[55]); /* fall through */
+    case 55: W[55] = W[56] + ((aws_mp_word)ai) * ((aws_mp_word)a2[56]) + ((aws_mp_word)mu) * ((aws_mp_word)m[56]); /* fall through */
+    case 56: W[56] = W[57] + ((aws_mp_word)ai) * ((aws_mp_word)a2[57]) + ((aws_mp_word)mu) * ((aws_mp_word)m[57]); /* fall through */
+    case 57: W[57] = W[58] + ((aws_mp_word)ai) * ((aws_mp_word)a2[58]) + ((aws_mp_word)mu) * ((aws_mp_word)m[58]); /* fall through */
+    case 58: W[58] = W[59] + ((aws_mp_word)ai) * ((aws_mp_word)a2[59]) + ((aws_mp_word)mu) * ((aws_mp_word)m[59]); /* fall through */
+    case 59: W[59] = W[60] + ((aws_mp_word)ai) * ((aws_mp_word)a2[60]) + ((aws_mp_word)mu) * ((aws_mp_word)m[60]); /* fall through */
+    case 60: W[60] = W[61] + ((aws_mp_word)ai) * ((aws_mp_word)a2[61]) + ((aws_mp_word)mu) * ((aws_mp_word)m[61]); /* fall through */
+    case 61: W[61] = W[62] + ((aws_mp_word)ai) * ((aws_mp_word)a2[62]) + ((aws_mp_word)mu) * ((aws_mp_word)m[62]); /* fall through */
+    case 62: W[62] = W[63] + ((aws_mp_word)ai) * ((aws_mp_word)a2[63]) + ((aws_mp_word)mu) * ((aws_mp_word)m[63]); /* fall through */
+    case 63: W[63] = W[64] + ((aws_mp_word)ai) * ((aws_mp_word)a2[64]) + ((aws_mp_word)mu) * ((aws_mp_word)m[64]); /* fall through */
+    case 64: W[64] = W[65] + ((aws_mp_word)ai) * ((aws_mp_word)a2[65]) + ((aws_mp_word)mu) * ((aws_mp_word)m[65]); /* fall through */
+    case 65: W[65] = W[66] + ((aws_mp_word)ai) * ((aws_mp_word)a2[66]) + ((aws_mp_word)mu) * ((aws_mp_word)m[66]); /* fall through */
+    case 66: W[66] = W[67] + ((aws_mp_word)ai) * ((aws_mp_word)a2[67]) + ((aws_mp_word)mu) * ((aws_mp_word)m[67]); /* fall through */
+    case 67: W[67] = W[68] + ((aws_mp_word)ai) * ((aws_mp_word)a2[68]) + ((aws_mp_word)mu) * ((aws_mp_word)m[68]); /* fall through */
+    case 68: W[68] = W[69] + ((aws_mp_word)ai) * ((aws_mp_word)a2[69]) + ((aws_mp_word)mu) * ((aws_mp_word)m[69]); /* fall through */
+    case 69: W[69] = W[70] + ((aws_mp_word)ai) * ((aws_mp_word)a2[70]) + ((aws_mp_word)mu) * ((aws_mp_word)m[70]); /* fall through */
+    case 70: W[70] = W[71] + ((aws_mp_word)ai) * ((aws_mp_word)a2[71]) + ((aws_mp_word)mu) * ((aws_mp_word)m[71]); /* fall through */
+    case 71: W[71] = W[72] + ((aws_mp_word)ai) * ((aws_mp_word)a2[72]) + ((aws_mp_word)mu) * ((aws_mp_word)m[72]); /* fall through */
+    case 72: W[72] = W[73] + ((aws_mp_word)ai) * ((aws_mp_word)a2[73]) + ((aws_mp_word)mu) * ((aws_mp_word)m[73]); /* fall through */
+    case 73: W[73] = W[74] + ((aws_mp_word)ai) * ((aws_mp_word)a2[74]) + ((aws_mp_word)mu) * ((aws_mp_word)m[74]); /* fall through */
+    case 74: W[74] = W[75] + ((aws_mp_word)ai) * ((aws_mp_word)a2[75]) + ((aws_mp_word)mu) * ((aws_mp_word)m[75]); /* fall through */
+    case 75: W[75] = W[76] + ((aws_mp_word)ai) * ((aws_mp_word)a2[76]) + ((aws_mp_word)mu) * ((aws_mp_word)m[76]); /* fall through */
+    case 76: W[76] = W[77] + ((aws_mp_word)ai) * ((aws_mp_word)a2[77]) + ((aws_mp_word)mu) * ((aws_mp_word)m[77]); /* fall through */
+    case 77: W[77] = W[78] + ((aws_mp_word)ai) * ((aws_mp_word)a2[78]) + ((aws_mp_word)mu) * ((aws_mp_word)m[78]); /* fall through */
+    case 78: W[78] = W[79] + ((aws_mp_word)ai) * ((aws_mp_word)a2[79]) + ((aws_mp_word)mu) * ((aws_mp_word)m[79]); /* fall through */
+    case 79: W[79] = W[80] + ((aws_mp_word)ai) * ((aws_mp_word)a2[80]) + ((aws_mp_word)mu) * ((aws_mp_word)m[80]); /* fall through */
+    case 80: W[80] = W[81] + ((aws_mp_word)ai) * ((aws_mp_word)a2[81]) + ((aws_mp_word)mu) * ((aws_mp_word)m[81]); /* fall through */
+    case 81: W[81] = W[82] + ((aws_mp_word)ai) * ((aws_mp_word)a2[82]) + ((aws_mp_word)mu) * ((aws_mp_word)m[82]); /* fall through */
+    case 82: W[82] = W[83] + ((aws_mp_word)ai) * ((aws_mp_word)a2[83]) + ((aws_mp_word)mu) * ((aws_mp_word)m[83]); /* fall through */
+    case 83: W[83] = W[84] + ((aws_mp_word)ai) * ((aws_mp_word)a2[84]) + ((aws_mp_word)mu) * ((aws_mp_word)m[84]); /* fall through */
+    case 84: W[84] = W[85] + ((aws_mp_word)ai) * ((aws_mp_word)a2[85]) + ((aws_mp_word)mu) * ((aws_mp_word)m[85]); /* fall through */
+    case 85: W[85] = W[86] + ((aws_mp_word)ai) * ((aws_mp_word)a2[86]) + ((aws_mp_word)mu) * ((aws_mp_word)m[86]); /* fall through */
+    case 86: W[86] = W[87] + ((aws_mp_word)ai) * ((aws_mp_word)a2[87]) + ((aws_mp_word)mu) * ((aws_mp_word)m[87]); /* fall through */
+    case 87: W[87] = W[88] + ((aws_mp_word)ai) * ((aws_mp_word)a2[88]) + ((aws_mp_word)mu) * ((aws_mp_word)m[88]); /* fall through */
+    case 88: W[88] = W[89] + ((aws_mp_word)ai) * ((aws_mp_word)a2[89]) + ((aws_mp_word)mu) * ((aws_mp_word)m[89]); /* fall through */
+    case 89: W[89] = W[90] + ((aws_mp_word)ai) * ((aws_mp_word)a2[90]) + ((aws_mp_word)mu) * ((aws_mp_word)m[90]); /* fall through */
+    case 90: W[90] = W[91] + ((aws_mp_word)ai) * ((aws_mp_word)a2[91]) + ((aws_mp_word)mu) * ((aws_mp_word)m[91]); /* fall through */
+    case 91: W[91] = W[92] + ((aws_mp_word)ai) * ((aws_mp_word)a2[92]) + ((aws_mp_word)mu) * ((aws_mp_word)m[92]); /* fall through */
+    case 92: W[92] = W[93] + ((aws_mp_word)ai) * ((aws_mp_word)a2[93]) + ((aws_mp_word)mu) * ((aws_mp_word)m[93]); /* fall through */
+    case 93: W[93] = W[94] + ((aws_mp_word)ai) * ((aws_mp_word)a2[94]) + ((aws_mp_word)mu) * ((aws_mp_word)m[94]); /* fall through */
+    case 94: W[94] = W[95] + ((aws_mp_word)ai) * ((aws_mp_word)a2[95]) + ((aws_mp_word)mu) * ((aws_mp_word)m[95]); /* fall through */
+    case 95: W[95] = W[96] + ((aws_mp_word)ai) * ((aws_mp_word)a2[96]) + ((aws_mp_word)mu) * ((aws_mp_word)m[96]); /* fall through */
+    case 96: W[96] = W[97] + ((aws_mp_word)ai) * ((aws_mp_word)a2[97]) + ((aws_mp_word)mu) * ((aws_mp_word)m[97]); /* fall through */
+    case 97: W[97] = W[98] + ((aws_mp_word)ai) * ((aws_mp_word)a2[98]) + ((aws_mp_word)mu) * ((aws_mp_word)m[98]); /* fall through */
+    case 98: W[98] = W[99] + ((aws_mp_word)ai) * ((aws_mp_word)a2[99]) + ((aws_mp_word)mu) * ((aws_mp_word)m[99]); /* fall through */
+    case 99: W[99] = W[100] + ((aws_mp_word)ai) * ((aws_mp_word)a2[100]) + ((aws_mp_word)mu) * ((aws_mp_word)m[100]); /* fall through */
+    case 100: W[100] = W[101] + ((aws_mp_word)ai) * ((aws_mp_word)a2[101]) + ((aws_mp_word)mu) * ((aws_mp_word)m[101]); /* fall through */
+    case 101: W[101] = W[102] + ((aws_mp_word)ai) * ((aws_mp_word)a2[102]) + ((aws_mp_word)mu) * ((aws_mp_word)m[102]); /* fall through */
+    case 102: W[102] = W[103] + ((aws_mp_word)ai) * ((aws_mp_word)a2[103]) + ((aws_mp_word)mu) * ((aws_mp_word)m[103]); /* fall through */
+    case 103: W[103] = W[104] + ((aws_mp_word)ai) * ((aws_mp_word)a2[104]) + ((aws_mp_word)mu) * ((aws_mp_word)m[104]); /* fall through */
+    case 104: W[104] = W[105] + ((aws_mp_word)ai) * ((aws_mp_word)a2[105]) + ((aws_mp_word)mu) * ((aws_mp_word)m[105]); /* fall through */
+    case 105: W[105] = W[106] + ((aws_mp_word)ai) * ((aws_mp_word)a2[106]) + ((aws_mp_word)mu) * ((aws_mp_word)m[106]); /* fall through */
+    case 106: W[106] = W[107] + ((aws_mp_word)ai) * ((aws_mp_word)a2[107]) + ((aws_mp_word)mu) * ((aws_mp_word)m[107]); /* fall through */
+    case 107: W[107] = W[108] + ((aws_mp_word)ai) * ((aws_mp_word)a2[108]) + ((aws_mp_word)mu) * ((aws_mp_word)m[108]); /* fall through */
+    case 108: W[108] = ((aws_mp_word)ai) * ((aws_mp_word)a2[109]) + ((aws_mp_word)mu) * ((aws_mp_word)m[109]); /* fall through */
+    default: break;
+    }
+    W[0] += r;
+  }
+}
+
+/* c = W with the carries resolved and m subtracted unless that borrows,
+ * both results are formed and one is picked by mask
+ */
+static void s_mp_fixed_out(aws_mp_word *W, const aws_mp_digit *m, aws_mp_digit *c)
+{
+  register aws_mp_word  r;
+  register aws_mp_digit d, u, mask;
+  aws_mp_digit t[110];
+
+  r = 0;
+  u = 0;
+  r += W[0]; c[0] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[0] - m[0] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[0] = d & AWS_MP_MASK;
+  r += W[1]; c[1] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[1] - m[1] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[1] = d & AWS_MP_MASK;
+  r += W[2]; c[2] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[2] - m[2] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[2] = d & AWS_MP_MASK;
+  r += W[3]; c[3] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[3] - m[3] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[3] = d & AWS_MP_MASK;
+  r += W[4]; c[4] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[4] - m[4] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[4] = d & AWS_MP_MASK;
+  r += W[5]; c[5] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[5] - m[5] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[5] = d & AWS_MP_MASK;
+  r += W[6]; c[6] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[6] - m[6] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[6] = d & AWS_MP_MASK;
+  r += W[7]; c[7] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[7] - m[7] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[7] = d & AWS_MP_MASK;
+  r += W[8]; c[8] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[8] - m[8] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[8] = d & AWS_MP_MASK;
+  r += W[9]; c[9] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[9] - m[9] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[9] = d & AWS_MP_MASK;
+  r += W[10]; c[10] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[10] - m[10] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[10] = d & AWS_MP_MASK;
+  r += W[11]; c[11] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[11] - m[11] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[11] = d & AWS_MP_MASK;
+  r += W[12]; c[12] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[12] - m[12] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[12] = d & AWS_MP_MASK;
+  r += W[13]; c[13] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[13] - m[13] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[13] = d & AWS_MP_MASK;
+  r += W[14]; c[14] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[14] - m[14] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[14] = d & AWS_MP_MASK;
+  r += W[15]; c[15] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[15] - m[15] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[15] = d & AWS_MP_MASK;
+  r += W[16]; c[16] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[16] - m[16] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[16] = d & AWS_MP_MASK;
+  r += W[17]; c[17] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[17] - m[17] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[17] = d & AWS_MP_MASK;
+  r += W[18]; c[18] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[18] - m[18] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[18] = d & AWS_MP_MASK;
+  r += W[19]; c[19] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[19] - m[19] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[19] = d & AWS_MP_MASK;
+  r += W[20]; c[20] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[20] - m[20] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[20] = d & AWS_MP_MASK;
+  r += W[21]; c[21] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[21] - m[21] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[21] = d & AWS_MP_MASK;
+  r += W[22]; c[22] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[22] - m[22] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[22] = d & AWS_MP_MASK;
+  r += W[23]; c[23] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[23] - m[23] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[23] = d & AWS_MP_MASK;
+  r += W[24]; c[24] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[24] - m[24] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[24] = d & AWS_MP_MASK;
+  r += W[25]; c[25] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[25] - m[25] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[25] = d & AWS_MP_MASK;
+  r += W[26]; c[26] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[26] - m[26] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[26] = d & AWS_MP_MASK;
+  r += W[27]; c[27] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[27] - m[27] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[27] = d & AWS_MP_MASK;
+  r += W[28]; c[28] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[28] - m[28] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[28] = d & AWS_MP_MASK;
+  r += W[29]; c[29] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[29] - m[29] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[29] = d & AWS_MP_MASK;
+  r += W[30]; c[30] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[30] - m[30] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[30] = d & AWS_MP_MASK;
+  r += W[31]; c[31] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[31] - m[31] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[31] = d & AWS_MP_MASK;
+  r += W[32]; c[32] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[32] - m[32] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[32] = d & AWS_MP_MASK;
+  r += W[33]; c[33] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[33] - m[33] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[33] = d & AWS_MP_MASK;
+  r += W[34]; c[34] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[34] - m[34] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[34] = d & AWS_MP_MASK;
+  r += W[35]; c[35] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[35] - m[35] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[35] = d & AWS_MP_MASK;
+  r += W[36]; c[36] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[36] - m[36] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[36] = d & AWS_MP_MASK;
+  r += W[37]; c[37] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[37] - m[37] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[37] = d & AWS_MP_MASK;
+  r += W[38]; c[38] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[38] - m[38] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[38] = d & AWS_MP_MASK;
+  r += W[39]; c[39] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[39] - m[39] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[39] = d & AWS_MP_MASK;
+  r += W[40]; c[40] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[40] - m[40] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[40] = d & AWS_MP_MASK;
+  r += W[41]; c[41] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[41] - m[41] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[41] = d & AWS_MP_MASK;
+  r += W[42]; c[42] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[42] - m[42] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[42] = d & AWS_MP_MASK;
+  r += W[43]; c[43] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[43] - m[43] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[43] = d & AWS_MP_MASK;
+  r += W[44]; c[44] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[44] - m[44] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[44] = d & AWS_MP_MASK;
+  r += W[45]; c[45] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[45] - m[45] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[45] = d & AWS_MP_MASK;
+  r += W[46]; c[46] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[46] - m[46] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[46] = d & AWS_MP_MASK;
+  r += W[47]; c[47] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[47] - m[47] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[47] = d & AWS_MP_MASK;
+  r += W[48]; c[48] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[48] - m[48] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[48] = d & AWS_MP_MASK;
+  r += W[49]; c[49] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[49] - m[49] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[49] = d & AWS_MP_MASK;
+  r += W[50]; c[50] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[50] - m[50] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[50] = d & AWS_MP_MASK;
+  r += W[51]; c[51] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[51] - m[51] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[51] = d & AWS_MP_MASK;
+  r += W[52]; c[52] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[52] - m[52] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[52] = d & AWS_MP_MASK;
+  r += W[53]; c[53] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[53] - m[53] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[53] = d & AWS_MP_MASK;
+  r += W[54]; c[54] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[54] - m[54] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[54] = d & AWS_MP_MASK;
+  r += W[55]; c[55] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[55] - m[55] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[55] = d & AWS_MP_MASK;
+  r += W[56]; c[56] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[56] - m[56] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[56] = d & AWS_MP_MASK;
+  r += W[57]; c[57] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[57] - m[57] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[57] = d & AWS_MP_MASK;
+  r += W[58]; c[58] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[58] - m[58] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[58] = d & AWS_MP_MASK;
+  r += W[59]; c[59] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[59] - m[59] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[59] = d & AWS_MP_MASK;
+  r += W[60]; c[60] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[60] - m[60] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[60] = d & AWS_MP_MASK;
+  r += W[61]; c[61] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[61] - m[61] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[61] = d & AWS_MP_MASK;
+  r += W[62]; c[62] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[62] - m[62] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[62] = d & AWS_MP_MASK;
+  r += W[63]; c[63] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[63] - m[63] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[63] = d & AWS_MP_MASK;
+  r += W[64]; c[64] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[64] - m[64] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[64] = d & AWS_MP_MASK;
+  r += W[65]; c[65] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[65] - m[65] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[65] = d & AWS_MP_MASK;
+  r += W[66]; c[66] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[66] - m[66] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[66] = d & AWS_MP_MASK;
+  r += W[67]; c[67] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[67] - m[67] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[67] = d & AWS_MP_MASK;
+  r += W[68]; c[68] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[68] - m[68] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[68] = d & AWS_MP_MASK;
+  r += W[69]; c[69] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[69] - m[69] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[69] = d & AWS_MP_MASK;
+  r += W[70]; c[70] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[70] - m[70] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[70] = d & AWS_MP_MASK;
+  r += W[71]; c[71] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[71] - m[71] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[71] = d & AWS_MP_MASK;
+  r += W[72]; c[72] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[72] - m[72] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[72] = d & AWS_MP_MASK;
+  r += W[73]; c[73] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[73] - m[73] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[73] = d & AWS_MP_MASK;
+  r += W[74]; c[74] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[74] - m[74] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[74] = d & AWS_MP_MASK;
+  r += W[75]; c[75] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[75] - m[75] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[75] = d & AWS_MP_MASK;
+  r += W[76]; c[76] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[76] - m[76] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[76] = d & AWS_MP_MASK;
+  r += W[77]; c[77] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[77] - m[77] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[77] = d & AWS_MP_MASK;
+  r += W[78]; c[78] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[78] - m[78] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[78] = d & AWS_MP_MASK;
+  r += W[79]; c[79] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[79] - m[79] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[79] = d & AWS_MP_MASK;
+  r += W[80]; c[80] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[80] - m[80] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[80] = d & AWS_MP_MASK;
+  r += W[81]; c[81] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[81] - m[81] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[81] = d & AWS_MP_MASK;
+  r += W[82]; c[82] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[82] - m[82] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[82] = d & AWS_MP_MASK;
+  r += W[83]; c[83] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[83] - m[83] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[83] = d & AWS_MP_MASK;
+  r += W[84]; c[84] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[84] - m[84] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[84] = d & AWS_MP_MASK;
+  r += W[85]; c[85] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[85] - m[85] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[85] = d & AWS_MP_MASK;
+  r += W[86]; c[86] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[86] - m[86] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[86] = d & AWS_MP_MASK;
+  r += W[87]; c[87] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[87] - m[87] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[87] = d & AWS_MP_MASK;
+  r += W[88]; c[88] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[88] - m[88] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[88] = d & AWS_MP_MASK;
+  r += W[89]; c[89] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[89] - m[89] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[89] = d & AWS_MP_MASK;
+  r += W[90]; c[90] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[90] - m[90] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[90] = d & AWS_MP_MASK;
+  r += W[91]; c[91] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[91] - m[91] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[91] = d & AWS_MP_MASK;
+  r += W[92]; c[92] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[92] - m[92] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[92] = d & AWS_MP_MASK;
+  r += W[93]; c[93] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[93] - m[93] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[93] = d & AWS_MP_MASK;
+  r += W[94]; c[94] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[94] - m[94] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[94] = d & AWS_MP_MASK;
+  r += W[95]; c[95] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[95] - m[95] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[95] = d & AWS_MP_MASK;
+  r += W[96]; c[96] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[96] - m[96] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[96] = d & AWS_MP_MASK;
+  r += W[97]; c[97] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[97] - m[97] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[97] = d & AWS_MP_MASK;
+  r += W[98]; c[98] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[98] - m[98] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[98] = d & AWS_MP_MASK;
+  r += W[99]; c[99] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[99] - m[99] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[99] = d & AWS_MP_MASK;
+  r += W[100]; c[100] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[100] - m[100] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[100] = d & AWS_MP_MASK;
+  r += W[101]; c[101] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[101] - m[101] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[101] = d & AWS_MP_MASK;
+  r += W[102]; c[102] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[102] - m[102] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[102] = d & AWS_MP_MASK;
+  r += W[103]; c[103] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[103] - m[103] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[103] = d & AWS_MP_MASK;
+  r += W[104]; c[104] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[104] - m[104] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[104] = d & AWS_MP_MASK;
+  r += W[105]; c[105] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[105] - m[105] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[105] = d & AWS_MP_MASK;
+  r += W[106]; c[106] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[106] - m[106] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[106] = d & AWS_MP_MASK;
+  r += W[107]; c[107] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[107] - m[107] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[107] = d & AWS_MP_MASK;
+  r += W[108]; c[108] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[108] - m[108] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[108] = d & AWS_MP_MASK;
+  r += W[109]; c[109] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  d = c[109] - m[109] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[109] = d & AWS_MP_MASK;
+
+  /* keep c only if c - m went negative, i.e. borrowed past the top digit */
+  mask = (aws_mp_digit)0 - (u & (((aws_mp_digit)r) ^ 1u));
+  c[0] = (c[0] & mask) | (t[0] & ~mask);
+  c[1] = (c[1] & mask) | (t[1] & ~mask);
+  c[2] = (c[2] & mask) | (t[2] & ~mask);
+  c[3] = (c[3] & mask) | (t[3] & ~mask);
+  c[4] = (c[4] & mask) | (t[4] & ~mask);
+  c[5] = (c[5] & mask) | (t[5] & ~mask);
+  c[6] = (c[6] & mask) | (t[6] & ~mask);
+  c[7] = (c[7] & mask) | (t[7] & ~mask);
+  c[8] = (c[8] & mask) | (t[8] & ~mask);
+  c[9] = (c[9] & mask) | (t[9] & ~mask);
+  c[10] = (c[10] & mask) | (t[10] & ~mask);
+  c[11] = (c[11] & mask) | (t[11] & ~mask);
+  c[12] = (c[12] & mask) | (t[12] & ~mask);
+  c[13] = (c[13] & mask) | (t[13] & ~mask);
+  c[14] = (c[14] & mask) | (t[14] & ~mask);
+  c[15] = (c[15] & mask) | (t[15] & ~mask);
+  c[16] = (c[16] & mask) | (t[16] & ~mask);
+  c[17] = (c[17] & mask) | (t[17] & ~mask);
+  c[18] = (c[18] & mask) | (t[18] & ~mask);
+  c[19] = (c[19] & mask) | (t[19] & ~mask);
+  c[20] = (c[20] & mask) | (t[20] & ~mask);
+  c[21] = (c[21] & mask) | (t[21] & ~mask);
+  c[22] = (c[22] & mask) | (t[22] & ~mask);
+  c[23] = (c[23] & mask) | (t[23] & ~mask);
+  c[24] = (c[24] & mask) | (t[24] & ~mask);
+  c[25] = (c[25] & mask) | (t[25] & ~mask);
+  c[26] = (c[26] & mask) | (t[26] & ~mask);
+  c[27] = (c[27] & mask) | (t[27] & ~mask);
+  c[28] = (c[28] & mask) | (t[28] & ~mask);
+  c[29] = (c[29] & mask) | (t[29] & ~mask);
+  c[30] = (c[30] & mask) | (t[30] & ~mask);
+  c[31] = (c[31] & mask) | (t[31] & ~mask);
+  c[32] = (c[32] & mask) | (t[32] & ~mask);
+  c[33] = (c[33] & mask) | (t[33] & ~mask);
+  c[34] = (c[34] & mask) | (t[34] & ~mask);
+  c[35] = (c[35] & mask) | (t[35] & ~mask);
+  c[36] = (c[36] & mask) | (t[36] & ~mask);
+  c[37] = (c[37] & mask) | (t[37] & ~mask);
+  c[38] = (c[38] & mask) | (t[38] & ~mask);
+  c[39] = (c[39] & mask) | (t[39] & ~mask);
+  c[40] = (c[40] & mask) | (t[40] & ~mask);
+  c[41] = (c[41] & mask) | (t[41] & ~mask);
+  c[42] = (c[42] & mask) | (t[42] & ~mask);
+  c[43] = (c[43] & mask) | (t[43] & ~mask);
+  c[44] = (c[44] & mask) | (t[44] & ~mask);
+  c[45] = (c[45] & mask) | (t[45] & ~mask);
+  c[46] = (c[46] & mask) | (t[46] & ~mask);
+  c[47] = (c[47] & mask) | (t[47] & ~mask);
+  c[48] = (c[48] & mask) | (t[48] & ~mask);
+  c[49] = (c[49] & mask) | (t[49] & ~mask);
+  c[50] = (c[50] & mask) | (t[50] & ~mask);
+  c[51] = (c[51] & mask) | (t[51] & ~mask);
+  c[52] = (c[52] & mask) | (t[52] & ~mask);
+  c[53] = (c[53] & mask) | (t[53] & ~mask);
+  c[54] = (c[54] & mask) | (t[54] & ~mask);
+  c[55] = (c[55] & mask) | (t[55] & ~mask);
+  c[56] = (c[56] & mask) | (t[56] & ~mask);
+  c[57] = (c[57] & mask) | (t[57] & ~mask);
+  c[58] = (c[58] & mask) | (t[58] & ~mask);
+  c[59] = (c[59] & mask) | (t[59] & ~mask);
+  c[60] = (c[60] & mask) | (t[60] & ~mask);
+  c[61] = (c[61] & mask) | (t[61] & ~mask);
+  c[62] = (c[62] & mask) | (t[62] & ~mask);
+  c[63] = (c[63] & mask) | (t[63] & ~mask);
+  c[64] = (c[64] & mask) | (t[64] & ~mask);
+  c[65] = (c[65] & mask) | (t[65] & ~mask);
+  c[66] = (c[66] & mask) | (t[66] & ~mask);
+  c[67] = (c[67] & mask) | (t[67] & ~mask);
+  c[68] = (c[68] & mask) | (t[68] & ~mask);
+  c[69] = (c[69] & mask) | (t[69] & ~mask);
+  c[70] = (c[70] & mask) | (t[70] & ~mask);
+  c[71] = (c[71] & mask) | (t[71] & ~mask);
+  c[72] = (c[72] & mask) | (t[72] & ~mask);
+  c[73] = (c[73] & mask) | (t[73] & ~mask);
+  c[74] = (c[74] & mask) | (t[74] & ~mask);
+  c[75] = (c[75] & mask) | (t[75] & ~mask);
+  c[76] = (c[76] & mask) | (t[76] & ~mask);
+  c[77] = (c[77] & mask) | (t[77] & ~mask);
+  c[78] = (c[78] & mask) | (t[78] & ~mask);
+  c[79] = (c[79] & mask) | (t[79] & ~mask);
+  c[80] = (c[80] & mask) | (t[80] & ~mask);
+  c[81] = (c[81] & mask) | (t[81] & ~mask);
+  c[82] = (c[82] & mask) | (t[82] & ~mask);
+  c[83] = (c[83] & mask) | (t[83] & ~mask);
+  c[84] = (c[84] & mask) | (t[84] & ~mask);
+  c[85] = (c[85] & mask) | (t[85] & ~mask);
+  c[86] = (c[86] & mask) | (t[86] & ~mask);
+  c[87] = (c[87] & mask) | (t[87] & ~mask);
+  c[88] = (c[88] & mask) | (t[88] & ~mask);
+  c[89] = (c[89] & mask) | (t[89] & ~mask);
+  c[90] = (c[90] & mask) | (t[90] & ~mask);
+  c[91] = (c[91] & mask) | (t[91] & ~mask);
+  c[92] = (c[92] & mask) | (t[92] & ~mask);
+  c[93] = (c[93] & mask) | (t[93] & ~mask);
+  c[94] = (c[94] & mask) | (t[94] & ~mask);
+  c[95] = (c[95] & mask) | (t[95] & ~mask);
+  c[96] = (c[96] & mask) | (t[96] & ~mask);
+  c[97] = (c[97] & mask) | (t[97] & ~mask);
+  c[98] = (c[98] & mask) | (t[98] & ~mask);
+  c[99] = (c[99] & mask) | (t[99] & ~mask);
+  c[100] = (c[100] & mask) | (t[100] & ~mask);
+  c[101] = (c[101] & mask) | (t[101] & ~mask);
+  c[102] = (c[102] & mask) | (t[102] & ~mask);
+  c[103] = (c[103] & mask) | (t[103] & ~mask);
+  c[104] = (c[104] & mask) | (t[104] & ~mask);
+  c[105] = (c[105] & mask) | (t[105] & ~mask);
+  c[106] = (c[106] & mask) | (t[106] & ~mask);
+  c[107] = (c[107] & mask) | (t[107] & ~mask);
+  c[108] = (c[108] & mask) | (t[108] & ~mask);
+  c[109] = (c[109] & mask) | (t[109] & ~mask);
+}
+
+/* W = xR**-1 (mod m) as 110 uncarried columns for x < mR padded to 220 digits,
+ * see aws_fast_mp_montgomery_reduce
+ */
+static void s_mp_fixed_reduce_cols(const aws_mp_digit *x, const aws_mp_digit *m, aws_mp_digit rho, aws_mp_word *W)
+{
+  int ix;
+  register aws_mp_digit mu;
+  register aws_mp_word  r;
+
+  for (ix = 0; ix < 110; ix++) {
+    W[ix] = x[ix];
+  }
+
+  for (ix = 0; ix < 110; ix++) {
+    r  = W[0];
+    mu = (aws_mp_digit)(((r & ((aws_mp_word)AWS_MP_MASK)) * ((aws_mp_word)rho)) & ((aws_mp_word)AWS_MP_MASK));
+    r  = (r + ((aws_mp_word)mu) * ((aws_mp_word)m[0])) >> ((aws_mp_word)AWS_DIGIT_BIT);
+    W[0] = W[1] + ((aws_mp_word)mu) * ((aws_mp_word)m[1]);
+    W[1] = W[2] + ((aws_mp_word)mu) * ((aws_mp_word)m[2]);
+    W[2] = W[3] + ((aws_mp_word)mu) * ((aws_mp_word)m[3]);
+    W[3] = W[4] + ((aws_mp_word)mu) * ((aws_mp_word)m[4]);
+    W[4] = W[5] + ((aws_mp_word)mu) * ((aws_mp_word)m[5]);
+    W[5] = W[6] + ((aws_mp_word)mu) * ((aws_mp_word)m[6]);
+    W[6] = W[7] + ((aws_mp_word)mu) * ((aws_mp_word)m[7]);
+    W[7] = W[8] + ((aws_mp_word)mu) * ((aws_mp_word)m[8]);
+    W[8] = W[9] + ((aws_mp_word)mu) * ((aws_mp_word)m[9]);
+    W[9] = W[10] + ((aws_mp_word)mu) * ((aws_mp_word)m[10]);
+    W[10] = W[11] + ((aws_mp_word)mu) * ((aws_mp_word)m[11]);
+    W[11] = W[12] + ((aws_mp_word)mu) * ((aws_mp_word)m[12]);
+    W[12] = W[13] + ((aws_mp_word)mu) * ((aws_mp_word)m[13]);
+    W[13] = W[14] + ((aws_mp_word)mu) * ((aws_mp_word)m[14]);
+    W[14] = W[15] + ((aws_mp_word)mu) * ((aws_mp_word)m[15]);
+    W[15] = W[16] + ((aws_mp_word)mu) * ((aws_mp_word)m[16]);
+    W[16] = W[17] + ((aws_mp_word)mu) * ((aws_mp_word)m[17]);
+    W[17] = W[18] + ((aws_mp_word)mu) * ((aws_mp_word)m[18]);
+    W[18] = W[19] + ((aws_mp_word)mu) * ((aws_mp_word)m[19]);
+    W[19] = W[20] + ((aws_mp_word)mu) * ((aws_mp_word)m[20]);
+    W[20] = W[21] + ((aws_mp_word)mu) * ((aws_mp_word)m[21]);
+    W[21] = W[22] + ((aws_mp_word)mu) * ((aws_mp_word)m[22]);
+    W[22] = W[23] + ((aws_mp_word)mu) * ((aws_mp_word)m[23]);
+    W[23] = W[24] + ((aws_mp_word)mu) * ((aws_mp_word)m[24]);
+    W[24] = W[25] + ((aws_mp_word)mu) * ((aws_mp_word)m[25]);
+    W[25] = W[26] + ((aws_mp_word)mu) * ((aws_mp_word)m[26]);
+    W[26] = W[27] + ((aws_mp_word)mu) * ((aws_mp_word)m[27]);
+    W[27] = W[28] + ((aws_mp_word)mu) * ((aws_mp_word)m[28]);
+    W[28] = W[29] + ((aws_mp_word)mu) * ((aws_mp_word)m[29]);
+    W[29] = W[30] + ((aws_mp_word)mu) * ((aws_mp_word)m[30]);
+    W[30] = W[31] + ((aws_mp_word)mu) * ((aws_mp_word)m[31]);
+    W[31] = W[32] + ((aws_mp_word)mu) * ((aws_mp_word)m[32]);
+    W[32] = W[33] + ((aws_mp_word)mu) * ((aws_mp_word)m[33]);
+    W[33] = W[34] + ((aws_mp_word)mu) * ((aws_mp_word)m[34]);
+    W[34] = W[35] + ((aws_mp_word)mu) * ((aws_mp_word)m[35]);
+    W[35] = W[36] + ((aws_mp_word)mu) * ((aws_mp_word)m[36]);
+    W[36] = W[37] + ((aws_mp_word)mu) * ((aws_mp_word)m[37]);
+    W[37] = W[38] + ((aws_mp_word)mu) * ((aws_mp_word)m[38]);
+    W[38] = W[39] + ((aws_mp_word)mu) * ((aws_mp_word)m[39]);
+    W[39] = W[40] + ((aws_mp_word)mu) * ((aws_mp_word)m[40]);
+    W[40] = W[41] + ((aws_mp_word)mu) * ((aws_mp_word)m[41]);
+    W[41] = W[42] + ((aws_mp_word)mu) * ((aws_mp_word)m[42]);
+    W[42] = W[43] + ((aws_mp_word)mu) * ((aws_mp_word)m[43]);
+    W[43] = W[44] + ((aws_mp_word)mu) * ((aws_mp_word)m[44]);
+    W[44] = W[45] + ((aws_mp_word)mu) * ((aws_mp_word)m[45]);
+    W[45] = W[46] + ((aws_mp_word)mu) * ((aws_mp_word)m[46]);
+    W[46] = W[47] + ((aws_mp_word)mu) * ((aws_mp_word)m[47]);
+    W[47] = W[48] + ((aws_mp_word)mu) * ((aws_mp_word)m[48]);
+    W[48] = W[49] + ((aws_mp_word)mu) * ((aws_mp_word)m[49]);
+    W[49] = W[50] + ((aws_mp_word)mu) * ((aws_mp_word)m[50]);
+    W[50] = W[51] + ((aws_mp_word)mu) * ((aws_mp_word)m[51]);
+    W[51] = W[52] + ((aws_mp_word)mu) * ((aws_mp_word)m[52]);
+    W[52] = W[53] + ((aws_mp_word)mu) * ((aws_mp_word)m[53]);
+    W[53] = W[54] + ((aws_mp_word)mu) * ((aws_mp_word)m[54]);
+    W[54] = W[55] + ((aws_mp_word)mu) * ((aws_mp_word)m[55]);
+    W[55] = W[56] + ((aws_mp_word)mu) * ((aws_mp_word)m[56]);
+    W[56] = W[57] + ((aws_mp_word)mu) * ((aws_mp_word)m[57]);
+    W[57] = W[58] + ((aws_mp_word)mu) * ((aws_mp_word)m[58]);
+    W[58] = W[59] + ((aws_mp_word)mu) * ((aws_mp_word)m[59]);
+    W[59] = W[60] + ((aws_mp_word)mu) * ((aws_mp_word)m[60]);
+    W[60] = W[61] + ((aws_mp_word)mu) * ((aws_mp_word)m[61]);
+    W[61] = W[62] + ((aws_mp_word)mu) * ((aws_mp_word)m[62]);
+    W[62] = W[63] + ((aws_mp_word)mu) * ((aws_mp_word)m[63]);
+    W[63] = W[64] + ((aws_mp_word)mu) * ((aws_mp_word)m[64]);
+    W[64] = W[65] + ((aws_mp_word)mu) * ((aws_mp_word)m[65]);
+    W[65] = W[66] + ((aws_mp_word)mu) * ((aws_mp_word)m[66]);
+    W[66] = W[67] + ((aws_mp_word)mu) * ((aws_mp_word)m[67]);
+    W[67] = W[68] + ((aws_mp_word)mu) * ((aws_mp_word)m[68]);
+    W[68] = W[69] + ((aws_mp_word)mu) * ((aws_mp_word)m[69]);
+    W[69] = W[70] + ((aws_mp_word)mu) * ((aws_mp_word)m[70]);
+    W[70] = W[71] + ((aws_mp_word)mu) * ((aws_mp_word)m[71]);
+    W[71] = W[72] + ((aws_mp_word)mu) * ((aws_mp_word)m[72]);
+    W[72] = W[73] + ((aws_mp_word)mu) * ((aws_mp_word)m[73]);
+    W[73] = W[74] + ((aws_mp_word)mu) * ((aws_mp_word)m[74]);
+    W[74] = W[75] + ((aws_mp_word)mu) * ((aws_mp_word)m[75]);
+    W[75] = W[76] + ((aws_mp_word)mu) * ((aws_mp_word)m[76]);
+    W[76] = W[77] + ((aws_mp_word)mu) * ((aws_mp_word)m[77]);
+    W[77] = W[78] + ((aws_mp_word)mu) * ((aws_mp_word)m[78]);
+    W[78] = W[79] + ((aws_mp_word)mu) * ((aws_mp_word)m[79]);
+    W[79] = W[80] + ((aws_mp_word)mu) * ((aws_mp_word)m[80]);
+    W[80] = W[81] + ((aws_mp_word)mu) * ((aws_mp_word)m[81]);
+    W[81] = W[82] + ((aws_mp_word)mu) * ((aws_mp_word)m[82]);
+    W[82] = W[83] + ((aws_mp_word)mu) * ((aws_mp_word)m[83]);
+    W[83] = W[84] + ((aws_mp_word)mu) * ((aws_mp_word)m[84]);
+    W[84] = W[85] + ((aws_mp_word)mu) * ((aws_mp_word)m[85]);
+    W[85] = W[86] + ((aws_mp_word)mu) * ((aws_mp_word)m[86]);
+    W[86] = W[87] + ((aws_mp_word)mu) * ((aws_mp_word)m[87]);
+    W[87] = W[88] + ((aws_mp_word)mu) * ((aws_mp_word)m[88]);
+    W[88] = W[89] + ((aws_mp_word)mu) * ((aws_mp_word)m[89]);
+    W[89] = W[90] + ((aws_mp_word)mu) * ((aws_mp_word)m[90]);
+    W[90] = W[91] + ((aws_mp_word)mu) * ((aws_mp_word)m[91]);
+    W[91] = W[92] + ((aws_mp_word)mu) * ((aws_mp_word)m[92]);
+    W[92] = W[93] + ((aws_mp_word)mu) * ((aws_mp_word)m[93]);
+    W[93] = W[94] + ((aws_mp_word)mu) * ((aws_mp_word)m[94]);
+    W[94] = W[95] + ((aws_mp_word)mu) * ((aws_mp_word)m[95]);
+    W[95] = W[96] + ((aws_mp_word)mu) * ((aws_mp_word)m[96]);
+    W[96] = W[97] + ((aws_mp_word)mu) * ((aws_mp_word)m[97]);
+    W[97] = W[98] + ((aws_mp_word)mu) * ((aws_mp_word)m[98]);
+    W[98] = W[99] + ((aws_mp_word)mu) * ((aws_mp_word)m[99]);
+    W[99] = W[100] + ((aws_mp_word)mu) * ((aws_mp_word)m[100]);
+    W[100] = W[101] + ((aws_mp_word)mu) * ((aws_mp_word)m[101]);
+    W[101] = W[102] + ((aws_mp_word)mu) * ((aws_mp_word)m[102]);
+    W[102] = W[103] + ((aws_mp_word)mu) * ((aws_mp_word)m[103]);
+    W[103] = W[104] + ((aws_mp_word)mu) * ((aws_mp_word)m[104]);
+    W[104] = W[105] + ((aws_mp_word)mu) * ((aws_mp_word)m[105]);
+    W[105] = W[106] + ((aws_mp_word)mu) * ((aws_mp_word)m[106]);
+    W[106] = W[107] + ((aws_mp_word)mu) * ((aws_mp_word)m[107]);
+    W[107] = W[108] + ((aws_mp_word)mu) * ((aws_mp_word)m[108]);
+    W[108] = W[109] + ((aws_mp_word)mu) * ((aws_mp_word)m[109]);
+    W[109] = x[ix + 110];
+    W[0] += r;
+  }
+}
+
+#endif
@@ -210,6 +210,18 @@ int aws_mp_init(aws_mp_int *a)
 {
   int i;
 
+#ifdef AWS_MP_INLINE_DIGS
+  /* start out in the inline digits */
+  a->dp = a->inl;
+  for (i = 0; i < AWS_MP_INLINE_DIGS; i++) {
+      a->dp[i] = 0;
+  }
+  a->used  = 0;
+  a->alloc = AWS_MP_INLINE_DIGS;
+  a->sign  = AWS_MP_ZPOS;
+  return AWS_MP_OKAY;
+#endif
+
   /* allocate memory required and clear it */
   a->dp = AWS_OPT_CAST(aws_mp_digit) AWS_XMALLOC (sizeof (aws_mp_digit) * AWS_MP_PREC);
   if (a->dp == NULL) {
@@ -275,8 +287,17 @@ aws_mp_toom_sqr(aws_mp_int *a, aws_mp_int *b)
     aws_mp_int w0, w1, w2, w3, w4, tmp1, a0, a1, a2;
     int res, B;
 
-    /* init temps */
-    if ((res = aws_mp_init_multi(&w0, &w1, &w2, &w3, &w4, &a0, &a1, &a2, &tmp1, NULL)) != AWS_MP_OKAY) {
+    /* init temps from the scratch arena, the w's and tmp1 are shifted up to
+     * the size of the square, the pieces of a stay below a->used digits
+     */
+    aws_mp_scratch_begin();
+    if ((res = aws_mp_init_multi_scratch(a->used * 2, &w0, &w1, &w2, &w3, &w4, &tmp1, NULL)) != AWS_MP_OKAY) {
+       aws_mp_scratch_end();
+       return res;
+    }
+    if ((res = aws_mp_init_multi_scratch(a->used + 2, &a0, &a1, &a2, NULL)) != AWS_MP_OKAY) {
+       aws_mp_clear_multi(&w0, &w1, &w2, &w3, &w4, &tmp1, NULL);
+       aws_mp_scratch_end();
        return res;
     }
 
@@ -469,6 +490,7 @@ aws_mp_toom_sqr(aws_mp_int *a, aws_mp_int *b)
 
 ERR:
 aws_mp_clear_multi(&w0, &w1, &w2, &w3, &w4, &a0, &a1, &a2, &tmp1, NULL);
+     aws_mp_scratch_end();
      return res;
 }
 
@@ -671,11 +693,77 @@ int aws_mp_reduce_is_2k(aws_mp_int *a)
  
 */
 
-int     AWS_KARATSUBA_MUL_CUTOFF = 80,      /* Min. number of digits before Karatsuba multiplication is used. */
-        AWS_KARATSUBA_SQR_CUTOFF = 120,     /* Min. number of digits before Karatsuba squaring is used. */
+const int AWS_KARATSUBA_MUL_CUTOFF = AWS_MP_KARATSUBA_MUL_DEFAULT,      /* Min. number of digits before Karatsuba multiplication is used. */
+        AWS_KARATSUBA_SQR_CUTOFF = AWS_MP_KARATSUBA_SQR_DEFAULT,      /* Min. number of digits before Karatsuba squaring is used. */
         
-        AWS_TOOM_MUL_CUTOFF = 350,      /* no optimal values of these are known yet so set em high */
-        AWS_TOOM_SQR_CUTOFF = 400;
+        AWS_TOOM_MUL_CUTOFF = AWS_MP_TOOM_MUL_DEFAULT,      /* see tools/tommath/tune.c for measuring these */
+        AWS_TOOM_SQR_CUTOFF = AWS_MP_TOOM_SQR_DEFAULT,
+
+        AWS_DIV_RECURSIVE_CUTOFF = AWS_MP_DIV_RECURSIVE_DEFAULT,  /* Min. quotient and divisor digits for recursive division. */
+
+        AWS_NTT_CUTOFF = AWS_MP_NTT_DEFAULT;      /* Min. number of digits before transform multiplication is used. */
+
+/* The cutoffs aws_mp_mul/aws_mp_sqr/aws_mp_div actually go by, 10 bits each and
+ * 14 for the transforms in one word that is read and written in a single access.  An operation picks its
+ * algorithm from one snapshot, so aws_mp_set_cutoffs() never needs a lock.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+   #define AWS_MP_CUTOFFS_LOAD(p)     __atomic_load_n((p), __ATOMIC_RELAXED)
+   #define AWS_MP_CUTOFFS_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#elif defined(_MSC_VER)
+   #include <intrin.h>
+   #define AWS_MP_CUTOFFS_LOAD(p)     ((ulong64)_InterlockedCompareExchange64((volatile __int64 *)(p), 0, 0))
+   #define AWS_MP_CUTOFFS_STORE(p, v) ((void)_InterlockedExchange64((volatile __int64 *)(p), (__int64)(v)))
+#else
+   #define AWS_MP_CUTOFFS_LOAD(p)     (*(p))
+   #define AWS_MP_CUTOFFS_STORE(p, v) (*(p) = (v))
+#endif
+
+/* a cutoff from the largest value of its field up is stored as the field's
+ * largest value, which reads back as AWS_MP_CUTOFF_OFF */
+#define AWS_MP_CUTOFF_FIELD(x, max) ((ulong64)((x) >= (max) ? (max) : (x)))
+#define AWS_MP_CUTOFF_READ(f, max)  ((f) == (max) ? AWS_MP_CUTOFF_OFF : (f))
+
+#define AWS_MP_CUTOFFS_PACK(km, ks, tm, ts, dv, nt) \
+   (AWS_MP_CUTOFF_FIELD(km, AWS_MP_CUTOFF_MAX) | (AWS_MP_CUTOFF_FIELD(ks, AWS_MP_CUTOFF_MAX) << 10) | \
+    (AWS_MP_CUTOFF_FIELD(tm, AWS_MP_CUTOFF_MAX) << 20) | (AWS_MP_CUTOFF_FIELD(ts, AWS_MP_CUTOFF_MAX) << 30) | \
+    (AWS_MP_CUTOFF_FIELD(dv, AWS_MP_CUTOFF_MAX) << 40) | (AWS_MP_CUTOFF_FIELD(nt, AWS_MP_NTT_CUTOFF_MAX) << 50))
+#define AWS_MP_CUTOFF(w, n)    AWS_MP_CUTOFF_READ((int)(((w) >> (10 * (n))) & AWS_MP_CUTOFF_MAX), AWS_MP_CUTOFF_MAX)
+#define AWS_MP_CUTOFF_NTT(w)   AWS_MP_CUTOFF_READ((int)(((w) >> 50) & AWS_MP_NTT_CUTOFF_MAX), AWS_MP_NTT_CUTOFF_MAX)
+#define AWS_MP_CUTOFF_KMUL     0
+#define AWS_MP_CUTOFF_KSQR     1
+#define AWS_MP_CUTOFF_TMUL     2
+#define AWS_MP_CUTOFF_TSQR     3
+#define AWS_MP_CUTOFF_DIV      4
+
+static volatile ulong64 s_mp_cutoffs = AWS_MP_CUTOFFS_PACK(AWS_MP_KARATSUBA_MUL_DEFAULT, AWS_MP_KARATSUBA_SQR_DEFAULT,
+                                                           AWS_MP_TOOM_MUL_DEFAULT, AWS_MP_TOOM_SQR_DEFAULT,
+                                                           AWS_MP_DIV_RECURSIVE_DEFAULT, AWS_MP_NTT_DEFAULT);
+
+int aws_mp_set_cutoffs(const aws_mp_cutoffs *c)
+{
+  if (c->karatsuba_mul < AWS_MP_KARATSUBA_MIN || c->karatsuba_sqr < AWS_MP_KARATSUBA_MIN ||
+      c->toom_mul < AWS_MP_TOOM_MIN || c->toom_sqr < AWS_MP_TOOM_MIN ||
+      c->div_recursive < AWS_MP_DIV_RECURSIVE_MIN || c->ntt < AWS_MP_NTT_MIN) {
+    return AWS_MP_VAL;
+  }
+
+  AWS_MP_CUTOFFS_STORE(&s_mp_cutoffs, AWS_MP_CUTOFFS_PACK(c->karatsuba_mul, c->karatsuba_sqr, c->toom_mul,
+                                                          c->toom_sqr, c->div_recursive, c->ntt));
+  return AWS_MP_OKAY;
+}
+
+void aws_mp_get_cutoffs(aws_mp_cutoffs *c)
+{
+  ulong64 w = AWS_MP_CUTOFFS_LOAD(&s_mp_cutoffs);
+
+  c->karatsuba_mul = AWS_MP_CUTOFF(w, AWS_MP_CUTOFF_KMUL);
+  c->karatsuba_sqr = AWS_MP_CUTOFF(w, AWS_MP_CUTOFF_KSQR);
+  c->toom_mul      = AWS_MP_CUTOFF(w, AWS_MP_CUTOFF_TMUL);
+  c->toom_sqr      = AWS_MP_CUTOFF(w, AWS_MP_CUTOFF_TSQR);
+  c->div_recursive = AWS_MP_CUTOFF(w, AWS_MP_CUTOFF_DIV);
+  c->ntt           = AWS_MP_CUTOFF_NTT(w);
+}
 #endif
 
 #ifdef AWS_BN_MP_MOD_2D_C
@@ -987,20 +1075,23 @@ int aws_mp_karatsuba_sqr(aws_mp_int *a, aws_mp_int *b)
   /* now divide in two */
   B = B >> 1;
 
+  /* the temps come from the scratch arena, x1x1 is shifted up to a->used * 2 digits */
+  aws_mp_scratch_begin();
+
   /* init copy all the temps */
-  if (aws_mp_init_size(&x0, B) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&x0, B) != AWS_MP_OKAY)
     goto ERR;
-  if (aws_mp_init_size(&x1, a->used - B) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&x1, a->used - B) != AWS_MP_OKAY)
     goto X0;
 
   /* init temps */
-  if (aws_mp_init_size(&t1, a->used * 2) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&t1, a->used * 2) != AWS_MP_OKAY)
     goto X1;
-  if (aws_mp_init_size(&t2, a->used * 2) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&t2, a->used * 2) != AWS_MP_OKAY)
     goto T1;
-  if (aws_mp_init_size(&x0x0, B * 2) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&x0x0, B * 2) != AWS_MP_OKAY)
     goto T2;
-  if (aws_mp_init_size(&x1x1, (a->used - B) * 2) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&x1x1, a->used * 2) != AWS_MP_OKAY)
     goto X0X0;
 
   {
@@ -1070,6 +1161,7 @@ aws_mp_clear(&x1);
 X0:
 aws_mp_clear(&x0);
 ERR:
+  aws_mp_scratch_end();
   return err;
 }
 #endif
@@ -1124,15 +1216,506 @@ void aws_mp_zero(aws_mp_int *a)
 }
 #endif
 
+#ifdef AWS_BN_S_MP_RADIX_POW2_C
+
+/* Linear time conversion for the power of two radices 2, 8, 16, 32 and 64
+ *
+ * Every character is a fixed group of bits, so instead of dividing or
+ * multiplying the whole number once per character the groups are sliced
+ * straight out of [or into] the digits.  Radix 16 additionally maps between
+ * nibbles and ASCII sixteen characters at a time with SSE2 or NEON.
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+   #include <emmintrin.h>
+   #define AWS_MP_HEX_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+   #include <arm_neon.h>
+   #define AWS_MP_HEX_NEON
+#endif
+
+/* log2(radix) for the power of two radices, 0 for any other */
+int aws_s_mp_radix_pow2(int radix)
+{
+  switch (radix) {
+    case 2:  return 1;
+    case 8:  return 3;
+    case 16: return 4;
+    case 32: return 5;
+    case 64: return 6;
+    default: return 0;
+  }
+}
+
+/* s[i] = aws_mp_s_rmap[s[i]] for nibbles 0..15 */
+static void s_mp_hex_chars(unsigned char *s, int n)
+{
+  int i = 0;
+
+#if defined(AWS_MP_HEX_SSE2)
+  for (; i + 16 <= n; i += 16) {
+    __m128i v  = _mm_loadu_si128((const __m128i *)(s + i));
+    __m128i hi = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(9)), _mm_set1_epi8('A' - '0' - 10));
+    _mm_storeu_si128((__m128i *)(s + i), _mm_add_epi8(_mm_add_epi8(v, _mm_set1_epi8('0')), hi));
+  }
+#elif defined(AWS_MP_HEX_NEON)
+  for (; i + 16 <= n; i += 16) {
+    uint8x16_t v  = vld1q_u8(s + i);
+    uint8x16_t hi = vandq_u8(vcgtq_u8(v, vdupq_n_u8(9)), vdupq_n_u8('A' - '0' - 10));
+    vst1q_u8(s + i, vaddq_u8(vaddq_u8(v, vdupq_n_u8('0')), hi));
+  }
+#endif
+  for (; i < n; i++) {
+    s[i] = (unsigned char)aws_mp_s_rmap[s[i]];
+  }
+}
+
+/* number of leading hex characters of s[0..n), in either case */
+static int s_mp_hex_span(const unsigned char *s, int n)
+{
+  int i = 0;
+
+#if defined(AWS_MP_HEX_SSE2)
+  for (; i + 16 <= n; i += 16) {
+    __m128i v   = _mm_loadu_si128((const __m128i *)(s + i));
+    __m128i d   = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    __m128i l   = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i ok  = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d),
+                               _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l));
+    if (_mm_movemask_epi8(ok) != 0xFFFF) {
+      break;
+    }
+  }
+#elif defined(AWS_MP_HEX_NEON)
+  for (; i + 16 <= n; i += 16) {
+    uint8x16_t v  = vld1q_u8(s + i);
+    uint8x16_t d  = vsubq_u8(v, vdupq_n_u8('0'));
+    uint8x16_t l  = vsubq_u8(vorrq_u8(v, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    uint8x16_t ok = vorrq_u8(vcleq_u8(d, vdupq_n_u8(9)), vcleq_u8(l, vdupq_n_u8(5)));
+    if (vminvq_u8(ok) != 0xFF) {
+      break;
+    }
+  }
+#endif
+  for (; i < n; i++) {
+    unsigned char c = s[i];
+    if (!((unsigned char)(c - '0') <= 9 || (unsigned char)((c | 0x20) - 'a') <= 5)) {
+      break;
+    }
+  }
+  return i;
+}
+
+/* dst[i] = value of the hex character src[i], which must be valid */
+static void s_mp_hex_nibbles(const unsigned char *src, unsigned char *dst, int n)
+{
+  int i = 0;
+
+#if defined(AWS_MP_HEX_SSE2)
+  for (; i + 16 <= n; i += 16) {
+    __m128i v   = _mm_loadu_si128((const __m128i *)(src + i));
+    __m128i d   = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    __m128i dig = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+    __m128i l   = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a' - 10));
+    _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_and_si128(dig, d), _mm_andnot_si128(dig, l)));
+  }
+#elif defined(AWS_MP_HEX_NEON)
+  for (; i + 16 <= n; i += 16) {
+    uint8x16_t v   = vld1q_u8(src + i);
+    uint8x16_t d   = vsubq_u8(v, vdupq_n_u8('0'));
+    uint8x16_t l   = vsubq_u8(vorrq_u8(v, vdupq_n_u8(0x20)), vdupq_n_u8('a' - 10));
+    vst1q_u8(dst + i, vbslq_u8(vcleq_u8(d, vdupq_n_u8(9)), d, l));
+  }
+#endif
+  for (; i < n; i++) {
+    unsigned char c = src[i];
+    dst[i] = ((unsigned char)(c - '0') <= 9) ? (unsigned char)(c - '0') : (unsigned char)((c | 0x20) - 'a' + 10);
+  }
+}
+
+/* writes the "limit" least significant characters of |a| [all of them if
+ * there are fewer] in radix 2**k, most significant first, plus a NUL byte.
+ * Returns the number of characters written.
+ */
+int aws_s_mp_toradix_pow2(aws_mp_int *a, char *str, int radix, int limit)
+{
+  unsigned char *s = (unsigned char *)str;
+  aws_mp_digit   v;
+  int            k, n, i, d, b;
+
+  k = aws_s_mp_radix_pow2(radix);
+  n = (aws_mp_count_bits(a) + k - 1) / k;
+  if (n == 0) {
+    n = 1;
+  }
+  if (n > limit) {
+    n = limit;
+  }
+
+  /* slice the groups out from the least significant end */
+  d = 0;
+  b = 0;
+  for (i = n - 1; i >= 0; i--) {
+    v = (d < a->used) ? (a->dp[d] >> b) : 0;
+    b += k;
+    if (b >= AWS_DIGIT_BIT) {
+      b -= AWS_DIGIT_BIT;
+      ++d;
+      if (b > 0 && d < a->used) {
+        v |= a->dp[d] << (k - b);
+      }
+    }
+    s[i] = (unsigned char)(v & (((aws_mp_digit)1 << k) - 1));
+  }
+
+  if (radix == 16) {
+      s_mp_hex_chars(s, n);
+  } else {
+    for (i = 0; i < n; i++) {
+      s[i] = (unsigned char)aws_mp_s_rmap[s[i]];
+    }
+  }
+  s[n] = '\0';
+  return n;
+}
+
+/* reads the leading radix 2**k characters of str into |a|, stopping at the
+ * first character that isn't one [same as aws_mp_read_radix]
+ */
+int aws_s_mp_read_radix_pow2(aws_mp_int *a, const char *str, int radix)
+{
+  const unsigned char *s = (const unsigned char *)str;
+  unsigned char        map[256], val[64];
+  aws_mp_digit         acc;
+  int                  k, n, i, j, m, d, b, res;
+
+  k = aws_s_mp_radix_pow2(radix);
+
+  /* length of the valid prefix */
+  if (radix == 16) {
+    n = s_mp_hex_span(s, (int)strlen(str));
+  } else {
+    for (i = 0; i < 256; i++) {
+      map[i] = 0xFF;
+    }
+    for (i = 0; i < radix; i++) {
+      map[(unsigned char)aws_mp_s_rmap[i]] = (unsigned char)i;
+      /* the conversion is case insensitive below radix 36 */
+      if (radix < 36) {
+        map[(unsigned char)tolower((unsigned char)aws_mp_s_rmap[i])] = (unsigned char)i;
+      }
+    }
+    for (n = 0; s[n] != 0 && map[s[n]] != 0xFF; n++);
+  }
+
+    aws_mp_zero(a);
+  if ((res = aws_mp_grow(a, (n * k) / AWS_DIGIT_BIT + 1)) != AWS_MP_OKAY) {
+    return res;
+  }
+
+  /* pack the groups from the least significant [last] character up, in
+   * blocks of decoded values
+   */
+  d   = 0;
+  b   = 0;
+  acc = 0;
+  for (j = n; j > 0; j -= m) {
+    m = (j < (int)sizeof(val)) ? j : (int)sizeof(val);
+    if (radix == 16) {
+        s_mp_hex_nibbles(s + j - m, val, m);
+    } else {
+      for (i = 0; i < m; i++) {
+        val[i] = map[s[j - m + i]];
+      }
+    }
+    for (i = m - 1; i >= 0; i--) {
+      acc |= ((aws_mp_digit)val[i] << b);
+      b += k;
+      if (b >= AWS_DIGIT_BIT) {
+        a->dp[d++] = acc & AWS_MP_MASK;
+        b  -= AWS_DIGIT_BIT;
+        acc = (aws_mp_digit)val[i] >> (k - b);
+      }
+    }
+  }
+  a->dp[d] = acc;
+  a->used  = d + 1;
+    aws_mp_clamp(a);
+  return AWS_MP_OKAY;
+}
+#endif
+
+#ifdef AWS_BN_S_MP_RADIX_DC_C
+
+/* Divide and conquer conversion for the other radices
+ *
+ * With P[k] = radix**(n * 2**k), where radix**n is the largest power of the
+ * radix that fits a digit, a number below P[k+1] splits into a quotient and a
+ * remainder by P[k] that are converted independently, the remainder padded
+ * to exactly n * 2**k characters.  Reading joins the halves back with one
+ * multiplication per split.  Both recurse down to AWS_MP_RADIX_DC_CUTOFF
+ * digits where n characters are handled per aws_mp_div_d/aws_mp_mul_d step,
+ * so the quadratic part works on digit sized chunks instead of characters.
+ */
+
+typedef struct {
+   int          radix, n, count;
+   aws_mp_digit chunk;
+   aws_mp_int   P[32];
+} s_mp_radix_pow;
+
+static void s_mp_radix_pow_init(s_mp_radix_pow *p, int radix)
+{
+  p->radix = radix;
+  p->chunk = (aws_mp_digit)radix;
+  p->n     = 1;
+  while (p->chunk <= AWS_MP_MASK / (aws_mp_digit)radix) {
+    p->chunk *= (aws_mp_digit)radix;
+    ++(p->n);
+  }
+  p->count = 0;
+}
+
+/* makes sure P[0..k] exist */
+static int s_mp_radix_pow_get(s_mp_radix_pow *p, int k)
+{
+  int err;
+
+  while (p->count <= k) {
+    if (p->count >= 32) {
+      return AWS_MP_VAL;
+    }
+    if ((err = aws_mp_init(&p->P[p->count])) != AWS_MP_OKAY) {
+      return err;
+    }
+    if (p->count == 0) {
+        aws_mp_set(&p->P[0], p->chunk);
+    } else if ((err = aws_mp_sqr(&p->P[p->count - 1], &p->P[p->count])) != AWS_MP_OKAY) {
+        aws_mp_clear(&p->P[p->count]);
+      return err;
+    }
+    ++(p->count);
+  }
+  return AWS_MP_OKAY;
+}
+
+static void s_mp_radix_pow_clear(s_mp_radix_pow *p)
+{
+  while (p->count > 0) {
+      aws_mp_clear(&p->P[--(p->count)]);
+  }
+}
+
+/* |a| in exactly "width" characters with leading zeros, or as few as possible if width is 0 */
+static int s_mp_toradix_leaf(aws_mp_int *a, char *str, s_mp_radix_pow *p, int width, int *len)
+{
+  aws_mp_int   t;
+  aws_mp_digit d;
+  int          err, digs, i;
+
+  if ((err = aws_mp_init_copy(&t, a)) != AWS_MP_OKAY) {
+    return err;
+  }
+  t.sign = AWS_MP_ZPOS;
+
+  /* least significant characters first, reversed at the end */
+  digs = 0;
+  while (aws_mp_iszero(&t) == AWS_MP_NO) {
+    if ((err = aws_mp_div_d(&t, p->chunk, &t, &d)) != AWS_MP_OKAY) {
+      goto LBL_T;
+    }
+    for (i = 0; i < p->n; i++) {
+      if (d == 0 && aws_mp_iszero(&t) == AWS_MP_YES) {
+        break;
+      }
+      str[digs++] = aws_mp_s_rmap[d % (aws_mp_digit)p->radix];
+      d /= (aws_mp_digit)p->radix;
+    }
+  }
+  while (digs < width) {
+    str[digs++] = '0';
+  }
+  if (digs == 0) {
+    str[digs++] = '0';
+  }
+    aws_bn_reverse((unsigned char *)str, digs);
+  *len = digs;
+
+LBL_T:
+  aws_mp_clear(&t);
+  return err;
+}
+
+/* |a| < P[k+1] [or P[k+1] * something when top], padded to n * 2**k characters unless top */
+static int s_mp_toradix_rec(aws_mp_int *a, char *str, s_mp_radix_pow *p, int k, int top, int *len)
+{
+  aws_mp_int q, r;
+  int        err, lq, lr;
+
+  /* skip the powers a is already below */
+  while (top == 1 && k >= 0 && aws_mp_cmp_mag(a, &p->P[k]) == AWS_MP_LT) {
+    --k;
+  }
+  if (k < 0 || a->used <= AWS_MP_RADIX_DC_CUTOFF) {
+    return s_mp_toradix_leaf(a, str, p, (top == 1) ? 0 : (p->n << (k + 1)), len);
+  }
+
+  aws_mp_scratch_begin();
+  if ((err = aws_mp_init_scratch(&q, a->used)) != AWS_MP_OKAY) {
+    goto LBL_END;
+  }
+  if ((err = aws_mp_init_scratch(&r, p->P[k].used + 1)) != AWS_MP_OKAY) {
+    goto LBL_Q;
+  }
+
+  /* a = q * P[k] + r, q < P[k] as a < P[k+1] */
+  if ((err = aws_mp_div(a, &p->P[k], &q, &r)) != AWS_MP_OKAY) {
+    goto LBL_R;
+  }
+  if ((err = s_mp_toradix_rec(&q, str, p, k - 1, top, &lq)) != AWS_MP_OKAY) {
+    goto LBL_R;
+  }
+  if ((err = s_mp_toradix_rec(&r, str + lq, p, k - 1, 0, &lr)) != AWS_MP_OKAY) {
+    goto LBL_R;
+  }
+  *len = lq + lr;
+
+LBL_R:
+  aws_mp_clear(&r);
+LBL_Q:
+  aws_mp_clear(&q);
+LBL_END:
+  aws_mp_scratch_end();
+  return err;
+}
+
+/* writes |a| in the given radix, without sign or NUL, and sets *len to the character count */
+int aws_s_mp_toradix_dc(aws_mp_int *a, char *str, int radix, int *len)
+{
+  s_mp_radix_pow p;
+  aws_mp_int     t;
+  int            err, k;
+
+  s_mp_radix_pow_init(&p, radix);
+  *len = 0;
+
+  /* t = |a| so the magnitude compares below don't care about the sign */
+  t = *a;
+  t.sign = AWS_MP_ZPOS;
+
+  /* find the first P[k+1] above |a| */
+  k = -1;
+  if (t.used > AWS_MP_RADIX_DC_CUTOFF) {
+    do {
+      ++k;
+      if ((err = s_mp_radix_pow_get(&p, k + 1)) != AWS_MP_OKAY) {
+        goto LBL_P;
+      }
+    } while (aws_mp_cmp_mag(&t, &p.P[k + 1]) != AWS_MP_LT);
+  }
+  err = s_mp_toradix_rec(&t, str, &p, k, 1, len);
+
+LBL_P:
+  s_mp_radix_pow_clear(&p);
+  return err;
+}
+
+/* a = value of the n characters at str, all valid for the radix */
+static int s_mp_read_radix_rec(aws_mp_int *a, const unsigned char *s, int n, const unsigned char *map,
+                               s_mp_radix_pow *p)
+{
+  aws_mp_int   hi;
+  aws_mp_digit acc, scale;
+  int          err, i, j, k, lo;
+
+  /* small enough to take n characters per aws_mp_mul_d */
+  if ((n / p->n) <= AWS_MP_RADIX_DC_CUTOFF) {
+      aws_mp_zero(a);
+    i = 0;
+    while (i < n) {
+      acc   = 0;
+      scale = 1;
+      for (j = 0; j < p->n && i < n; j++, i++) {
+        acc    = acc * (aws_mp_digit)p->radix + (aws_mp_digit)map[s[i]];
+        scale *= (aws_mp_digit)p->radix;
+      }
+      if ((err = aws_mp_mul_d(a, scale, a)) != AWS_MP_OKAY) {
+        return err;
+      }
+      if ((err = aws_mp_add_d(a, acc, a)) != AWS_MP_OKAY) {
+        return err;
+      }
+    }
+    return AWS_MP_OKAY;
+  }
+
+  /* the low part is the largest n * 2**k characters below n */
+  k = 0;
+  while ((p->n << (k + 1)) < n) {
+    ++k;
+  }
+  lo = p->n << k;
+  if ((err = s_mp_radix_pow_get(p, k)) != AWS_MP_OKAY) {
+    return err;
+  }
+
+  aws_mp_scratch_begin();
+  if ((err = aws_mp_init_scratch(&hi, 2 * p->P[k].used + 2)) != AWS_MP_OKAY) {
+    goto LBL_END;
+  }
+
+  /* a = hi * P[k] + lo */
+  if ((err = s_mp_read_radix_rec(&hi, s, n - lo, map, p)) != AWS_MP_OKAY) {
+    goto LBL_HI;
+  }
+  if ((err = s_mp_read_radix_rec(a, s + n - lo, lo, map, p)) != AWS_MP_OKAY) {
+    goto LBL_HI;
+  }
+  if ((err = aws_mp_mul(&hi, &p->P[k], &hi)) != AWS_MP_OKAY) {
+    goto LBL_HI;
+  }
+  err = aws_mp_add(&hi, a, a);
+
+LBL_HI:
+  aws_mp_clear(&hi);
+LBL_END:
+  aws_mp_scratch_end();
+  return err;
+}
+
+/* reads the leading characters of str that are valid in the radix into |a| */
+int aws_s_mp_read_radix_dc(aws_mp_int *a, const char *str, int radix)
+{
+  const unsigned char *s = (const unsigned char *)str;
+  unsigned char        map[256];
+  s_mp_radix_pow       p;
+  int                  err, i, n;
+
+  for (i = 0; i < 256; i++) {
+    map[i] = 0xFF;
+  }
+  for (i = 0; i < radix; i++) {
+    map[(unsigned char)aws_mp_s_rmap[i]] = (unsigned char)i;
+    /* the conversion is case insensitive below radix 36 */
+    if (radix < 36) {
+      map[(unsigned char)tolower((unsigned char)aws_mp_s_rmap[i])] = (unsigned char)i;
+    }
+  }
+  for (n = 0; s[n] != 0 && map[s[n]] != 0xFF; n++);
+
+  s_mp_radix_pow_init(&p, radix);
+  err = s_mp_read_radix_rec(a, s, n, map, &p);
+  s_mp_radix_pow_clear(&p);
+  return err;
+}
+#endif
+
 #ifdef AWS_BN_MP_TORADIX_C
 
 /* stores a bignum as a ASCII string in a given radix (2..64) */
 int aws_mp_toradix(aws_mp_int *a, char *str, int radix)
 {
   int     res, digs;
-  aws_mp_int t;
-  aws_mp_digit d;
-  char   *_s = str;
 
   /* check range of the radix */
   if (radix < 2 || radix > 64) {
@@ -1146,36 +1729,24 @@ int aws_mp_toradix(aws_mp_int *a, char *str, int radix)
      return AWS_MP_OKAY;
   }
 
-  if ((res = aws_mp_init_copy(&t, a)) != AWS_MP_OKAY) {
-    return res;
-  }
-
   /* if it is negative output a - */
-  if (t.sign == AWS_MP_NEG) {
-    ++_s;
+  if (a->sign == AWS_MP_NEG) {
     *str++ = '-';
-    t.sign = AWS_MP_ZPOS;
   }
 
-  digs = 0;
-  while (aws_mp_iszero (&t) == 0) {
-    if ((res = aws_mp_div_d(&t, (aws_mp_digit) radix, &t, &d)) != AWS_MP_OKAY) {
-        aws_mp_clear(&t);
-      return res;
-    }
-    *str++ = aws_mp_s_rmap[d];
-    ++digs;
-  }
-
-  /* reverse the digits of the string.  In this case _s points
-   * to the first digit [exluding the sign] of the number]
+  /* power of two radices are sliced straight out of the digits, the others
+   * are split recursively by powers of the radix
    */
-    aws_bn_reverse((unsigned char *) _s, digs);
+  if (aws_s_mp_radix_pow2(radix) != 0) {
+      aws_s_mp_toradix_pow2(a, str, radix, INT_MAX);
+    return AWS_MP_OKAY;
+  }
+  if ((res = aws_s_mp_toradix_dc(a, str, radix, &digs)) != AWS_MP_OKAY) {
+    return res;
+  }
 
   /* append a NULL so the string is properly terminated */
-  *str = '\0';
-
-    aws_mp_clear(&t);
+  str[digs] = '\0';
   return AWS_MP_OKAY;
 }
 
@@ -1326,6 +1897,13 @@ int aws_mp_init_size(aws_mp_int *a, int size)
 {
   int x;
 
+#ifdef AWS_MP_INLINE_DIGS
+  /* small enough for the inline digits */
+  if (size <= AWS_MP_INLINE_DIGS) {
+    return aws_mp_init(a);
+  }
+#endif
+
   /* pad size so there are always extra digits */
   size += (AWS_MP_PREC * 2) - (size % AWS_MP_PREC);
   
@@ -1349,21 +1927,406 @@ int aws_mp_init_size(aws_mp_int *a, int size)
 }
 #endif
 
-#ifdef AWS_BN_MP_PRIME_NEXT_PRIME_C
+#ifdef AWS_BN_S_MP_POOL_C
 
-/* finds the next prime after the number "a" using "t" trials
- * of Miller-Rabin.
+/* Workers for the multi-threaded routines
  *
- * bbs_style = 1 means the prime must be congruent to 3 mod 4
+ * aws_s_mp_pool_run() calls job(pool, arg) on "threads" workers [all online
+ * cores when threads <= 0, no more than "limit" or AWS_MP_POOL_MAX_THREADS],
+ * the calling thread being one of them, and returns when all are done.  The
+ * job takes its share of the work under aws_s_mp_pool_lock() and records a
+ * failure with aws_s_mp_pool_fail(); the first one recorded is what
+ * aws_s_mp_pool_run() returns.  The spawned workers hand their scratch arena
+ * back when they finish.
+ *
+ * Builds without pthreads [AWS_MP_NO_THREADS, or MSVC] run the job once on
+ * the calling thread and the lock does nothing.
  */
-int aws_mp_prime_next_prime(aws_mp_int *a, int t, int bbs_style)
-{
-   int      err, res = 0, x, y;
-   aws_mp_digit res_tab[AWS_JKTM_PRIME_SIZE], step, kstep;
-   aws_mp_int b;
 
-   /* ensure t is valid */
-   if (t <= 0 || t > AWS_JKTM_PRIME_SIZE) {
+#if !defined(AWS_MP_NO_THREADS) && !defined(_MSC_VER)
+   #include <pthread.h>
+   #include <unistd.h>
+   #define AWS_MP_POOL_THREADS
+#endif
+
+/* largest number of workers */
+#define AWS_MP_POOL_MAX_THREADS 64
+
+struct aws_s_mp_pool {
+   void          (*job)(aws_s_mp_pool *, void *);
+   void           *arg;
+   int             err;
+#ifdef AWS_MP_POOL_THREADS
+   pthread_mutex_t lock;
+#endif
+};
+
+void aws_s_mp_pool_lock(aws_s_mp_pool *pool)
+{
+#ifdef AWS_MP_POOL_THREADS
+  pthread_mutex_lock(&pool->lock);
+#else
+  (void)pool;
+#endif
+}
+
+void aws_s_mp_pool_unlock(aws_s_mp_pool *pool)
+{
+#ifdef AWS_MP_POOL_THREADS
+  pthread_mutex_unlock(&pool->lock);
+#else
+  (void)pool;
+#endif
+}
+
+/* keeps the first failure, with the lock held */
+void aws_s_mp_pool_fail(aws_s_mp_pool *pool, int err)
+{
+  if (pool->err == AWS_MP_OKAY) {
+    pool->err = err;
+  }
+}
+
+/* nonzero once a worker failed, with the lock held */
+int aws_s_mp_pool_failed(aws_s_mp_pool *pool)
+{
+  return pool->err != AWS_MP_OKAY;
+}
+
+#ifdef AWS_MP_POOL_THREADS
+static void *s_mp_pool_worker(void *arg)
+{
+  aws_s_mp_pool *pool = (aws_s_mp_pool *)arg;
+
+  pool->job(pool, pool->arg);
+  aws_mp_scratch_release();
+  return NULL;
+}
+#endif
+
+int aws_s_mp_pool_run(void (*job)(aws_s_mp_pool *, void *), void *arg, int threads, int limit)
+{
+  aws_s_mp_pool pool;
+#ifdef AWS_MP_POOL_THREADS
+  pthread_t     tid[AWS_MP_POOL_MAX_THREADS];
+  int           ix, started;
+#endif
+
+  pool.job = job;
+  pool.arg = arg;
+  pool.err = AWS_MP_OKAY;
+
+#ifdef AWS_MP_POOL_THREADS
+  if (threads <= 0) {
+    threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+  threads = AWS_MIN(AWS_MIN(threads, limit), AWS_MP_POOL_MAX_THREADS);
+  if (pthread_mutex_init(&pool.lock, NULL) != 0) {
+    return AWS_MP_MEM;
+  }
+
+  /* the caller is the first worker, if a thread can't be started the
+   * others simply take its share
+   */
+  started = 0;
+  for (ix = 1; ix < threads; ix++) {
+    if (pthread_create(&tid[started], NULL, s_mp_pool_worker, &pool) != 0) {
+      break;
+    }
+    ++started;
+  }
+  job(&pool, arg);
+  for (ix = 0; ix < started; ix++) {
+    pthread_join(tid[ix], NULL);
+  }
+  pthread_mutex_destroy(&pool.lock);
+#else
+  (void)threads;
+  (void)limit;
+  job(&pool, arg);
+#endif
+
+  return pool.err;
+}
+#endif
+
+#ifdef AWS_BN_S_MP_PRIME_SEARCH_C
+
+/* Sieved, multi-threaded search for the first prime in a + j*step, j = 0, 1, ...
+ *
+ * The candidates are sieved AWS_MP_PRIME_WINDOW at a time against the odd
+ * primes below a bound that grows with the size of a [a Miller-Rabin test
+ * costing more there], up to AWS_MP_PRIME_SIEVE_MAX.  The residues of a are
+ * taken once, every sieve prime s then strikes the candidates it divides
+ * directly, and the next window only adds window*step to the residues.
+ * With AWS_LTM_PRIME_SAFE the candidates p = 1 mod s go too, (p-1)/2 being
+ * a multiple of s then.
+ *
+ * The survivors go through Miller-Rabin on a pool of "threads" workers
+ * [see aws_s_mp_pool_run()] that take them in order.  A prime found cancels
+ * the work on every candidate past it, the candidates before it are still
+ * finished, so the result is the first prime whatever the number of threads.
+ *
+ * The sieve stays below (a-1)/2, so it never strikes a candidate [or its
+ * (p-1)/2] for being a sieve prime itself.
+ */
+
+/* candidates sieved at a time [so that window*step fits a digit] and the
+ * largest sieve bound
+ */
+#define AWS_MP_PRIME_WINDOW       ((AWS_MP_MASK / 4) < 4096 ? (int)(AWS_MP_MASK / 4) : 4096)
+#define AWS_MP_PRIME_SIEVE_MAX    ((AWS_MP_MASK >> 1) < 65536 ? (unsigned long)(AWS_MP_MASK >> 1) : 65536UL)
+
+typedef struct {
+   aws_mp_int      *a;
+   aws_mp_digit     step;
+   unsigned char   *sieve;          /* nonzero for candidates with a small factor */
+   int              t, safe, n, next, best;
+} s_mp_prime_window;
+
+/* index of the first prime found so far [n for none] */
+static int s_mp_prime_best(aws_s_mp_pool *pool, s_mp_prime_window *w)
+{
+  int best;
+
+  aws_s_mp_pool_lock(pool);
+  best = w->best;
+  aws_s_mp_pool_unlock(pool);
+  return best;
+}
+
+/* Miller-Rabin on candidate j [and on (p-1)/2 with it], given up once a prime before it turns up */
+static int s_mp_prime_test(aws_s_mp_pool *pool, s_mp_prime_window *w, int j, aws_mp_int *p, aws_mp_int *q,
+                           aws_mp_int *b, int *result)
+{
+  int x, err;
+
+  *result = AWS_MP_NO;
+  if ((err = aws_mp_add_d(w->a, (aws_mp_digit)j * w->step, p)) != AWS_MP_OKAY) {
+    return err;
+  }
+  if (w->safe != 0 && (err = aws_mp_div_2(p, q)) != AWS_MP_OKAY) {
+    return err;
+  }
+
+  for (x = 0; x < w->t; x++) {
+    if (s_mp_prime_best(pool, w) < j) {
+      return AWS_MP_OKAY;
+    }
+    aws_mp_set(b, aws_ltm_prime_tab[x]);
+    if (w->safe != 0) {
+      if ((err = aws_mp_prime_miller_rabin(q, b, result)) != AWS_MP_OKAY || *result == AWS_MP_NO) {
+        return err;
+      }
+    }
+    if ((err = aws_mp_prime_miller_rabin(p, b, result)) != AWS_MP_OKAY || *result == AWS_MP_NO) {
+      return err;
+    }
+  }
+  return AWS_MP_OKAY;
+}
+
+/* takes candidates until the window is done, failed or has a prime before the next one */
+static void s_mp_prime_run(aws_s_mp_pool *pool, void *arg)
+{
+  s_mp_prime_window *w = (s_mp_prime_window *)arg;
+  aws_mp_int         p, q, b;
+  int                j, res, err;
+
+  if ((err = aws_mp_init_multi(&p, &q, &b, NULL)) != AWS_MP_OKAY) {
+    aws_s_mp_pool_lock(pool);
+    aws_s_mp_pool_fail(pool, err);
+    aws_s_mp_pool_unlock(pool);
+    return;
+  }
+
+  for (;;) {
+    aws_s_mp_pool_lock(pool);
+    while (w->next < w->n && w->sieve[w->next] != 0) {
+      ++(w->next);
+    }
+    j = (!aws_s_mp_pool_failed(pool) && w->next < w->best) ? w->next++ : -1;
+    aws_s_mp_pool_unlock(pool);
+    if (j < 0) {
+      break;
+    }
+
+    err = s_mp_prime_test(pool, w, j, &p, &q, &b, &res);
+
+    aws_s_mp_pool_lock(pool);
+    if (err != AWS_MP_OKAY) {
+      aws_s_mp_pool_fail(pool, err);
+    } else if (res == AWS_MP_YES && j < w->best) {
+      w->best = j;
+    }
+    aws_s_mp_pool_unlock(pool);
+  }
+
+  aws_mp_clear_multi(&p, &q, &b, NULL);
+}
+
+/* strikes the candidates a + j*step = c mod s, r = a mod s */
+static void s_mp_prime_strike(unsigned char *sieve, int n, unsigned long r, unsigned long c, unsigned long s,
+                              unsigned long step)
+{
+  unsigned long y;
+  int           j;
+
+  /* the smallest y = j*step with y = c - r mod s */
+  for (y = (s + c - r) % s; y % step != 0; y += s);
+  for (j = (int)(y / step); j < n; j += (int)s) {
+    sieve[j] = 1;
+  }
+}
+
+/* the odd primes below "bound" into a fresh array, Eratosthenes over the odd numbers */
+static unsigned long *s_mp_prime_sieve_primes(unsigned long bound, int *count)
+{
+  unsigned char *odd;
+  unsigned long *primes, x, y;
+  int            n;
+
+  odd    = AWS_OPT_CAST(unsigned char) AWS_XCALLOC(bound / 2 + 1, 1);
+  primes = AWS_OPT_CAST(unsigned long) AWS_XMALLOC(sizeof(unsigned long) * (bound / 2 + 1));
+  if (odd == NULL || primes == NULL) {
+    if (odd != NULL) {
+      AWS_XFREE(odd);
+    }
+    if (primes != NULL) {
+      AWS_XFREE(primes);
+    }
+    return NULL;
+  }
+
+  /* odd[x/2] != 0 once x is known composite */
+  n = 0;
+  for (x = 3; x < bound; x += 2) {
+    if (odd[x / 2] != 0) {
+      continue;
+    }
+    primes[n++] = x;
+    for (y = x * x; y < bound; y += 2 * x) {
+      odd[y / 2] = 1;
+    }
+  }
+
+  AWS_XFREE(odd);
+  *count = n;
+  return primes;
+}
+
+int aws_s_mp_prime_search(aws_mp_int *a, int t, int flags, int windows, int threads, int *result)
+{
+  s_mp_prime_window w;
+  aws_mp_digit     *res_tab, add;
+  unsigned long    *primes, bound;
+  unsigned char    *sieve;
+  int               x, np = 0, err;
+
+  *result = AWS_MP_NO;
+  if (t <= 0 || t > AWS_JKTM_PRIME_SIZE || aws_mp_cmp_d(a, 7) == AWS_MP_LT) {
+    return AWS_MP_VAL;
+  }
+
+  /* sieve up to 32 times the bits of a, but short of (a-1)/2 */
+  bound = AWS_MIN((unsigned long)aws_mp_count_bits(a) * 32, AWS_MP_PRIME_SIEVE_MAX);
+  if (a->used == 1 && (unsigned long)(a->dp[0] - 1) / 2 < bound) {
+    bound = (unsigned long)(a->dp[0] - 1) / 2;
+  }
+
+  primes  = s_mp_prime_sieve_primes(bound, &np);
+  res_tab = AWS_OPT_CAST(aws_mp_digit) AWS_XMALLOC(sizeof(aws_mp_digit) * (np + 1));
+  sieve   = AWS_OPT_CAST(unsigned char) AWS_XMALLOC(AWS_MP_PRIME_WINDOW);
+  if (primes == NULL || res_tab == NULL || sieve == NULL) {
+    err = AWS_MP_MEM;
+    goto LBL_ERR;
+  }
+
+  w.a     = a;
+  w.step  = (flags & (AWS_LTM_PRIME_BBS | AWS_LTM_PRIME_SAFE)) ? 4 : 2;
+  w.sieve = sieve;
+  w.t     = t;
+  w.safe  = (flags & AWS_LTM_PRIME_SAFE) ? 1 : 0;
+  w.n     = AWS_MP_PRIME_WINDOW;
+  add     = (aws_mp_digit)AWS_MP_PRIME_WINDOW * w.step;
+
+  /* the residues of the first window */
+  for (x = 0; x < np; x++) {
+    if ((err = aws_mp_mod_d(a, (aws_mp_digit)primes[x], res_tab + x)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+  }
+
+  for (;;) {
+    for (x = 0; x < w.n; x++) {
+      sieve[x] = 0;
+    }
+    for (x = 0; x < np; x++) {
+      s_mp_prime_strike(sieve, w.n, (unsigned long)res_tab[x], 0, primes[x], (unsigned long)w.step);
+      if (w.safe != 0) {
+        s_mp_prime_strike(sieve, w.n, (unsigned long)res_tab[x], 1, primes[x], (unsigned long)w.step);
+      }
+    }
+
+    w.next = 0;
+    w.best = w.n;
+    if ((err = aws_s_mp_pool_run(s_mp_prime_run, &w, threads, w.n)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+
+    if (w.best < w.n) {
+      err = aws_mp_add_d(a, (aws_mp_digit)w.best * w.step, a);
+      *result = AWS_MP_YES;
+      goto LBL_ERR;
+    }
+
+    /* on to the next window */
+    if ((err = aws_mp_add_d(a, add, a)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+    if (windows > 0 && --windows == 0) {
+      break;
+    }
+    for (x = 0; x < np; x++) {
+      res_tab[x] = (aws_mp_digit)(((unsigned long)res_tab[x] + (unsigned long)add % primes[x]) % primes[x]);
+    }
+  }
+  err = AWS_MP_OKAY;
+
+LBL_ERR:
+  if (primes != NULL) {
+    AWS_XFREE(primes);
+  }
+  if (res_tab != NULL) {
+    AWS_XFREE(res_tab);
+  }
+  if (sieve != NULL) {
+    AWS_XFREE(sieve);
+  }
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_MP_PRIME_NEXT_PRIME_C
+
+/* finds the next prime after the number "a" using "t" trials
+ * of Miller-Rabin.
+ *
+ * bbs_style = 1 means the prime must be congruent to 3 mod 4
+ */
+int aws_mp_prime_next_prime(aws_mp_int *a, int t, int bbs_style)
+{
+   return aws_mp_prime_next_prime_mt(a, t, bbs_style, 1);
+}
+
+/* the same with the candidates tested on "threads" threads */
+int aws_mp_prime_next_prime_mt(aws_mp_int *a, int t, int bbs_style, int threads)
+{
+   int      err, res = 0, x, y;
+   aws_mp_digit kstep;
+
+   /* ensure t is valid */
+   if (t <= 0 || t > AWS_JKTM_PRIME_SIZE) {
       return AWS_MP_VAL;
    }
 
@@ -1428,75 +2391,12 @@ int aws_mp_prime_next_prime(aws_mp_int *a, int t, int bbs_style)
       }
    }
 
-   /* generate the restable */
-   for (x = 1; x < AWS_JKTM_PRIME_SIZE; x++) {
-      if ((err = aws_mp_mod_d(a, aws_ltm_prime_tab[x], res_tab + x)) != AWS_MP_OKAY) {
-         return err;
-      }
-   }
-
-   /* init temp used for Miller-Rabin Testing */
-   if ((err = aws_mp_init(&b)) != AWS_MP_OKAY) {
+   /* the first candidate is the next number of that form */
+   if ((err = aws_mp_add_d(a, kstep, a)) != AWS_MP_OKAY) {
       return err;
    }
 
-   for (;;) {
-      /* skip to the next non-trivially divisible candidate */
-      step = 0;
-      do {
-         /* y == 1 if any residue was zero [e.g. cannot be prime] */
-         y     =  0;
-
-         /* increase step to next candidate */
-         step += kstep;
-
-         /* compute the new residue without using division */
-         for (x = 1; x < AWS_JKTM_PRIME_SIZE; x++) {
-             /* add the step to each residue */
-             res_tab[x] += kstep;
-
-             /* subtract the modulus [instead of using division] */
-             if (res_tab[x] >= aws_ltm_prime_tab[x]) {
-                res_tab[x]  -= aws_ltm_prime_tab[x];
-             }
-
-             /* set flag if zero */
-             if (res_tab[x] == 0) {
-                y = 1;
-             }
-         }
-      } while (y == 1 && step < ((((aws_mp_digit)1)<<AWS_DIGIT_BIT) - kstep));
-
-      /* add the step */
-      if ((err = aws_mp_add_d(a, step, a)) != AWS_MP_OKAY) {
-         goto LBL_ERR;
-      }
-
-      /* if didn't pass sieve and step == MAX then skip test */
-      if (y == 1 && step >= ((((aws_mp_digit)1)<<AWS_DIGIT_BIT) - kstep)) {
-         continue;
-      }
-
-      /* is this prime? */
-      for (x = 0; x < t; x++) {
-          aws_mp_set(&b, aws_ltm_prime_tab[x]);
-          if ((err = aws_mp_prime_miller_rabin(a, &b, &res)) != AWS_MP_OKAY) {
-             goto LBL_ERR;
-          }
-          if (res == AWS_MP_NO) {
-             break;
-          }
-      }
-
-      if (res == AWS_MP_YES) {
-         break;
-      }
-   }
-
-   err = AWS_MP_OKAY;
-LBL_ERR:
-aws_mp_clear(&b);
-   return err;
+   return aws_s_mp_prime_search(a, t, (bbs_style == 1) ? AWS_LTM_PRIME_BBS : 0, 0, threads, &res);
 }
 
 #endif
@@ -1506,11 +2406,37 @@ aws_mp_clear(&b);
 /* hac 14.61, pp608 */
 int aws_mp_invmod(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
 {
+#ifdef AWS_BN_S_MP_GCD_LEHMER_C
+  aws_mp_int g, U;
+  int        res;
+#endif
+
   /* b cannot be negative */
   if (b->sign == AWS_MP_NEG || aws_mp_iszero(b) == 1) {
     return AWS_MP_VAL;
   }
 
+#ifdef AWS_BN_S_MP_GCD_LEHMER_C
+  /* U*|a| + V*b = gcd(a, b), U is the inverse of |a| if that is one */
+  if ((res = aws_mp_init_multi(&g, &U, NULL)) != AWS_MP_OKAY) {
+    return res;
+  }
+  if ((res = aws_s_mp_gcd_lehmer(a, b, &g, &U)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+  if (aws_mp_cmp_d(&g, 1) != AWS_MP_EQ) {
+    res = AWS_MP_VAL;
+    goto LBL_ERR;
+  }
+  if (a->sign == AWS_MP_NEG) {
+    aws_mp_neg(&U, &U);
+  }
+  res = aws_mp_mod(&U, b, c);
+LBL_ERR:
+aws_mp_clear_multi(&g, &U, NULL);
+  return res;
+#endif
+
 #ifdef AWS_BN_FAST_MP_INVMOD_C
   /* if the modulus is odd we can use a faster routine instead */
   if (aws_mp_isodd (b) == 1) {
@@ -1526,35 +2452,168 @@ int aws_mp_invmod(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
 }
 #endif
 
-#ifdef AWS_BN_MP_DIV_2_C
+#ifdef AWS_BN_MP_INVMOD_BATCH_C
 
-/* b = a/2 */
-int aws_mp_div_2(aws_mp_int *a, aws_mp_int *b)
+/* b[i] = 1/a[i] (mod N) for 0 <= i < n, Montgomery's simultaneous inversion
+ *
+ * The prefix products c[i] = a[0]*...*a[i] are inverted with a single
+ * aws_mp_invmod() and the inverses are peeled off from the back, which costs
+ * 3(n-1) multiplications in the context's domain on top of it.  In Montgomery
+ * mode every raw product carries a factor 1/R, the walk back cancels each one
+ * of the prefixes' so no conversion into or out of the domain is needed.
+ *
+ * If any a[i] has no inverse the whole batch fails with AWS_MP_VAL and b is
+ * left unspecified.  b may be the same array as a.
+ */
+
+/* *p = a if it is in [0, N), else t = a mod N and *p = t */
+static int s_mp_invmod_batch_in(aws_mp_int *a, aws_mp_mod_ctx *ctx, aws_mp_int *t, aws_mp_int **p)
 {
-  int     x, res, oldused;
+  int err;
 
-  /* copy */
-  if (b->alloc < a->used) {
-    if ((res = aws_mp_grow(b, a->used)) != AWS_MP_OKAY) {
-      return res;
-    }
+  if (a->sign == AWS_MP_NEG || aws_mp_cmp_mag(a, &ctx->N) != AWS_MP_LT) {
+     if ((err = aws_mp_mod(a, &ctx->N, t)) != AWS_MP_OKAY) {
+        return err;
+     }
+     *p = t;
+  } else {
+     *p = a;
   }
+  return AWS_MP_OKAY;
+}
 
-  oldused = b->used;
-  b->used = a->used;
-  {
-    register aws_mp_digit r, rr, *tmpa, *tmpb;
+int aws_mp_invmod_batch(aws_mp_int *a, aws_mp_int *b, int n, aws_mp_mod_ctx *ctx)
+{
+  aws_mp_int *c, *p, inv, t, u;
+  int         err, nu, i, x;
 
-    /* source alias */
-    tmpa = a->dp + b->used - 1;
+  if (n < 0) {
+    return AWS_MP_VAL;
+  }
+  if (n == 0) {
+    return AWS_MP_OKAY;
+  }
+  nu = ctx->N.used;
 
-    /* dest alias */
-    tmpb = b->dp + b->used - 1;
+  c = AWS_OPT_CAST(aws_mp_int) AWS_XMALLOC(sizeof(aws_mp_int) * n);
+  if (c == NULL) {
+    return AWS_MP_MEM;
+  }
 
-    /* carry */
-    r = 0;
-    for (x = b->used - 1; x >= 0; x--) {
-      /* get the carry for the next iteration */
+  aws_mp_scratch_begin();
+  for (i = 0; i < n; i++) {
+    if ((err = aws_mp_init_scratch(&c[i], nu)) != AWS_MP_OKAY) {
+      for (x = 0; x < i; x++) {
+          aws_mp_clear(&c[x]);
+      }
+      goto LBL_END;
+    }
+  }
+  if ((err = aws_mp_init_scratch(&inv, nu)) != AWS_MP_OKAY) {
+    goto LBL_C;
+  }
+  if ((err = aws_mp_init_scratch(&t, 2 * nu + 1)) != AWS_MP_OKAY) {
+    goto LBL_INV;
+  }
+  if ((err = aws_mp_init_scratch(&u, 2 * nu + 1)) != AWS_MP_OKAY) {
+    goto LBL_T;
+  }
+
+  /* c[i] = a[0] * ... * a[i] */
+  if ((err = s_mp_invmod_batch_in(&a[0], ctx, &t, &p)) != AWS_MP_OKAY) {
+    goto LBL_U;
+  }
+  if ((err = aws_mp_copy(p, &c[0])) != AWS_MP_OKAY) {
+    goto LBL_U;
+  }
+  for (i = 1; i < n; i++) {
+    if ((err = s_mp_invmod_batch_in(&a[i], ctx, &t, &p)) != AWS_MP_OKAY) {
+      goto LBL_U;
+    }
+    if ((err = aws_mp_mod_ctx_mul(&c[i - 1], p, ctx, &u)) != AWS_MP_OKAY) {
+      goto LBL_U;
+    }
+    if ((err = aws_mp_copy(&u, &c[i])) != AWS_MP_OKAY) {
+      goto LBL_U;
+    }
+  }
+
+  /* a zero product has no inverse [and is the one aws_fast_mp_invmod() doesn't stop on] */
+  if (aws_mp_iszero(&c[n - 1]) == 1) {
+    err = AWS_MP_VAL;
+    goto LBL_U;
+  }
+  if ((err = aws_mp_invmod(&c[n - 1], &ctx->N, &inv)) != AWS_MP_OKAY) {
+    goto LBL_U;
+  }
+
+  /* inv = 1/c[i], b[i] = inv * c[i - 1] and step inv back to 1/c[i - 1] */
+  for (i = n - 1; i > 0; i--) {
+    /* the next inverse first, b[i] may be a[i] */
+    if ((err = s_mp_invmod_batch_in(&a[i], ctx, &t, &p)) != AWS_MP_OKAY) {
+      goto LBL_U;
+    }
+    if ((err = aws_mp_mod_ctx_mul(&inv, p, ctx, &u)) != AWS_MP_OKAY) {
+      goto LBL_U;
+    }
+    if ((err = aws_mp_mod_ctx_mul(&inv, &c[i - 1], ctx, &t)) != AWS_MP_OKAY) {
+      goto LBL_U;
+    }
+    if ((err = aws_mp_copy(&t, &b[i])) != AWS_MP_OKAY) {
+      goto LBL_U;
+    }
+    if ((err = aws_mp_copy(&u, &inv)) != AWS_MP_OKAY) {
+      goto LBL_U;
+    }
+  }
+  err = aws_mp_copy(&inv, &b[0]);
+
+LBL_U:
+aws_mp_clear(&u);
+LBL_T:
+aws_mp_clear(&t);
+LBL_INV:
+aws_mp_clear(&inv);
+LBL_C:
+  for (i = 0; i < n; i++) {
+      aws_mp_clear(&c[i]);
+  }
+LBL_END:
+  aws_mp_scratch_end();
+  AWS_XFREE(c);
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_MP_DIV_2_C
+
+/* b = a/2 */
+int aws_mp_div_2(aws_mp_int *a, aws_mp_int *b)
+{
+  int     x, res, oldused;
+
+  /* copy */
+  if (b->alloc < a->used) {
+    if ((res = aws_mp_grow(b, a->used)) != AWS_MP_OKAY) {
+      return res;
+    }
+  }
+
+  oldused = b->used;
+  b->used = a->used;
+  {
+    register aws_mp_digit r, rr, *tmpa, *tmpb;
+
+    /* source alias */
+    tmpa = a->dp + b->used - 1;
+
+    /* dest alias */
+    tmpb = b->dp + b->used - 1;
+
+    /* carry */
+    r = 0;
+    for (x = b->used - 1; x >= 0; x--) {
+      /* get the carry for the next iteration */
       rr = *tmpa & 1;
 
       /* shift the current digit, add in carry and store */
@@ -1618,6 +2677,223 @@ int aws_mp_init_multi(aws_mp_int *mp, ...)
 
 #endif
 
+#ifdef AWS_BN_MP_SCRATCH_C
+
+#include <stdarg.h>
+
+/* per thread scratch arena for short lived temporaries
+ *
+ * Between aws_mp_scratch_begin() and the matching aws_mp_scratch_end() the
+ * integers set up with aws_mp_init_scratch() take their digits from one block
+ * by bumping a pointer, and the end of the scope gives them all back at once.
+ * Clearing such an integer frees nothing and growing it moves it to the heap.
+ *
+ * The block is only (re)sized when the outermost scope opens, to the largest
+ * amount a scope asked for so far, so after the first call a routine that
+ * uses the arena does not touch the heap for its temporaries at all.
+ *
+ * Scratch integers must not outlive their scope, results are copied out
+ * rather than aws_mp_exch'ed into the caller's integers.  The block stays with
+ * the thread until aws_mp_scratch_release() or until the thread exits: it is
+ * also kept under a pthread key whose destructor frees it, so the threads of
+ * a dispatch queue or an operation queue, which never hand it back, don't
+ * leak it.  Builds without pthreads [AWS_MP_NO_THREADS, or MSVC] rely on
+ * aws_mp_scratch_release() alone.
+ */
+
+#if defined(_MSC_VER)
+   #define AWS_MP_THREAD_LOCAL __declspec(thread)
+#else
+   #define AWS_MP_THREAD_LOCAL __thread
+#endif
+
+#if !defined(AWS_MP_NO_THREADS) && !defined(_MSC_VER)
+   #include <pthread.h>
+   #define AWS_MP_SCRATCH_KEY
+#endif
+
+typedef struct {
+   aws_mp_digit *dp;
+   int size, top, peak, depth;
+   int mark[AWS_MP_SCRATCH_DEPTH];
+} aws_mp_scratch_arena;
+
+static AWS_MP_THREAD_LOCAL aws_mp_scratch_arena s_mp_scratch;
+
+#ifdef AWS_MP_SCRATCH_KEY
+static pthread_key_t  s_mp_scratch_key;
+static pthread_once_t s_mp_scratch_once = PTHREAD_ONCE_INIT;
+static int            s_mp_scratch_keyed;
+
+/* thread exit, the block is "dp" [the arena itself may already be gone] */
+static void s_mp_scratch_free(void *dp)
+{
+  aws_mp_scratch_arena *s = &s_mp_scratch;
+
+  /* a destructor running after this one may still use the library */
+  if (s->dp == dp) {
+    s->dp   = NULL;
+    s->size = s->top = s->peak = 0;
+  }
+  AWS_XFREE(dp);
+}
+
+static void s_mp_scratch_key_init(void)
+{
+  s_mp_scratch_keyed = (pthread_key_create(&s_mp_scratch_key, s_mp_scratch_free) == 0);
+}
+
+/* files "dp" as the block to free at thread exit, AWS_MP_NO if that can't be done */
+static int s_mp_scratch_keep(aws_mp_digit *dp)
+{
+  pthread_once(&s_mp_scratch_once, s_mp_scratch_key_init);
+  if (s_mp_scratch_keyed == 0 || pthread_setspecific(s_mp_scratch_key, dp) != 0) {
+    return AWS_MP_NO;
+  }
+  return AWS_MP_YES;
+}
+#else
+   #define s_mp_scratch_keep(dp) AWS_MP_YES
+#endif
+
+void aws_mp_scratch_begin(void)
+{
+  aws_mp_scratch_arena *s = &s_mp_scratch;
+  aws_mp_digit *tmp;
+  int size;
+
+  /* nothing lives in the block outside of a scope so it can be replaced,
+   * one that couldn't be freed at thread exit is not taken at all
+   */
+  if (s->depth == 0 && s->peak > s->size) {
+    size = AWS_MIN(s->peak, AWS_MP_SCRATCH_DIGS);
+    if (size > s->size) {
+      tmp = AWS_OPT_CAST(aws_mp_digit) AWS_XMALLOC (sizeof (aws_mp_digit) * size);
+      if (tmp != NULL && s_mp_scratch_keep(tmp) == AWS_MP_NO) {
+        AWS_XFREE(tmp);
+        tmp = NULL;
+      }
+      if (tmp != NULL) {
+        if (s->dp != NULL) {
+          AWS_XFREE(s->dp);
+        }
+        s->dp   = tmp;
+        s->size = size;
+      }
+    }
+  }
+
+  /* scopes nested too deep share the innermost mark */
+  if (s->depth < AWS_MP_SCRATCH_DEPTH) {
+    s->mark[s->depth] = s->top;
+  }
+  ++(s->depth);
+}
+
+void aws_mp_scratch_end(void)
+{
+  aws_mp_scratch_arena *s = &s_mp_scratch;
+
+  if (s->depth == 0) {
+    return;
+  }
+  if (--(s->depth) < AWS_MP_SCRATCH_DEPTH) {
+    s->top = s->mark[s->depth];
+  }
+}
+
+int aws_mp_init_scratch(aws_mp_int *a, int size)
+{
+  aws_mp_scratch_arena *s = &s_mp_scratch;
+  int x;
+
+  /* a little slack for carries, digit aligned to 4 */
+  size = (size + 4) & ~3;
+
+  if (s->depth == 0 || s->depth > AWS_MP_SCRATCH_DEPTH) {
+    return aws_mp_init_size(a, size);
+  }
+
+  /* top keeps counting past a full block so the next outermost scope knows
+   * how much the whole scope wanted
+   */
+  s->top += size;
+  if (s->top > s->peak) {
+    s->peak = s->top;
+  }
+  if (s->top > s->size) {
+    return aws_mp_init_size(a, size);
+  }
+
+  a->dp    = s->dp + (s->top - size);
+  a->used  = 0;
+  a->alloc = size;
+  a->sign  = AWS_MP_ZPOS;
+
+  for (x = 0; x < size; x++) {
+      a->dp[x] = 0;
+  }
+
+  return AWS_MP_OKAY;
+}
+
+int aws_mp_init_multi_scratch(int size, aws_mp_int *mp, ...)
+{
+    aws_mp_err res = AWS_MP_OKAY;
+    int n = 0;
+    aws_mp_int * cur_arg = mp;
+    va_list args;
+
+    va_start(args, mp);
+    while (cur_arg != NULL) {
+        if (aws_mp_init_scratch(cur_arg, size) != AWS_MP_OKAY) {
+            va_list clean_args;
+
+            va_end(args);
+
+            cur_arg = mp;
+            va_start(clean_args, mp);
+            while (n--) {
+                aws_mp_clear(cur_arg);
+                cur_arg = va_arg(clean_args, aws_mp_int*);
+            }
+            va_end(clean_args);
+            res = AWS_MP_MEM;
+            break;
+        }
+        n++;
+        cur_arg = va_arg(args, aws_mp_int*);
+    }
+    va_end(args);
+    return res;
+}
+
+int aws_mp_scratch_owns(const aws_mp_digit *dp)
+{
+  aws_mp_scratch_arena *s = &s_mp_scratch;
+
+  if (s->dp != NULL && dp >= s->dp && dp < s->dp + s->size) {
+    return AWS_MP_YES;
+  }
+  return AWS_MP_NO;
+}
+
+void aws_mp_scratch_release(void)
+{
+  aws_mp_scratch_arena *s = &s_mp_scratch;
+
+  if (s->depth != 0 || s->dp == NULL) {
+    return;
+  }
+#ifdef AWS_MP_SCRATCH_KEY
+  pthread_setspecific(s_mp_scratch_key, NULL);
+#endif
+  AWS_XFREE(s->dp);
+  s->dp   = NULL;
+  s->size = s->top = s->peak = 0;
+}
+#endif
+
 #ifdef AWS_BN_MP_READ_UNSIGNED_BIN_C
 
 /* reads a unsigned char array, assumes the msb is stored first [big endian] */
@@ -1700,22 +2976,27 @@ int aws_mp_karatsuba_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
   /* now divide in two */
   B = B >> 1;
 
+  /* the temps come from the scratch arena, x0, t1 and x1y1 end up holding
+   * (a->used + b->used) digit values so they start out that large
+   */
+  aws_mp_scratch_begin();
+
   /* init copy all the temps */
-  if (aws_mp_init_size(&x0, B) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&x0, a->used + b->used) != AWS_MP_OKAY)
     goto ERR;
-  if (aws_mp_init_size(&x1, a->used - B) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&x1, a->used - B) != AWS_MP_OKAY)
     goto X0;
-  if (aws_mp_init_size(&y0, B) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&y0, B) != AWS_MP_OKAY)
     goto X1;
-  if (aws_mp_init_size(&y1, b->used - B) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&y1, b->used - B) != AWS_MP_OKAY)
     goto Y0;
 
   /* init temps */
-  if (aws_mp_init_size(&t1, B * 2) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&t1, a->used + b->used) != AWS_MP_OKAY)
     goto Y1;
-  if (aws_mp_init_size(&x0y0, B * 2) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&x0y0, B * 2) != AWS_MP_OKAY)
     goto T1;
-  if (aws_mp_init_size(&x1y1, B * 2) != AWS_MP_OKAY)
+  if (aws_mp_init_scratch(&x1y1, a->used + b->used) != AWS_MP_OKAY)
     goto X0Y0;
 
   /* now shift the digits */
@@ -1807,6 +3088,7 @@ aws_mp_clear(&x1);
 X0:
 aws_mp_clear(&x0);
 ERR:
+  aws_mp_scratch_end();
   return err;
 }
 #endif
@@ -1982,6 +3264,129 @@ int aws_mp_init_copy(aws_mp_int *a, aws_mp_int *b)
 }
 #endif
 
+#ifdef AWS_BN_S_MP_MONTGOMERY_FIXED_C
+
+/* Montgomery kernels for one modulus size
+ *
+ * aws_tommath_fixed.h is written by tools/tommath/fixed.c for AWS_MP_FIXED_BITS bit
+ * moduli, the 3072-bit SRP group as shipped.  Its rows are spelled out for
+ * exactly AWS_MP_FIXED_DIGS digits, so no row tests a bound or the used count
+ * of an operand.  The aws_fast_mp_montgomery_* routines come here whenever the
+ * modulus has that many digits.
+ */
+#include "aws_tommath_fixed.h"
+
+#ifdef AWS_MP_FIXED_DIGS
+
+/* the digits of a padded to AWS_MP_FIXED_DIGS, a's own if it has that many */
+static const aws_mp_digit *s_mp_fixed_in(aws_mp_int *a, aws_mp_digit *buf)
+{
+  int ix;
+
+  if (a->used == AWS_MP_FIXED_DIGS) {
+    return a->dp;
+  }
+  for (ix = 0; ix < a->used; ix++) {
+    buf[ix] = a->dp[ix];
+  }
+  for (; ix < AWS_MP_FIXED_DIGS; ix++) {
+    buf[ix] = 0;
+  }
+  return buf;
+}
+
+/* c = abR**-1 (mod m), or aaR**-1 if b is NULL, for reduced a and b.  With ct
+ * set c is left padded to the width of m as aws_fast_mp_montgomery_mul_ct does,
+ * otherwise it is clamped.
+ */
+int aws_s_mp_montgomery_fixed(aws_mp_int *a, aws_mp_int *b, aws_mp_int *m, aws_mp_digit mp, aws_mp_int *c, int ct)
+{
+  aws_mp_word  W[AWS_MP_FIXED_DIGS];
+  aws_mp_digit ta[AWS_MP_FIXED_DIGS], tb[AWS_MP_FIXED_DIGS];
+  int          ix, res, olduse;
+
+  if (m->used != AWS_MP_FIXED_DIGS || a->used > m->used || (b != NULL && b->used > m->used)) {
+    return AWS_MP_VAL;
+  }
+  if (b == NULL) {
+    s_mp_fixed_sqr_cols(s_mp_fixed_in(a, ta), m->dp, mp, W);
+  } else {
+    s_mp_fixed_mul_cols(s_mp_fixed_in(a, ta), s_mp_fixed_in(b, tb), m->dp, mp, W);
+  }
+
+  /* a and b are read, c may be either of them */
+  if (c->alloc < AWS_MP_FIXED_DIGS) {
+    if ((res = aws_mp_grow(c, AWS_MP_FIXED_DIGS)) != AWS_MP_OKAY) {
+      return res;
+    }
+  }
+  olduse = c->used;
+  s_mp_fixed_out(W, m->dp, c->dp);
+  for (ix = AWS_MP_FIXED_DIGS; ix < olduse; ix++) {
+    c->dp[ix] = 0;
+  }
+  c->used = AWS_MP_FIXED_DIGS;
+  c->sign = AWS_MP_ZPOS;
+  if (ct == 0) {
+      aws_mp_clamp(c);
+  }
+  return AWS_MP_OKAY;
+}
+
+/* x = xR**-1 (mod n), see aws_fast_mp_montgomery_reduce.  Only x < nR is
+ * taken, which leaves less than 2n for the one final subtraction, anything
+ * larger is AWS_MP_VAL and left to the general routine.
+ */
+int aws_s_mp_montgomery_fixed_reduce(aws_mp_int *x, aws_mp_int *n, aws_mp_digit rho)
+{
+  aws_mp_word  W[AWS_MP_FIXED_DIGS];
+  aws_mp_digit tx[2 * AWS_MP_FIXED_DIGS];
+  int          ix, res, olduse;
+
+  if (n->used != AWS_MP_FIXED_DIGS || x->used > 2 * AWS_MP_FIXED_DIGS) {
+    return AWS_MP_VAL;
+  }
+
+  /* compare x/R with n from the top digit down */
+  for (ix = AWS_MP_FIXED_DIGS - 1; ix >= 0 && x->used > AWS_MP_FIXED_DIGS; ix--) {
+    aws_mp_digit xd = (AWS_MP_FIXED_DIGS + ix < x->used) ? x->dp[AWS_MP_FIXED_DIGS + ix] : 0;
+    if (xd != n->dp[ix]) {
+      if (xd > n->dp[ix]) {
+        return AWS_MP_VAL;
+      }
+      break;
+    }
+  }
+  if (ix < 0) {
+    return AWS_MP_VAL;
+  }
+
+  for (ix = 0; ix < x->used; ix++) {
+    tx[ix] = x->dp[ix];
+  }
+  for (; ix < 2 * AWS_MP_FIXED_DIGS; ix++) {
+    tx[ix] = 0;
+  }
+  s_mp_fixed_reduce_cols(tx, n->dp, rho, W);
+
+  if (x->alloc < AWS_MP_FIXED_DIGS) {
+    if ((res = aws_mp_grow(x, AWS_MP_FIXED_DIGS)) != AWS_MP_OKAY) {
+      return res;
+    }
+  }
+  olduse = x->used;
+  s_mp_fixed_out(W, n->dp, x->dp);
+  for (ix = AWS_MP_FIXED_DIGS; ix < olduse; ix++) {
+    x->dp[ix] = 0;
+  }
+  x->used = AWS_MP_FIXED_DIGS;
+  x->sign = AWS_MP_ZPOS;
+    aws_mp_clamp(x);
+  return AWS_MP_OKAY;
+}
+#endif
+#endif
+
 #ifdef AWS_BN_FAST_MP_MONTGOMERY_REDUCE_C
 
 /* computes xR**-1 == x (mod N) via Montgomery Reduction
@@ -1995,7 +3400,14 @@ int aws_mp_init_copy(aws_mp_int *a, aws_mp_int *b)
 int aws_fast_mp_montgomery_reduce(aws_mp_int *x, aws_mp_int *n, aws_mp_digit rho)
 {
   int     ix, res, olduse;
-	aws_mp_word W[AWS_MP_WARRAY] = {};
+  aws_mp_word W[AWS_MP_WARRAY];
+
+#if defined(AWS_BN_S_MP_MONTGOMERY_FIXED_C) && defined(AWS_MP_FIXED_DIGS)
+  /* the modulus size the spelled out kernels were written for, x < nR */
+  if (n->used == AWS_MP_FIXED_DIGS && aws_s_mp_montgomery_fixed_reduce(x, n, rho) == AWS_MP_OKAY) {
+    return AWS_MP_OKAY;
+  }
+#endif
 
   /* get old used count */
   olduse = x->used;
@@ -2025,8 +3437,10 @@ int aws_fast_mp_montgomery_reduce(aws_mp_int *x, aws_mp_int *n, aws_mp_digit rho
       *_W++ = *tmpx++;
     }
 
-    /* zero the high words of W[a->used..m->used*2] */
-    for (; ix < n->used * 2 + 1; ix++) {
+    /* zero the high words of W[a->used..m->used*2+1], the last one
+     * receives the final carry below
+     */
+    for (; ix < n->used * 2 + 2; ix++) {
       *_W++ = 0;
     }
   }
@@ -2136,17 +3550,281 @@ int aws_fast_mp_montgomery_reduce(aws_mp_int *x, aws_mp_int *n, aws_mp_digit rho
 }
 #endif
 
-#ifdef AWS_BN_MP_LSHD_C
+#ifdef AWS_BN_FAST_MP_MONTGOMERY_MUL_C
 
-/* shift left a certain amount of digits */
-int aws_mp_lshd(aws_mp_int *a, int b)
+/* Montgomery multiplication with the reduction interleaved [CIOS]
+ *
+ * aws_fast_mp_montgomery_reduce needs the full 2n digit product and then
+ * makes a second pass over it.  Coarsely Integrated Operand Scanning folds
+ * one reduction step into every row of the multiplication instead, so the
+ * running total is a window of n columns that shifts down one digit per row.
+ *
+ * Like the comba routines the columns are double precision words and the
+ * carries are only resolved once at the end.  A column collects at most 2n
+ * products while it is in the window which is what limits the modulus to
+ * AWS_MP_MONTGOMERY_DIGS digits.
+ *
+ * Both operands must be reduced, 0 <= a, b < m.  The result is abR**-1 (mod m).
+ */
+
+/* mu = r * m' mod b, the multiple of m that clears the low column */
+static aws_mp_digit s_mp_montgomery_mu(aws_mp_word r, aws_mp_digit mp)
 {
-  int     x, res;
+  return (aws_mp_digit)(((r & ((aws_mp_word)AWS_MP_MASK)) * ((aws_mp_word)mp)) & ((aws_mp_word)AWS_MP_MASK));
+}
 
-  /* if its less than zero return */
-  if (b <= 0) {
-    return AWS_MP_OKAY;
-  }
+/* c = W with the carries resolved, then the final conditional subtraction */
+static int s_mp_montgomery_cios_out(aws_mp_word *W, aws_mp_int *m, aws_mp_int *c)
+{
+  int ix, res, olduse;
+  register aws_mp_word r;
+
+  if (c->alloc < m->used + 1) {
+    if ((res = aws_mp_grow(c, m->used + 1)) != AWS_MP_OKAY) {
+      return res;
+    }
+  }
+
+  olduse  = c->used;
+  c->used = m->used + 1;
+  c->sign = AWS_MP_ZPOS;
+
+  r = 0;
+  for (ix = 0; ix < m->used; ix++) {
+    r += W[ix];
+    c->dp[ix] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK));
+    r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  }
+  c->dp[ix++] = (aws_mp_digit)r;
+  for (; ix < olduse; ix++) {
+    c->dp[ix] = 0;
+  }
+    aws_mp_clamp(c);
+
+  /* the total is below 2m, one subtraction is enough */
+  if (aws_mp_cmp_mag(c, m) != AWS_MP_LT) {
+    return aws_s_mp_sub(c, m, c);
+  }
+  return AWS_MP_OKAY;
+}
+
+/* W = abR**-1 as m->used uncarried columns */
+static void s_mp_montgomery_mul_cols(aws_mp_int *a, aws_mp_int *b, aws_mp_int *m, aws_mp_digit mp, aws_mp_word *W)
+{
+  int     ix, iy, nu;
+
+  nu = m->used;
+  for (ix = 0; ix < nu; ix++) {
+    W[ix] = 0;
+  }
+
+  for (ix = 0; ix < nu; ix++) {
+    register aws_mp_digit bi, mu, *tmpa, *tmpn;
+    register aws_mp_word  r;
+
+    bi   = (ix < b->used) ? b->dp[ix] : 0;
+    tmpa = a->dp;
+    tmpn = m->dp;
+
+    /* the low column picks mu and then leaves only its carry */
+    r = W[0];
+    if (a->used > 0) {
+      r += ((aws_mp_word)bi) * ((aws_mp_word)*tmpa++);
+    }
+    mu = s_mp_montgomery_mu(r, mp);
+    r += ((aws_mp_word)mu) * ((aws_mp_word)*tmpn++);
+    r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+
+    /* W = (W + a*b[ix] + mu*m)/b */
+    for (iy = 1; iy < a->used; iy++) {
+        W[iy - 1] = W[iy] + ((aws_mp_word)bi) * ((aws_mp_word)*tmpa++) + ((aws_mp_word)mu) * ((aws_mp_word)*tmpn++);
+    }
+    for (; iy < nu; iy++) {
+        W[iy - 1] = W[iy] + ((aws_mp_word)mu) * ((aws_mp_word)*tmpn++);
+    }
+    W[nu - 1] = 0;
+    W[0]     += r;
+  }
+}
+
+/* same as above without the data dependent clamp and compare: c - m is
+ * formed unconditionally and the final borrow picks c or c - m by mask
+ */
+static int s_mp_montgomery_cios_out_ct(aws_mp_word *W, aws_mp_int *m, aws_mp_int *c)
+{
+  int ix, res, olduse;
+  register aws_mp_word  r;
+  register aws_mp_digit hi, d, u, mask;
+
+  if (c->alloc < m->used + 1) {
+    if ((res = aws_mp_grow(c, m->used + 1)) != AWS_MP_OKAY) {
+      return res;
+    }
+  }
+
+  olduse  = c->used;
+  c->used = m->used;
+  c->sign = AWS_MP_ZPOS;
+
+  /* resolve the carries, the difference goes back into W */
+  r = 0;
+  u = 0;
+  for (ix = 0; ix < m->used; ix++) {
+    r += W[ix];
+    c->dp[ix] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK));
+    r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+
+    d     = c->dp[ix] - m->dp[ix] - u;
+    u     = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1);
+    W[ix] = (aws_mp_word)(d & AWS_MP_MASK);
+  }
+  hi = (aws_mp_digit)r;
+
+  /* keep c only if c - m went negative, i.e. borrowed past the top digit */
+  mask = (aws_mp_digit)0 - (u & (hi ^ 1u));
+  for (ix = 0; ix < m->used; ix++) {
+    c->dp[ix] = (c->dp[ix] & mask) | (((aws_mp_digit)W[ix]) & ~mask);
+  }
+  for (; ix < olduse; ix++) {
+    c->dp[ix] = 0;
+  }
+  return AWS_MP_OKAY;
+}
+
+int aws_fast_mp_montgomery_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *m, aws_mp_digit mp, aws_mp_int *c)
+{
+  aws_mp_word W[AWS_MP_MONTGOMERY_DIGS];
+
+  if (m->used > AWS_MP_MONTGOMERY_DIGS || a->used > m->used || b->used > m->used) {
+    return AWS_MP_VAL;
+  }
+#if defined(AWS_BN_S_MP_MONTGOMERY_FIXED_C) && defined(AWS_MP_FIXED_DIGS)
+  if (m->used == AWS_MP_FIXED_DIGS) {
+    return aws_s_mp_montgomery_fixed(a, b, m, mp, c, 0);
+  }
+#endif
+  s_mp_montgomery_mul_cols(a, b, m, mp, W);
+  return s_mp_montgomery_cios_out(W, m, c);
+}
+
+/* fixed width variant for aws_mp_exptmod_ct: the loops only depend on m->used
+ * when a and b are padded to m->used digits, and c is left padded the same
+ * way [unclamped] by a masked final subtraction.
+ */
+int aws_fast_mp_montgomery_mul_ct(aws_mp_int *a, aws_mp_int *b, aws_mp_int *m, aws_mp_digit mp, aws_mp_int *c)
+{
+  aws_mp_word W[AWS_MP_MONTGOMERY_DIGS];
+
+  if (m->used > AWS_MP_MONTGOMERY_DIGS || a->used > m->used || b->used > m->used) {
+    return AWS_MP_VAL;
+  }
+#if defined(AWS_BN_S_MP_MONTGOMERY_FIXED_C) && defined(AWS_MP_FIXED_DIGS)
+  if (m->used == AWS_MP_FIXED_DIGS) {
+    return aws_s_mp_montgomery_fixed(a, b, m, mp, c, 1);
+  }
+#endif
+  s_mp_montgomery_mul_cols(a, b, m, mp, W);
+  return s_mp_montgomery_cios_out_ct(W, m, c);
+}
+
+/* b = aaR**-1 (mod m)
+ *
+ * Row ix only adds a[ix]**2 and the doubled cross products a[ix]a[iy] with
+ * iy > ix.  After ix reduction steps the window starts at digit ix, so the
+ * square of a[ix] lands in column ix of the window and the cross product
+ * with a[iy] in column iy.  That is half the single precision products of
+ * the multiplication for the same number of reduction steps.
+ */
+static void s_mp_montgomery_sqr_cols(aws_mp_int *a, aws_mp_int *m, aws_mp_digit mp, aws_mp_word *W)
+{
+  int     ix, iy, nu;
+
+  nu = m->used;
+  for (ix = 0; ix < nu; ix++) {
+    W[ix] = 0;
+  }
+
+  for (ix = 0; ix < nu; ix++) {
+    register aws_mp_digit ai, mu, *tmpa, *tmpn;
+    register aws_mp_word  r;
+
+    ai   = (ix < a->used) ? a->dp[ix] : 0;
+    tmpn = m->dp;
+
+    r = W[0];
+    if (ix == 0) {
+      r += ((aws_mp_word)ai) * ((aws_mp_word)ai);
+    }
+    mu = s_mp_montgomery_mu(r, mp);
+    r += ((aws_mp_word)mu) * ((aws_mp_word)*tmpn++);
+    r >>= ((aws_mp_word)AWS_DIGIT_BIT);
+
+    /* columns below ix only see the reduction */
+    for (iy = 1; iy < ix; iy++) {
+        W[iy - 1] = W[iy] + ((aws_mp_word)mu) * ((aws_mp_word)*tmpn++);
+    }
+
+    /* the square term, then the doubled cross products */
+    if (ix > 0) {
+        W[ix - 1] = W[ix] + ((aws_mp_word)ai) * ((aws_mp_word)ai) + ((aws_mp_word)mu) * ((aws_mp_word)*tmpn++);
+        iy = ix + 1;
+    }
+    tmpa = a->dp + iy;
+    for (; iy < a->used; iy++) {
+        W[iy - 1] = W[iy] + ((((aws_mp_word)ai) * ((aws_mp_word)*tmpa++)) << 1) + ((aws_mp_word)mu) * ((aws_mp_word)*tmpn++);
+    }
+    for (; iy < nu; iy++) {
+        W[iy - 1] = W[iy] + ((aws_mp_word)mu) * ((aws_mp_word)*tmpn++);
+    }
+    W[nu - 1] = 0;
+    W[0]     += r;
+  }
+}
+
+int aws_fast_mp_montgomery_sqr(aws_mp_int *a, aws_mp_int *m, aws_mp_digit mp, aws_mp_int *b)
+{
+  aws_mp_word W[AWS_MP_MONTGOMERY_DIGS];
+
+  if (m->used > AWS_MP_MONTGOMERY_DIGS || a->used > m->used) {
+    return AWS_MP_VAL;
+  }
+#if defined(AWS_BN_S_MP_MONTGOMERY_FIXED_C) && defined(AWS_MP_FIXED_DIGS)
+  if (m->used == AWS_MP_FIXED_DIGS) {
+    return aws_s_mp_montgomery_fixed(a, NULL, m, mp, b, 0);
+  }
+#endif
+  s_mp_montgomery_sqr_cols(a, m, mp, W);
+  return s_mp_montgomery_cios_out(W, m, b);
+}
+
+int aws_fast_mp_montgomery_sqr_ct(aws_mp_int *a, aws_mp_int *m, aws_mp_digit mp, aws_mp_int *b)
+{
+  aws_mp_word W[AWS_MP_MONTGOMERY_DIGS];
+
+  if (m->used > AWS_MP_MONTGOMERY_DIGS || a->used > m->used) {
+    return AWS_MP_VAL;
+  }
+#if defined(AWS_BN_S_MP_MONTGOMERY_FIXED_C) && defined(AWS_MP_FIXED_DIGS)
+  if (m->used == AWS_MP_FIXED_DIGS) {
+    return aws_s_mp_montgomery_fixed(a, NULL, m, mp, b, 1);
+  }
+#endif
+  s_mp_montgomery_sqr_cols(a, m, mp, W);
+  return s_mp_montgomery_cios_out_ct(W, m, b);
+}
+#endif
+
+#ifdef AWS_BN_MP_LSHD_C
+
+/* shift left a certain amount of digits */
+int aws_mp_lshd(aws_mp_int *a, int b)
+{
+  int     x, res;
+
+  /* if its less than zero return, zero stays zero [and clamped] */
+  if (b <= 0 || a->used == 0) {
+    return AWS_MP_OKAY;
+  }
 
   /* grow to fit the new digits */
   if (a->alloc < a->used + b) {
@@ -2274,12 +3952,50 @@ int aws_mp_or(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
 /* Extended euclidean algorithm of (a, b) produces 
    a*u1 + b*u2 = u3
  */
+#ifdef AWS_BN_S_MP_GCD_LEHMER_C
+int aws_mp_exteuclid(aws_mp_int *a, aws_mp_int *b, aws_mp_int *U1, aws_mp_int *U2, aws_mp_int *U3)
+{
+   aws_mp_int u1, u2, u3;
+   int err;
+
+   if ((err = aws_mp_init_multi(&u1, &u2, &u3, NULL)) != AWS_MP_OKAY) {
+      return err;
+   }
+
+   /* u1*|a| + v*|b| = u3 with the cofactor Euclid's algorithm ends on */
+   if ((err = aws_s_mp_gcd_lehmer(a, b, &u3, &u1)) != AWS_MP_OKAY)                         { goto _ERR; }
+   if (a->sign == AWS_MP_NEG) {
+       aws_mp_neg(&u1, &u1);
+   }
+
+   /* u2 = (u3 - a*u1)/b, exactly */
+   if (aws_mp_iszero(b) == AWS_MP_NO) {
+      if ((err = aws_mp_mul(a, &u1, &u2)) != AWS_MP_OKAY)                                  { goto _ERR; }
+      if ((err = aws_mp_sub(&u3, &u2, &u2)) != AWS_MP_OKAY)                                { goto _ERR; }
+      if ((err = aws_mp_div(&u2, b, &u2, NULL)) != AWS_MP_OKAY)                            { goto _ERR; }
+   }
+
+   /* copy result out */
+   if (U1 != NULL) { if ((err = aws_mp_copy(&u1, U1)) != AWS_MP_OKAY)                     { goto _ERR; } }
+   if (U2 != NULL) { if ((err = aws_mp_copy(&u2, U2)) != AWS_MP_OKAY)                     { goto _ERR; } }
+   if (U3 != NULL) { if ((err = aws_mp_copy(&u3, U3)) != AWS_MP_OKAY)                     { goto _ERR; } }
+
+   err = AWS_MP_OKAY;
+_ERR:
+aws_mp_clear_multi(&u1, &u2, &u3, NULL);
+   return err;
+}
+#else
 int aws_mp_exteuclid(aws_mp_int *a, aws_mp_int *b, aws_mp_int *U1, aws_mp_int *U2, aws_mp_int *U3)
 {
    aws_mp_int u1,u2,u3,v1,v2,v3,t1,t2,t3,q,tmp;
    int err;
 
-   if ((err = aws_mp_init_multi(&u1, &u2, &u3, &v1, &v2, &v3, &t1, &t2, &t3, &q, &tmp, NULL)) != AWS_MP_OKAY) {
+   /* every temp stays below the larger input, take them from the scratch arena */
+   aws_mp_scratch_begin();
+   if ((err = aws_mp_init_multi_scratch(AWS_MAX(a->used, b->used) + 2,
+                                        &u1, &u2, &u3, &v1, &v2, &v3, &t1, &t2, &t3, &q, &tmp, NULL)) != AWS_MP_OKAY) {
+      aws_mp_scratch_end();
       return err;
    }
 
@@ -2323,16 +4039,18 @@ int aws_mp_exteuclid(aws_mp_int *a, aws_mp_int *b, aws_mp_int *U1, aws_mp_int *U
    }
 
    /* copy result out */
-   if (U1 != NULL) {aws_mp_exch(U1, &u1); }
-   if (U2 != NULL) {aws_mp_exch(U2, &u2); }
-   if (U3 != NULL) {aws_mp_exch(U3, &u3); }
+   if (U1 != NULL) { if ((err = aws_mp_copy(&u1, U1)) != AWS_MP_OKAY)                     { goto _ERR; } }
+   if (U2 != NULL) { if ((err = aws_mp_copy(&u2, U2)) != AWS_MP_OKAY)                     { goto _ERR; } }
+   if (U3 != NULL) { if ((err = aws_mp_copy(&u3, U3)) != AWS_MP_OKAY)                     { goto _ERR; } }
 
    err = AWS_MP_OKAY;
 _ERR:
 aws_mp_clear_multi(&u1, &u2, &u3, &v1, &v2, &v3, &t1, &t2, &t3, &q, &tmp, NULL);
+   aws_mp_scratch_end();
    return err;
 }
 #endif
+#endif
 
 #ifdef AWS_BN_MP_PRIME_RANDOM_EX_C
 
@@ -2349,13 +4067,23 @@ aws_mp_clear_multi(&u1, &u2, &u3, &v1, &v2, &v3, &t1, &t2, &t3, &q, &tmp, NULL);
  * have passed to the callback (e.g. a state or something).  This function doesn't use "dat" itself
  * so it can be NULL
  *
+ * Sizes the prime table can sieve take the first prime in the window of
+ * candidates following each random number instead of testing the number
+ * alone, which is a lot faster but favours primes after long gaps a little.
  */
 
 /* This is possibly the mother of all prime generation functions, muahahahahaha! */
 int aws_mp_prime_random_ex(aws_mp_int *a, int t, int size, int flags, aws_ltm_prime_callback cb, void *dat)
+{
+   return aws_mp_prime_random_ex_mt(a, t, size, flags, 1, cb, dat);
+}
+
+/* the same with the candidates tested on "threads" threads */
+int aws_mp_prime_random_ex_mt(aws_mp_int *a, int t, int size, int flags, int threads, aws_ltm_prime_callback cb,
+                              void *dat)
 {
    unsigned char *tmp, maskAND, maskOR_msb, maskOR_lsb;
-   int res, err, bsize, maskOR_msb_offset;
+   int res, err, bsize, maskOR_msb_offset, sieved;
 
    /* sanity check the input */
    if (size <= 1 || t <= 0) {
@@ -2410,6 +4138,19 @@ int aws_mp_prime_random_ex(aws_mp_int *a, int t, int size, int flags, aws_ltm_pr
       /* read it in */
       if ((err = aws_mp_read_unsigned_bin(a, tmp, bsize)) != AWS_MP_OKAY)     { goto error; }
 
+      /* large enough to sieve, the smallest sizes test the random numbers one by one */
+      sieved = (aws_mp_cmp_d(a, 2 * aws_ltm_prime_tab[AWS_JKTM_PRIME_SIZE - 1] + 1) == AWS_MP_GT) ? 1 : 0;
+      if (sieved == 1) {
+         if ((err = aws_s_mp_prime_search(a, t, flags, 1, threads, &res)) != AWS_MP_OKAY) { goto error; }
+
+         /* the prime found must not have run out of the size or the 2nd MSB */
+         if (res == AWS_MP_YES && (aws_mp_count_bits(a) != size ||
+             ((flags & AWS_LTM_PRIME_2MSB_ON) && ((a->dp[(size - 2) / AWS_DIGIT_BIT] >> ((size - 2) % AWS_DIGIT_BIT)) & 1) == 0))) {
+            res = AWS_MP_NO;
+         }
+         continue;
+      }
+
       /* is it prime? */
       if ((err = aws_mp_prime_is_prime(a, t, &res)) != AWS_MP_OKAY)           { goto error; }
       if (res == AWS_MP_NO) {
@@ -2426,7 +4167,7 @@ int aws_mp_prime_random_ex(aws_mp_int *a, int t, int size, int flags, aws_ltm_pr
       }
    } while (res == AWS_MP_NO);
 
-   if (flags & AWS_LTM_PRIME_SAFE) {
+   if ((flags & AWS_LTM_PRIME_SAFE) && sieved == 0) {
       /* restore a to the original value */
       if ((err = aws_mp_mul_2(a, a)) != AWS_MP_OKAY)                          { goto error; }
       if ((err = aws_mp_add_d(a, 1, a)) != AWS_MP_OKAY)                       { goto error; }
@@ -2536,8 +4277,7 @@ aws_mp_clear(&a1);
 int aws_mp_radix_size(aws_mp_int *a, int radix, int *size)
 {
   int     res, digs;
-  aws_mp_int t;
-  aws_mp_digit d;
+  char   *buf;
 
   *size = 0;
 
@@ -2557,31 +4297,27 @@ int aws_mp_radix_size(aws_mp_int *a, int radix, int *size)
     return AWS_MP_OKAY;
   }
 
-  /* digs is the digit count */
-  digs = 0;
-
-  /* if it's negative add one for the sign */
-  if (a->sign == AWS_MP_NEG) {
-    ++digs;
+  /* other power of two radices follow from the bit count as well */
+  if ((digs = aws_s_mp_radix_pow2(radix)) != 0) {
+    *size = (aws_mp_count_bits(a) + digs - 1) / digs + (a->sign == AWS_MP_NEG ? 1 : 0) + 1;
+    return AWS_MP_OKAY;
   }
 
-  /* init a copy of the input */
-  if ((res = aws_mp_init_copy(&t, a)) != AWS_MP_OKAY) {
+  /* the other radices are converted for real, the digits counted */
+  buf = AWS_OPT_CAST(char) AWS_XMALLOC (aws_mp_count_bits(a) + 1);
+  if (buf == NULL) {
+    return AWS_MP_MEM;
+  }
+  res = aws_s_mp_toradix_dc(a, buf, radix, &digs);
+  AWS_XFREE(buf);
+  if (res != AWS_MP_OKAY) {
     return res;
   }
 
-  /* force temp to positive */
-  t.sign = AWS_MP_ZPOS;
-
-  /* fetch out all of the digits */
-  while (aws_mp_iszero (&t) == AWS_MP_NO) {
-    if ((res = aws_mp_div_d(&t, (aws_mp_digit) radix, &t, &d)) != AWS_MP_OKAY) {
-        aws_mp_clear(&t);
-      return res;
-    }
+  /* if it's negative add one for the sign */
+  if (a->sign == AWS_MP_NEG) {
     ++digs;
   }
-    aws_mp_clear(&t);
 
   /* return digs + 1, the 1 is for the NULL byte that would be required. */
   *size = digs + 1;
@@ -2807,275 +4543,58 @@ aws_mp_montgomery_reduce(aws_mp_int *x, aws_mp_int *n, aws_mp_digit rho)
 
 #ifdef AWS_BN_S_MP_EXPTMOD_C
 
-#ifdef AWS_MP_LOW_MEM
-   #define TAB_SIZE 32
-#else
-   #define TAB_SIZE 256
-#endif
-
+/* computes Y == G**X mod P using Barrett (redmode 0) or
+ * 2k_l (redmode 1) reduction, see aws_mp_exptmod_ctx
+ */
 int aws_s_mp_exptmod(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int *Y, int redmode)
 {
-  aws_mp_int M[TAB_SIZE], res, mu;
-  aws_mp_digit buf;
-  int     err, bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize;
-  int (*redux)(aws_mp_int *, aws_mp_int *, aws_mp_int *);
+  aws_mp_mod_ctx ctx;
+  int     err;
 
-  /* find window size */
-  x = aws_mp_count_bits(X);
-  if (x <= 7) {
-    winsize = 2;
-  } else if (x <= 36) {
-    winsize = 3;
-  } else if (x <= 140) {
-    winsize = 4;
-  } else if (x <= 450) {
-    winsize = 5;
-  } else if (x <= 1303) {
-    winsize = 6;
-  } else if (x <= 3529) {
-    winsize = 7;
-  } else {
-    winsize = 8;
+  redmode = (redmode == 0) ? AWS_MP_REDUCE_BARRETT : AWS_MP_REDUCE_2K_L;
+  if ((err = aws_mp_mod_ctx_init_mode(&ctx, P, redmode)) != AWS_MP_OKAY) {
+     return err;
   }
-
-#ifdef AWS_MP_LOW_MEM
-    if (winsize > 5) {
-       winsize = 5;
-    }
+  err = aws_mp_exptmod_ctx(G, X, &ctx, Y);
+    aws_mp_mod_ctx_clear(&ctx);
+  return err;
+}
 #endif
 
-  /* init M array */
-  /* init first cell */
-  if ((err = aws_mp_init(&M[1])) != AWS_MP_OKAY) {
-     return err; 
-  }
+#ifdef AWS_BN_MP_SUB_D_C
 
-  /* now init the second half of the array */
-  for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
-    if ((err = aws_mp_init(&M[x])) != AWS_MP_OKAY) {
-      for (y = 1<<(winsize-1); y < x; y++) {
-          aws_mp_clear(&M[y]);
-      }
-        aws_mp_clear(&M[1]);
-      return err;
-    }
-  }
+/* single digit subtraction */
+int
+aws_mp_sub_d(aws_mp_int *a, aws_mp_digit b, aws_mp_int *c)
+{
+  aws_mp_digit *tmpa, *tmpc, mu;
+  int       res, ix, oldused;
 
-  /* create mu, used for Barrett reduction */
-  if ((err = aws_mp_init(&mu)) != AWS_MP_OKAY) {
-    goto LBL_M;
-  }
-  
-  if (redmode == 0) {
-     if ((err = aws_mp_reduce_setup(&mu, P)) != AWS_MP_OKAY) {
-        goto LBL_MU;
-     }
-     redux = aws_mp_reduce;
-  } else {
-     if ((err = aws_mp_reduce_2k_setup_l(P, &mu)) != AWS_MP_OKAY) {
-        goto LBL_MU;
+  /* grow c as required */
+  if (c->alloc < a->used + 1) {
+     if ((res = aws_mp_grow(c, a->used + 1)) != AWS_MP_OKAY) {
+        return res;
      }
-     redux = aws_mp_reduce_2k_l;
-  }    
-
-  /* create M table
-   *
-   * The M table contains powers of the base, 
-   * e.g. M[x] = G**x mod P
-   *
-   * The first half of the table is not 
-   * computed though accept for M[0] and M[1]
-   */
-  if ((err = aws_mp_mod(G, P, &M[1])) != AWS_MP_OKAY) {
-    goto LBL_MU;
   }
 
-  /* compute the value at M[1<<(winsize-1)] by squaring 
-   * M[1] (winsize-1) times 
+  /* if a is negative just do an unsigned
+   * addition [with fudged signs]
    */
-  if ((err = aws_mp_copy(&M[1], &M[1 << (winsize - 1)])) != AWS_MP_OKAY) {
-    goto LBL_MU;
-  }
-
-  for (x = 0; x < (winsize - 1); x++) {
-    /* square it */
-    if ((err = aws_mp_sqr(&M[1 << (winsize - 1)],
-            &M[1 << (winsize - 1)])) != AWS_MP_OKAY) {
-      goto LBL_MU;
-    }
+  if (a->sign == AWS_MP_NEG) {
+     a->sign = AWS_MP_ZPOS;
+     res     = aws_mp_add_d(a, b, c);
+     a->sign = c->sign = AWS_MP_NEG;
 
-    /* reduce modulo P */
-    if ((err = redux (&M[1 << (winsize - 1)], P, &mu)) != AWS_MP_OKAY) {
-      goto LBL_MU;
-    }
-  }
+     /* clamp */
+      aws_mp_clamp(c);
 
-  /* create upper table, that is M[x] = M[x-1] * M[1] (mod P)
-   * for x = (2**(winsize - 1) + 1) to (2**winsize - 1)
-   */
-  for (x = (1 << (winsize - 1)) + 1; x < (1 << winsize); x++) {
-    if ((err = aws_mp_mul(&M[x - 1], &M[1], &M[x])) != AWS_MP_OKAY) {
-      goto LBL_MU;
-    }
-    if ((err = redux (&M[x], P, &mu)) != AWS_MP_OKAY) {
-      goto LBL_MU;
-    }
+     return res;
   }
 
-  /* setup result */
-  if ((err = aws_mp_init(&res)) != AWS_MP_OKAY) {
-    goto LBL_MU;
-  }
-    aws_mp_set(&res, 1);
-
-  /* set initial mode and bit cnt */
-  mode   = 0;
-  bitcnt = 1;
-  buf    = 0;
-  digidx = X->used - 1;
-  bitcpy = 0;
-  bitbuf = 0;
-
-  for (;;) {
-    /* grab next digit as required */
-    if (--bitcnt == 0) {
-      /* if digidx == -1 we are out of digits */
-      if (digidx == -1) {
-        break;
-      }
-      /* read next digit and reset the bitcnt */
-      buf    = X->dp[digidx--];
-      bitcnt = (int) AWS_DIGIT_BIT;
-    }
-
-    /* grab the next msb from the exponent */
-    y     = (buf >> (aws_mp_digit)(AWS_DIGIT_BIT - 1)) & 1;
-    buf <<= (aws_mp_digit)1;
-
-    /* if the bit is zero and mode == 0 then we ignore it
-     * These represent the leading zero bits before the first 1 bit
-     * in the exponent.  Technically this opt is not required but it
-     * does lower the # of trivial squaring/reductions used
-     */
-    if (mode == 0 && y == 0) {
-      continue;
-    }
-
-    /* if the bit is zero and mode == 1 then we square */
-    if (mode == 1 && y == 0) {
-      if ((err = aws_mp_sqr(&res, &res)) != AWS_MP_OKAY) {
-        goto LBL_RES;
-      }
-      if ((err = redux (&res, P, &mu)) != AWS_MP_OKAY) {
-        goto LBL_RES;
-      }
-      continue;
-    }
-
-    /* else we add it to the window */
-    bitbuf |= (y << (winsize - ++bitcpy));
-    mode    = 2;
-
-    if (bitcpy == winsize) {
-      /* ok window is filled so square as required and multiply  */
-      /* square first */
-      for (x = 0; x < winsize; x++) {
-        if ((err = aws_mp_sqr(&res, &res)) != AWS_MP_OKAY) {
-          goto LBL_RES;
-        }
-        if ((err = redux (&res, P, &mu)) != AWS_MP_OKAY) {
-          goto LBL_RES;
-        }
-      }
-
-      /* then multiply */
-      if ((err = aws_mp_mul(&res, &M[bitbuf], &res)) != AWS_MP_OKAY) {
-        goto LBL_RES;
-      }
-      if ((err = redux (&res, P, &mu)) != AWS_MP_OKAY) {
-        goto LBL_RES;
-      }
-
-      /* empty window and reset */
-      bitcpy = 0;
-      bitbuf = 0;
-      mode   = 1;
-    }
-  }
-
-  /* if bits remain then square/multiply */
-  if (mode == 2 && bitcpy > 0) {
-    /* square then multiply if the bit is set */
-    for (x = 0; x < bitcpy; x++) {
-      if ((err = aws_mp_sqr(&res, &res)) != AWS_MP_OKAY) {
-        goto LBL_RES;
-      }
-      if ((err = redux (&res, P, &mu)) != AWS_MP_OKAY) {
-        goto LBL_RES;
-      }
-
-      bitbuf <<= 1;
-      if ((bitbuf & (1 << winsize)) != 0) {
-        /* then multiply */
-        if ((err = aws_mp_mul(&res, &M[1], &res)) != AWS_MP_OKAY) {
-          goto LBL_RES;
-        }
-        if ((err = redux (&res, P, &mu)) != AWS_MP_OKAY) {
-          goto LBL_RES;
-        }
-      }
-    }
-  }
-
-    aws_mp_exch(&res, Y);
-  err = AWS_MP_OKAY;
-LBL_RES:
-aws_mp_clear(&res);
-LBL_MU:
-aws_mp_clear(&mu);
-LBL_M:
-aws_mp_clear(&M[1]);
-  for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
-      aws_mp_clear(&M[x]);
-  }
-  return err;
-}
-#endif
-
-#ifdef AWS_BN_MP_SUB_D_C
-
-/* single digit subtraction */
-int
-aws_mp_sub_d(aws_mp_int *a, aws_mp_digit b, aws_mp_int *c)
-{
-  aws_mp_digit *tmpa, *tmpc, mu;
-  int       res, ix, oldused;
-
-  /* grow c as required */
-  if (c->alloc < a->used + 1) {
-     if ((res = aws_mp_grow(c, a->used + 1)) != AWS_MP_OKAY) {
-        return res;
-     }
-  }
-
-  /* if a is negative just do an unsigned
-   * addition [with fudged signs]
-   */
-  if (a->sign == AWS_MP_NEG) {
-     a->sign = AWS_MP_ZPOS;
-     res     = aws_mp_add_d(a, b, c);
-     a->sign = c->sign = AWS_MP_NEG;
-
-     /* clamp */
-      aws_mp_clamp(c);
-
-     return res;
-  }
-
-  /* setup regs */
-  oldused = c->used;
-  tmpa    = a->dp;
-  tmpc    = c->dp;
+  /* setup regs */
+  oldused = c->used;
+  tmpa    = a->dp;
+  tmpc    = c->dp;
 
   /* if a <= b simply fix the single digit */
   if ((a->used == 1 && a->dp[0] <= b) || a->used == 0) {
@@ -3297,16 +4816,23 @@ int
 aws_mp_sqr(aws_mp_int *a, aws_mp_int *b)
 {
   int     res;
+  ulong64 cut = AWS_MP_CUTOFFS_LOAD(&s_mp_cutoffs);
 
+#ifdef AWS_BN_MP_NTT_SQR_C
+  /* use the transforms? */
+  if (a->used >= AWS_MP_CUTOFF_NTT(cut) && (res = aws_mp_ntt_sqr(a, b)) != AWS_MP_VAL) {
+    /* done, or out of memory */
+  } else
+#endif
 #ifdef AWS_BN_MP_TOOM_SQR_C
   /* use Toom-Cook? */
-  if (a->used >= AWS_TOOM_SQR_CUTOFF) {
+  if (a->used >= AWS_MP_CUTOFF(cut, AWS_MP_CUTOFF_TSQR)) {
     res = aws_mp_toom_sqr(a, b);
   /* Karatsuba? */
   } else 
 #endif
 #ifdef AWS_BN_MP_KARATSUBA_SQR_C
-if (a->used >= AWS_KARATSUBA_SQR_CUTOFF) {
+if (a->used >= AWS_MP_CUTOFF(cut, AWS_MP_CUTOFF_KSQR)) {
     res = aws_mp_karatsuba_sqr(a, b);
   } else 
 #endif
@@ -3335,7 +4861,7 @@ if (a->used >= AWS_KARATSUBA_SQR_CUTOFF) {
 /* grow as required */
 int aws_mp_grow(aws_mp_int *a, int size)
 {
-  int     i;
+  int     i, fixed;
   aws_mp_digit *tmp;
 
   /* if the alloc size is smaller alloc more ram */
@@ -3349,7 +4875,28 @@ int aws_mp_grow(aws_mp_int *a, int size)
      * in case the operation failed we don't want
      * to overwrite the dp member of a.
      */
-    tmp = AWS_OPT_CAST(aws_mp_digit) AWS_XREALLOC (a->dp, sizeof (aws_mp_digit) * size);
+    fixed = 0;
+#ifdef AWS_MP_INLINE_DIGS
+    if (a->dp == a->inl) {
+      fixed = 1;
+    }
+#endif
+#ifdef AWS_BN_MP_SCRATCH_C
+    if (aws_mp_scratch_owns(a->dp) == AWS_MP_YES) {
+      fixed = 1;
+    }
+#endif
+    if (fixed == 1) {
+      /* inline and scratch digits can't be reallocated, move them to the heap */
+      tmp = AWS_OPT_CAST(aws_mp_digit) AWS_XMALLOC (sizeof (aws_mp_digit) * size);
+      if (tmp != NULL) {
+        for (i = 0; i < a->alloc; i++) {
+          tmp[i] = a->dp[i];
+        }
+      }
+    } else {
+      tmp = AWS_OPT_CAST(aws_mp_digit) AWS_XREALLOC (a->dp, sizeof (aws_mp_digit) * size);
+    }
     if (tmp == NULL) {
       /* reallocation failed but "a" is still valid [can be freed] */
       return AWS_MP_MEM;
@@ -3514,7 +5061,13 @@ aws_mp_clear(aws_mp_int *a)
         a->dp[i] = 0;
     }
 
-    /* free ram */
+    /* free ram [inline digits stay, scratch digits go back with their scope] */
+#ifdef AWS_MP_INLINE_DIGS
+    if (a->dp != a->inl)
+#endif
+#ifdef AWS_BN_MP_SCRATCH_C
+    if (aws_mp_scratch_owns(a->dp) == AWS_MP_NO)
+#endif
     AWS_XFREE(a->dp);
 
     /* reset members to make debugging easier */
@@ -3683,6 +5236,188 @@ aws_mp_clear_multi(&x, &y, &u, &v, &A, &B, &C, &D, NULL);
 }
 #endif
 
+#ifdef AWS_BN_S_MP_DIV_RECURSIVE_C
+
+/* Recursive division [Burnikel and Ziegler, "Fast Recursive Division", 1998,
+ * in the form of Brent and Zimmermann, "Modern Computer Arithmetic" Alg. 1.8]
+ *
+ * The quotient is found in halves, each half from the top half of the divisor
+ * only and then corrected with one multiplication by the bottom half, so the
+ * division costs a small multiple of one aws_mp_mul of the same size and gets
+ * the benefit of Karatsuba and Toom-Cook.
+ */
+
+/* hi = a / B**k, lo = a mod B**k [hi may be a] */
+static int s_mp_div_split(aws_mp_int *a, int k, aws_mp_int *hi, aws_mp_int *lo)
+{
+  int res;
+
+  if ((res = aws_mp_mod_2d(a, k * AWS_DIGIT_BIT, lo)) != AWS_MP_OKAY ||
+      (res = aws_mp_copy(a, hi)) != AWS_MP_OKAY) {
+    return res;
+  }
+  aws_mp_rshd(hi, k);
+  return AWS_MP_OKAY;
+}
+
+/* q = a / b, r = a mod b for a normalized b of n digits and a < b*B**m with m <= n
+ * [a larger a only costs a few more corrections]
+ */
+static int s_mp_div_recursive(aws_mp_int *a, aws_mp_int *b, aws_mp_int *q, aws_mp_int *r, int cut)
+{
+  aws_mp_int A1, A2, B1, B0, Q1, Q0, R1, R0, t;
+  int        res, m, k;
+
+  m = a->used - b->used;
+  if (m < cut) {
+    return aws_mp_div(a, b, q, r);
+  }
+  k = m / 2;
+
+  aws_mp_scratch_begin();
+  if ((res = aws_mp_init_multi_scratch(a->used + 2, &A1, &A2, &B1, &B0, &Q1, &Q0, &R1, &R0, &t, NULL)) != AWS_MP_OKAY) {
+    goto LBL_END;
+  }
+
+  /* B1 = b / B**k, B0 = b mod B**k */
+  if ((res = s_mp_div_split(b, k, &B1, &B0)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+
+  /* (Q1, R1) = (a / B**2k) divided by B1 */
+  if ((res = s_mp_div_split(a, 2 * k, &A1, &t)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+  if ((res = s_mp_div_recursive(&A1, &B1, &Q1, &R1, cut)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+
+  /* A1 = R1*B**2k + (a mod B**2k) - Q1*B0*B**k, and while A1 < 0 { Q1 -= 1; A1 += b*B**k } */
+  if ((res = aws_mp_lshd(&R1, 2 * k)) != AWS_MP_OKAY ||
+      (res = aws_mp_add(&R1, &t, &A1)) != AWS_MP_OKAY ||
+      (res = aws_mp_mul(&Q1, &B0, &t)) != AWS_MP_OKAY ||
+      (res = aws_mp_lshd(&t, k)) != AWS_MP_OKAY ||
+      (res = aws_mp_sub(&A1, &t, &A1)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+  if (A1.sign == AWS_MP_NEG) {
+    if ((res = aws_mp_copy(b, &t)) != AWS_MP_OKAY || (res = aws_mp_lshd(&t, k)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+    do {
+      if ((res = aws_mp_sub_d(&Q1, 1, &Q1)) != AWS_MP_OKAY || (res = aws_mp_add(&A1, &t, &A1)) != AWS_MP_OKAY) {
+        goto LBL_ERR;
+      }
+    } while (A1.sign == AWS_MP_NEG);
+  }
+
+  /* (Q0, R0) = (A1 / B**k) divided by B1 */
+  if ((res = s_mp_div_split(&A1, k, &A1, &t)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+  if ((res = s_mp_div_recursive(&A1, &B1, &Q0, &R0, cut)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+
+  /* A2 = R0*B**k + (A1 mod B**k) - Q0*B0, and while A2 < 0 { Q0 -= 1; A2 += b } */
+  if ((res = aws_mp_lshd(&R0, k)) != AWS_MP_OKAY ||
+      (res = aws_mp_add(&R0, &t, &A2)) != AWS_MP_OKAY ||
+      (res = aws_mp_mul(&Q0, &B0, &t)) != AWS_MP_OKAY ||
+      (res = aws_mp_sub(&A2, &t, &A2)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+  while (A2.sign == AWS_MP_NEG) {
+    if ((res = aws_mp_sub_d(&Q0, 1, &Q0)) != AWS_MP_OKAY || (res = aws_mp_add(&A2, b, &A2)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+  }
+
+  /* q = Q1*B**k + Q0, r = A2 */
+  if ((res = aws_mp_lshd(&Q1, k)) != AWS_MP_OKAY ||
+      (res = aws_mp_add(&Q1, &Q0, q)) != AWS_MP_OKAY ||
+      (res = aws_mp_copy(&A2, r)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+
+LBL_ERR:
+  aws_mp_clear_multi(&A1, &A2, &B1, &B0, &Q1, &Q0, &R1, &R0, &t, NULL);
+LBL_END:
+  aws_mp_scratch_end();
+  return res;
+}
+
+/* signed c*b + d == a like aws_mp_div(), which calls this for large operands */
+int aws_s_mp_div_recursive(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, aws_mp_int *d)
+{
+  aws_mp_int A, B, Q, Q1, R, A0;
+  int        res, m, n, norm, neg, sign, cut;
+
+  cut = AWS_MP_CUTOFF(AWS_MP_CUTOFFS_LOAD(&s_mp_cutoffs), AWS_MP_CUTOFF_DIV);
+  neg  = (a->sign == b->sign) ? AWS_MP_ZPOS : AWS_MP_NEG;
+  sign = a->sign;
+
+  aws_mp_scratch_begin();
+  if ((res = aws_mp_init_multi_scratch(a->used + 2, &A, &B, &Q, &Q1, &R, &A0, NULL)) != AWS_MP_OKAY) {
+    goto LBL_END;
+  }
+
+  /* normalize b the way aws_mp_div does, so the divisions at the bottom of the
+   * recursion find it done already, a goes along
+   */
+  norm = aws_mp_count_bits(b) % AWS_DIGIT_BIT;
+  norm = (norm < (int)(AWS_DIGIT_BIT - 1)) ? (int)(AWS_DIGIT_BIT - 1) - norm : 0;
+  if ((res = aws_mp_mul_2d(a, norm, &A)) != AWS_MP_OKAY ||
+      (res = aws_mp_mul_2d(b, norm, &B)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+  A.sign = B.sign = AWS_MP_ZPOS;
+
+  /* a quotient longer than b is taken n digits at a time from the top */
+  n = B.used;
+  m = A.used - B.used;
+  while (m > n) {
+    if ((res = s_mp_div_split(&A, m - n, &A, &A0)) != AWS_MP_OKAY ||
+        (res = s_mp_div_recursive(&A, &B, &Q1, &R, cut)) != AWS_MP_OKAY ||
+        (res = aws_mp_lshd(&Q, n)) != AWS_MP_OKAY ||
+        (res = aws_mp_add(&Q, &Q1, &Q)) != AWS_MP_OKAY ||
+        (res = aws_mp_lshd(&R, m - n)) != AWS_MP_OKAY ||
+        (res = aws_mp_add(&R, &A0, &A)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+    m -= n;
+  }
+  if ((res = s_mp_div_recursive(&A, &B, &Q1, &R, cut)) != AWS_MP_OKAY ||
+      (res = aws_mp_lshd(&Q, m)) != AWS_MP_OKAY ||
+      (res = aws_mp_add(&Q, &Q1, &Q)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+
+  /* the remainder has to be shifted back */
+  if ((res = aws_mp_div_2d(&R, norm, &R, NULL)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+
+  if (c != NULL) {
+    if ((res = aws_mp_copy(&Q, c)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+    c->sign = (aws_mp_iszero(c) == AWS_MP_YES) ? AWS_MP_ZPOS : neg;
+  }
+  if (d != NULL) {
+    if ((res = aws_mp_copy(&R, d)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+    d->sign = (aws_mp_iszero(d) == AWS_MP_YES) ? AWS_MP_ZPOS : sign;
+  }
+
+LBL_ERR:
+  aws_mp_clear_multi(&A, &B, &Q, &Q1, &R, &A0, NULL);
+LBL_END:
+  aws_mp_scratch_end();
+  return res;
+}
+#endif
+
 #ifdef AWS_BN_MP_DIV_C
 
 #ifdef AWS_BN_MP_DIV_SMALL
@@ -3793,27 +5528,46 @@ int aws_mp_div(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, aws_mp_int *d)
     return res;
   }
 
-  if ((res = aws_mp_init_size(&q, a->used + 2)) != AWS_MP_OKAY) {
-    return res;
+#ifdef AWS_BN_S_MP_DIV_RECURSIVE_C
+  /* long quotients by long divisors are done recursively */
+  n = AWS_MP_CUTOFF(AWS_MP_CUTOFFS_LOAD(&s_mp_cutoffs), AWS_MP_CUTOFF_DIV);
+  if (b->used >= n && a->used - b->used >= n) {
+    return aws_s_mp_div_recursive(a, b, c, d);
+  }
+#endif
+
+  /* the temporaries live in the scratch arena, sized so they never grow */
+  aws_mp_scratch_begin();
+
+  if ((res = aws_mp_init_scratch(&q, a->used + 2)) != AWS_MP_OKAY) {
+    goto LBL_END;
   }
   q.used = a->used + 2;
 
-  if ((res = aws_mp_init(&t1)) != AWS_MP_OKAY) {
+  if ((res = aws_mp_init_scratch(&t1, a->used + 2)) != AWS_MP_OKAY) {
     goto LBL_Q;
   }
 
-  if ((res = aws_mp_init(&t2)) != AWS_MP_OKAY) {
+  if ((res = aws_mp_init_scratch(&t2, 3)) != AWS_MP_OKAY) {
     goto LBL_T1;
   }
 
-  if ((res = aws_mp_init_copy(&x, a)) != AWS_MP_OKAY) {
+  if ((res = aws_mp_init_scratch(&x, a->used + 2)) != AWS_MP_OKAY) {
     goto LBL_T2;
   }
 
-  if ((res = aws_mp_init_copy(&y, b)) != AWS_MP_OKAY) {
+  if ((res = aws_mp_init_scratch(&y, a->used + 2)) != AWS_MP_OKAY) {
     goto LBL_X;
   }
 
+  if ((res = aws_mp_copy(a, &x)) != AWS_MP_OKAY) {
+    goto LBL_Y;
+  }
+
+  if ((res = aws_mp_copy(b, &y)) != AWS_MP_OKAY) {
+    goto LBL_Y;
+  }
+
   /* fix the sign */
   neg = (a->sign == b->sign) ? AWS_MP_ZPOS : AWS_MP_NEG;
   x.sign = y.sign = AWS_MP_ZPOS;
@@ -3934,13 +5688,17 @@ int aws_mp_div(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, aws_mp_int *d)
 
   if (c != NULL) {
       aws_mp_clamp(&q);
-      aws_mp_exch(&q, c);
+      if ((res = aws_mp_copy(&q, c)) != AWS_MP_OKAY) {
+        goto LBL_Y;
+      }
     c->sign = neg;
   }
 
   if (d != NULL) {
       aws_mp_div_2d(&x, norm, &x, NULL);
-      aws_mp_exch(&x, d);
+      if ((res = aws_mp_copy(&x, d)) != AWS_MP_OKAY) {
+        goto LBL_Y;
+      }
   }
 
   res = AWS_MP_OKAY;
@@ -3955,6 +5713,8 @@ LBL_T1:
 aws_mp_clear(&t1);
 LBL_Q:
 aws_mp_clear(&q);
+LBL_END:
+  aws_mp_scratch_end();
   return res;
 }
 
@@ -4088,215 +5848,1015 @@ aws_mp_xor(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
 
 #ifdef AWS_BN_MP_EXPTMOD_C
 
-/* this is a shell function that calls either the normal or Montgomery
- * exptmod functions.  Originally the call to the montgomery code was
- * embedded in the normal function but that wasted alot of stack space
- * for nothing (since 99% of the time the Montgomery code would be called)
+/* this is a shell function that picks a reduction for the modulus and
+ * calls the exptmod engine with it.  Callers that use one modulus many
+ * times should set up an aws_mp_mod_ctx themselves and call
+ * aws_mp_exptmod_ctx so the setup is only paid once.
  */
 int aws_mp_exptmod(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int *Y)
 {
-  int dr;
+  aws_mp_mod_ctx ctx;
+  int err;
 
   /* modulus P must be positive */
   if (P->sign == AWS_MP_NEG) {
      return AWS_MP_VAL;
   }
 
-  /* if exponent X is negative we have to recurse */
-  if (X->sign == AWS_MP_NEG) {
-#ifdef AWS_BN_MP_INVMOD_C
-     aws_mp_int tmpG, tmpX;
-     int err;
+  if ((err = aws_mp_mod_ctx_init(&ctx, P)) != AWS_MP_OKAY) {
+     return err;
+  }
+  err = aws_mp_exptmod_ctx(G, X, &ctx, Y);
+    aws_mp_mod_ctx_clear(&ctx);
+  return err;
+}
 
-     /* first compute 1/G mod P */
-     if ((err = aws_mp_init(&tmpG)) != AWS_MP_OKAY) {
-        return err;
-     }
-     if ((err = aws_mp_invmod(G, P, &tmpG)) != AWS_MP_OKAY) {
-         aws_mp_clear(&tmpG);
-        return err;
-     }
+#endif
 
-     /* now get |X| */
-     if ((err = aws_mp_init(&tmpX)) != AWS_MP_OKAY) {
-         aws_mp_clear(&tmpG);
-        return err;
+#ifdef AWS_BN_MP_MOD_CTX_C
+
+/* Precomputed reduction state for a fixed modulus.
+ *
+ * aws_mp_exptmod has to work out which reduction suits the modulus and then
+ * run its setup (rho, R**2 mod N, mu, ...) on every call.  When many
+ * operations share one modulus (e.g. the SRP group prime) the context does
+ * that work once and the *_ctx functions reuse it.
+ */
+int aws_mp_mod_ctx_init(aws_mp_mod_ctx *ctx, aws_mp_int *b)
+{
+  int mode;
+
+  /* modulus must be positive */
+  if (b->sign == AWS_MP_NEG || aws_mp_iszero(b) == AWS_MP_YES) {
+     return AWS_MP_VAL;
+  }
+
+  /* this mirrors the choices aws_mp_exptmod has always made */
+  mode = -1;
+#if defined(AWS_BN_MP_REDUCE_IS_2K_L_C) && defined(AWS_BN_MP_REDUCE_2K_L_C)
+  /* modified diminished radix reduction */
+  if (aws_mp_reduce_is_2k_l(b) == AWS_MP_YES) {
+     mode = AWS_MP_REDUCE_2K_L;
+  }
+#endif
+#ifdef AWS_BN_MP_DR_IS_MODULUS_C
+  /* is it a DR modulus? */
+  if (mode == -1 && aws_mp_dr_is_modulus(b) == AWS_MP_YES) {
+     mode = AWS_MP_REDUCE_DR;
+  }
+#endif
+#ifdef AWS_BN_MP_REDUCE_IS_2K_C
+  /* if not, is it a unrestricted DR modulus? */
+  if (mode == -1 && aws_mp_reduce_is_2k(b) == AWS_MP_YES) {
+     mode = AWS_MP_REDUCE_2K;
+  }
+#endif
+  if (mode == -1) {
+     /* odd moduli use Montgomery, the rest the generic Barrett reduction */
+     mode = (aws_mp_isodd(b) == AWS_MP_YES) ? AWS_MP_REDUCE_MONTGOMERY : AWS_MP_REDUCE_BARRETT;
+  }
+
+  return aws_mp_mod_ctx_init_mode(ctx, b, mode);
+}
+
+int aws_mp_mod_ctx_init_mode(aws_mp_mod_ctx *ctx, aws_mp_int *b, int mode)
+{
+  int res;
+
+  if (b->sign == AWS_MP_NEG || aws_mp_iszero(b) == AWS_MP_YES) {
+     return AWS_MP_VAL;
+  }
+
+  if ((res = aws_mp_init_copy(&ctx->N, b)) != AWS_MP_OKAY) {
+     return res;
+  }
+  if ((res = aws_mp_init_multi(&ctx->mu, &ctx->RR, NULL)) != AWS_MP_OKAY) {
+      aws_mp_clear(&ctx->N);
+     return res;
+  }
+  ctx->mode = mode;
+  ctx->mp   = 0;
+
+  switch (mode) {
+  case AWS_MP_REDUCE_MONTGOMERY:
+#if defined(AWS_BN_MP_MONTGOMERY_SETUP_C) && defined(AWS_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C)
+     if ((res = aws_mp_montgomery_setup(b, &ctx->mp)) != AWS_MP_OKAY) {
+        goto LBL_ERR;
      }
-     if ((err = aws_mp_abs(X, &tmpX)) != AWS_MP_OKAY) {
-         aws_mp_clear_multi(&tmpG, &tmpX, NULL);
-        return err;
+     /* RR = (R mod N)**2 mod N, maps values into the Montgomery domain with one reduction */
+     if ((res = aws_mp_montgomery_calc_normalization(&ctx->RR, b)) != AWS_MP_OKAY) {
+        goto LBL_ERR;
      }
+     if ((res = aws_mp_sqrmod(&ctx->RR, b, &ctx->RR)) != AWS_MP_OKAY) {
+        goto LBL_ERR;
+     }
+     break;
+#else
+     res = AWS_MP_VAL;
+     goto LBL_ERR;
+#endif
 
-     /* and now compute (1/G)**|X| instead of G**X [X < 0] */
-     err = aws_mp_exptmod(&tmpG, &tmpX, P, Y);
-      aws_mp_clear_multi(&tmpG, &tmpX, NULL);
-     return err;
-#else 
-     /* no invmod */
+  case AWS_MP_REDUCE_DR:
+#if defined(AWS_BN_MP_DR_SETUP_C) && defined(AWS_BN_MP_DR_REDUCE_C)
+     /* setup DR reduction for moduli of the form B**k - b */
+      aws_mp_dr_setup(b, &ctx->mp);
+     break;
+#else
+     res = AWS_MP_VAL;
+     goto LBL_ERR;
+#endif
+
+  case AWS_MP_REDUCE_2K:
+#if defined(AWS_BN_MP_REDUCE_2K_SETUP_C) && defined(AWS_BN_MP_REDUCE_2K_C)
+     /* setup DR reduction for moduli of the form 2**k - b */
+     if ((res = aws_mp_reduce_2k_setup(b, &ctx->mp)) != AWS_MP_OKAY) {
+        goto LBL_ERR;
+     }
+     break;
+#else
+     res = AWS_MP_VAL;
+     goto LBL_ERR;
+#endif
+
+  case AWS_MP_REDUCE_BARRETT:
+#if defined(AWS_BN_MP_REDUCE_SETUP_C) && defined(AWS_BN_MP_REDUCE_C)
+     if ((res = aws_mp_reduce_setup(&ctx->mu, b)) != AWS_MP_OKAY) {
+        goto LBL_ERR;
+     }
+     break;
+#else
+     res = AWS_MP_VAL;
+     goto LBL_ERR;
+#endif
+
+  case AWS_MP_REDUCE_2K_L:
+#if defined(AWS_BN_MP_REDUCE_2K_SETUP_L_C) && defined(AWS_BN_MP_REDUCE_2K_L_C)
+     if ((res = aws_mp_reduce_2k_setup_l(b, &ctx->mu)) != AWS_MP_OKAY) {
+        goto LBL_ERR;
+     }
+     break;
+#else
+     res = AWS_MP_VAL;
+     goto LBL_ERR;
+#endif
+
+  default:
+     res = AWS_MP_VAL;
+     goto LBL_ERR;
+  }
+
+  return AWS_MP_OKAY;
+LBL_ERR:
+aws_mp_clear_multi(&ctx->N, &ctx->mu, &ctx->RR, NULL);
+  return res;
+}
+
+void aws_mp_mod_ctx_clear(aws_mp_mod_ctx *ctx)
+{
+  aws_mp_clear_multi(&ctx->N, &ctx->mu, &ctx->RR, NULL);
+  ctx->mode = -1;
+}
+
+/* reduces 0 <= a < N**2 modulo N with the context's method.  In
+ * Montgomery mode this yields a/R (mod N) like aws_mp_montgomery_reduce.
+ */
+int aws_mp_mod_ctx_reduce(aws_mp_int *a, aws_mp_mod_ctx *ctx)
+{
+  switch (ctx->mode) {
+  case AWS_MP_REDUCE_MONTGOMERY:
+#ifdef AWS_BN_FAST_MP_MONTGOMERY_REDUCE_C
+     /* automatically pick the comba one if available (saves quite a few calls/ifs) */
+     if (((ctx->N.used * 2 + 1) < AWS_MP_WARRAY) &&
+          ctx->N.used < (1 << ((CHAR_BIT * sizeof (aws_mp_word)) - (2 * AWS_DIGIT_BIT)))) {
+        return aws_fast_mp_montgomery_reduce(a, &ctx->N, ctx->mp);
+     }
+#endif
+#ifdef AWS_BN_MP_MONTGOMERY_REDUCE_C
+     /* use slower baseline Montgomery method */
+     return aws_mp_montgomery_reduce(a, &ctx->N, ctx->mp);
+#else
+     return AWS_MP_VAL;
+#endif
+#ifdef AWS_BN_MP_DR_REDUCE_C
+  case AWS_MP_REDUCE_DR:
+     return aws_mp_dr_reduce(a, &ctx->N, ctx->mp);
+#endif
+#ifdef AWS_BN_MP_REDUCE_2K_C
+  case AWS_MP_REDUCE_2K:
+     return aws_mp_reduce_2k(a, &ctx->N, ctx->mp);
+#endif
+#ifdef AWS_BN_MP_REDUCE_C
+  case AWS_MP_REDUCE_BARRETT:
+     return aws_mp_reduce(a, &ctx->N, &ctx->mu);
+#endif
+#ifdef AWS_BN_MP_REDUCE_2K_L_C
+  case AWS_MP_REDUCE_2K_L:
+     return aws_mp_reduce_2k_l(a, &ctx->N, &ctx->mu);
+#endif
+  default:
      return AWS_MP_VAL;
+  }
+}
+
+/* b = a mapped into the context's domain, i.e. aR (mod N) for Montgomery
+ * and a (mod N) for every other method.  Already reduced inputs skip the
+ * division.
+ */
+int aws_mp_mod_ctx_to(aws_mp_int *a, aws_mp_mod_ctx *ctx, aws_mp_int *b)
+{
+  int res;
+
+  if (a->sign == AWS_MP_NEG || aws_mp_cmp_mag(a, &ctx->N) != AWS_MP_LT) {
+     res = aws_mp_mod(a, &ctx->N, b);
+  } else {
+     res = aws_mp_copy(a, b);
+  }
+  if (res != AWS_MP_OKAY || ctx->mode != AWS_MP_REDUCE_MONTGOMERY) {
+     return res;
+  }
+
+  /* aR == (a * R**2)/R (mod N) */
+  return aws_mp_mod_ctx_mul(b, &ctx->RR, ctx, b);
+}
+
+/* maps a value in the context's domain back to a normal residue, in place */
+int aws_mp_mod_ctx_from(aws_mp_int *a, aws_mp_mod_ctx *ctx)
+{
+  if (ctx->mode != AWS_MP_REDUCE_MONTGOMERY) {
+     return AWS_MP_OKAY;
+  }
+  return aws_mp_mod_ctx_reduce(a, ctx);
+}
+
+/* c = a * b in the context's domain, a and b already reduced.  Montgomery
+ * mode uses the fused kernels up to AWS_MP_MONTGOMERY_DIGS digits, the other
+ * methods multiply and reduce.
+ */
+int aws_mp_mod_ctx_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_mod_ctx *ctx, aws_mp_int *c)
+{
+  int res;
+
+#ifdef AWS_BN_FAST_MP_MONTGOMERY_MUL_C
+  if (ctx->mode == AWS_MP_REDUCE_MONTGOMERY && ctx->N.used <= AWS_MP_MONTGOMERY_DIGS &&
+      a->used <= ctx->N.used && b->used <= ctx->N.used) {
+     return aws_fast_mp_montgomery_mul(a, b, &ctx->N, ctx->mp, c);
+  }
 #endif
+  if ((res = aws_mp_mul(a, b, c)) != AWS_MP_OKAY) {
+     return res;
+  }
+  return aws_mp_mod_ctx_reduce(c, ctx);
+}
+
+/* b = a * a in the context's domain */
+int aws_mp_mod_ctx_sqr(aws_mp_int *a, aws_mp_mod_ctx *ctx, aws_mp_int *b)
+{
+  int res;
+
+#ifdef AWS_BN_FAST_MP_MONTGOMERY_MUL_C
+  if (ctx->mode == AWS_MP_REDUCE_MONTGOMERY && ctx->N.used <= AWS_MP_MONTGOMERY_DIGS &&
+      a->used <= ctx->N.used) {
+     return aws_fast_mp_montgomery_sqr(a, &ctx->N, ctx->mp, b);
+  }
+#endif
+  if ((res = aws_mp_sqr(a, b)) != AWS_MP_OKAY) {
+     return res;
+  }
+  return aws_mp_mod_ctx_reduce(b, ctx);
+}
+
+/* c = a * b (mod N) */
+int aws_mp_mulmod_ctx(aws_mp_int *a, aws_mp_int *b, aws_mp_mod_ctx *ctx, aws_mp_int *c)
+{
+  int     res;
+  aws_mp_int ta, tb;
+
+  if ((res = aws_mp_init_multi(&ta, &tb, NULL)) != AWS_MP_OKAY) {
+    return res;
+  }
+
+  /* reduce the inputs first, only needed if they are out of range */
+  if (a->sign == AWS_MP_NEG || aws_mp_cmp_mag(a, &ctx->N) != AWS_MP_LT) {
+     if ((res = aws_mp_mod(a, &ctx->N, &ta)) != AWS_MP_OKAY) {
+        goto LBL_T;
+     }
+     a = &ta;
+  }
+  if (b->sign == AWS_MP_NEG || aws_mp_cmp_mag(b, &ctx->N) != AWS_MP_LT) {
+     if ((res = aws_mp_mod(b, &ctx->N, &tb)) != AWS_MP_OKAY) {
+        goto LBL_T;
+     }
+     b = &tb;
+  }
+
+  if ((res = aws_mp_mod_ctx_mul(a, b, ctx, &ta)) != AWS_MP_OKAY) {
+     goto LBL_T;
+  }
+
+  /* in Montgomery mode that left ab/R, multiply the R back in */
+  if (ctx->mode == AWS_MP_REDUCE_MONTGOMERY) {
+     if ((res = aws_mp_mod_ctx_mul(&ta, &ctx->RR, ctx, &ta)) != AWS_MP_OKAY) {
+        goto LBL_T;
+     }
+  }
+    aws_mp_exch(&ta, c);
+
+LBL_T:
+aws_mp_clear_multi(&ta, &tb, NULL);
+  return res;
+}
+
+/* b = a * a (mod N) */
+int aws_mp_sqrmod_ctx(aws_mp_int *a, aws_mp_mod_ctx *ctx, aws_mp_int *b)
+{
+  int     res;
+  aws_mp_int t;
+
+  if ((res = aws_mp_init(&t)) != AWS_MP_OKAY) {
+    return res;
+  }
+
+  if (a->sign == AWS_MP_NEG || aws_mp_cmp_mag(a, &ctx->N) != AWS_MP_LT) {
+     if ((res = aws_mp_mod(a, &ctx->N, &t)) != AWS_MP_OKAY) {
+        goto LBL_T;
+     }
+     a = &t;
+  }
+
+  if ((res = aws_mp_mod_ctx_sqr(a, ctx, &t)) != AWS_MP_OKAY) {
+     goto LBL_T;
+  }
+  if (ctx->mode == AWS_MP_REDUCE_MONTGOMERY) {
+     if ((res = aws_mp_mod_ctx_mul(&t, &ctx->RR, ctx, &t)) != AWS_MP_OKAY) {
+        goto LBL_T;
+     }
+  }
+    aws_mp_exch(&t, b);
+
+LBL_T:
+aws_mp_clear(&t);
+  return res;
+}
+#endif
+
+#ifdef AWS_BN_MP_EXPTMOD_BATCH_C
+
+/* Y[i] = G[i]**X[i] mod N for a whole batch against one context
+ *
+ * The context is set up once by the caller and only read here.  The batch
+ * is spread over a pool of "threads" workers [see aws_s_mp_pool_run()] which
+ * take the next index under the pool's lock until the batch is done or one
+ * of them fails.  Each worker has its own scratch arena.
+ */
+
+typedef struct {
+   aws_mp_int     *G, *X, *Y;
+   aws_mp_mod_ctx *ctx;
+   int           (*fn)(aws_mp_int *, aws_mp_int *, aws_mp_mod_ctx *, aws_mp_int *);
+   int             n, next;
+} s_mp_batch;
+
+/* takes items until the batch is done or failed */
+static void s_mp_batch_run(aws_s_mp_pool *pool, void *arg)
+{
+  s_mp_batch *b = (s_mp_batch *)arg;
+  int         ix, err;
+
+  for (;;) {
+    aws_s_mp_pool_lock(pool);
+    ix = (!aws_s_mp_pool_failed(pool) && b->next < b->n) ? b->next++ : -1;
+    aws_s_mp_pool_unlock(pool);
+    if (ix < 0) {
+      return;
+    }
+
+    if ((err = b->fn(&b->G[ix], &b->X[ix], b->ctx, &b->Y[ix])) != AWS_MP_OKAY) {
+      aws_s_mp_pool_lock(pool);
+      aws_s_mp_pool_fail(pool, err);
+      aws_s_mp_pool_unlock(pool);
+    }
+  }
+}
+
+static int s_mp_exptmod_batch(aws_mp_int *G, aws_mp_int *X, aws_mp_int *Y, int n, aws_mp_mod_ctx *ctx, int threads,
+                              int (*fn)(aws_mp_int *, aws_mp_int *, aws_mp_mod_ctx *, aws_mp_int *))
+{
+  s_mp_batch b;
+
+  if (n < 0) {
+    return AWS_MP_VAL;
+  }
+
+  b.G    = G;
+  b.X    = X;
+  b.Y    = Y;
+  b.ctx  = ctx;
+  b.fn   = fn;
+  b.n    = n;
+  b.next = 0;
+  return aws_s_mp_pool_run(s_mp_batch_run, &b, threads, n);
+}
+
+/* public exponents, aws_mp_exptmod_ctx per item */
+int aws_mp_exptmod_batch(aws_mp_int *G, aws_mp_int *X, aws_mp_int *Y, int n, aws_mp_mod_ctx *ctx, int threads)
+{
+  return s_mp_exptmod_batch(G, X, Y, n, ctx, threads, aws_mp_exptmod_ctx);
+}
+
+/* secret exponents, aws_mp_exptmod_ctx_ct per item [Montgomery contexts only] */
+int aws_mp_exptmod_batch_ct(aws_mp_int *G, aws_mp_int *X, aws_mp_int *Y, int n, aws_mp_mod_ctx *ctx, int threads)
+{
+  return s_mp_exptmod_batch(G, X, Y, n, ctx, threads, aws_mp_exptmod_ctx_ct);
+}
+#endif
+
+#ifdef AWS_BN_MP_EXPTMOD_COMB_C
+
+/* Fixed base exponentiation with a Lim-Lee comb [HAC pp.625, Algorithm 14.113]
+ *
+ * The exponent is cut into h = teeth rows of a = ceil(bits/h) bits.  With
+ * T[i] = prod g**(2**(j*a)) over the set bits j of i precomputed, g**e takes
+ * a squarings and at most a multiplications: the h bits of column k pick
+ * one table entry.  With h = 4 that is a quarter of the squarings of a
+ * windowed exptmod, h = 8 an eighth.
+ */
+
+/* returns bit "b" of |a| */
+static int s_comb_bit(aws_mp_int *a, int b)
+{
+  int ix = b / AWS_DIGIT_BIT;
+
+  if (ix >= a->used) {
+     return 0;
+  }
+  return (int)((a->dp[ix] >> (b % AWS_DIGIT_BIT)) & 1);
+}
+
+int aws_mp_comb_init(aws_mp_comb *comb, aws_mp_int *g, aws_mp_mod_ctx *ctx, int bits, int teeth)
+{
+  int     err, x, y;
+
+  if (bits <= 0 || teeth <= 0 || teeth > 10) {
+     return AWS_MP_VAL;
+  }
+
+  comb->teeth   = teeth;
+  comb->spacing = (bits + teeth - 1) / teeth;
+  comb->bits    = comb->spacing * teeth;
+  comb->ctx     = ctx;
+
+  if ((err = aws_mp_init_copy(&comb->G, g)) != AWS_MP_OKAY) {
+     return err;
+  }
+
+  comb->T = AWS_OPT_CAST(aws_mp_int) AWS_XMALLOC(sizeof(aws_mp_int) * (1 << teeth));
+  if (comb->T == NULL) {
+      aws_mp_clear(&comb->G);
+     return AWS_MP_MEM;
+  }
+  for (x = 0; x < (1 << teeth); x++) {
+     if ((err = aws_mp_init(&comb->T[x])) != AWS_MP_OKAY) {
+        while (x-- > 0) {
+            aws_mp_clear(&comb->T[x]);
+        }
+        goto LBL_T;
+     }
+  }
+
+  /* T[0] = 1 and T[1] = g, both in the reduction domain */
+    aws_mp_set(&comb->T[0], 1);
+  if ((err = aws_mp_mod_ctx_to(&comb->T[0], ctx, &comb->T[0])) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+  if ((err = aws_mp_mod_ctx_to(g, ctx, &comb->T[1])) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+
+  /* T[2**j] = T[2**(j-1)]**(2**a) */
+  for (x = 1; x < teeth; x++) {
+     if ((err = aws_mp_copy(&comb->T[1 << (x - 1)], &comb->T[1 << x])) != AWS_MP_OKAY) {
+        goto LBL_ERR;
+     }
+     for (y = 0; y < comb->spacing; y++) {
+        if ((err = aws_mp_mod_ctx_sqr(&comb->T[1 << x], ctx, &comb->T[1 << x])) != AWS_MP_OKAY) {
+           goto LBL_ERR;
+        }
+     }
+  }
+
+  /* every other entry is the entry without its lowest bit times that bit's entry */
+  for (x = 3; x < (1 << teeth); x++) {
+     if ((x & (x - 1)) == 0) {
+        continue;
+     }
+     if ((err = aws_mp_mod_ctx_mul(&comb->T[x & (x - 1)], &comb->T[x & -x], ctx, &comb->T[x])) != AWS_MP_OKAY) {
+        goto LBL_ERR;
+     }
+  }
+  return AWS_MP_OKAY;
+
+LBL_ERR:
+  for (x = 0; x < (1 << teeth); x++) {
+      aws_mp_clear(&comb->T[x]);
+  }
+LBL_T:
+  AWS_XFREE(comb->T);
+  comb->T = NULL;
+    aws_mp_clear(&comb->G);
+  return err;
+}
+
+void aws_mp_comb_clear(aws_mp_comb *comb)
+{
+  int x;
+
+  if (comb->T != NULL) {
+     for (x = 0; x < (1 << comb->teeth); x++) {
+         aws_mp_clear(&comb->T[x]);
+     }
+     AWS_XFREE(comb->T);
+     comb->T = NULL;
+  }
+    aws_mp_clear(&comb->G);
+}
+
+int aws_mp_exptmod_comb(aws_mp_comb *comb, aws_mp_int *X, aws_mp_int *Y)
+{
+  aws_mp_int res;
+  int     err, j, k, idx;
+
+  /* negative or too wide exponents take the general path */
+  if (X->sign == AWS_MP_NEG || aws_mp_count_bits(X) > comb->bits) {
+     return aws_mp_exptmod_ctx(&comb->G, X, comb->ctx, Y);
+  }
+
+  aws_mp_scratch_begin();
+  if ((err = aws_mp_init_scratch(&res, comb->ctx->N.used * 2 + 2)) != AWS_MP_OKAY) {
+     aws_mp_scratch_end();
+     return err;
+  }
+  if ((err = aws_mp_copy(&comb->T[0], &res)) != AWS_MP_OKAY) {
+     goto LBL_RES;
+  }
+
+  for (k = comb->spacing - 1; k >= 0; k--) {
+     if (k != comb->spacing - 1) {
+        if ((err = aws_mp_mod_ctx_sqr(&res, comb->ctx, &res)) != AWS_MP_OKAY) {
+           goto LBL_RES;
+        }
+     }
+
+     /* gather column k of the exponent */
+     idx = 0;
+     for (j = comb->teeth - 1; j >= 0; j--) {
+        idx = (idx << 1) | s_comb_bit(X, j * comb->spacing + k);
+     }
+     if (idx != 0) {
+        if ((err = aws_mp_mod_ctx_mul(&res, &comb->T[idx], comb->ctx, &res)) != AWS_MP_OKAY) {
+           goto LBL_RES;
+        }
+     }
+  }
+
+  if ((err = aws_mp_mod_ctx_from(&res, comb->ctx)) != AWS_MP_OKAY) {
+     goto LBL_RES;
+  }
+  err = aws_mp_copy(&res, Y);
+LBL_RES:
+aws_mp_clear(&res);
+  aws_mp_scratch_end();
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_MP_EXPTMOD_CT_C
+
+/* Constant time modular exponentiation for secret exponents
+ *
+ * The sliding window of aws_mp_exptmod skips zero bits and only multiplies
+ * for set windows, and it indexes its table directly, so both the operation
+ * sequence and the memory access pattern follow the exponent.  Here every
+ * window of the exponent costs the same squarings and one multiplication,
+ * the table entry is gathered by scanning every entry under a mask and the
+ * Montgomery kernels run at the full width of the modulus with a masked
+ * final subtraction.
+ *
+ * Only the bit length of X is visible [as with the usual constant time
+ * exponentiations].  The modulus must be odd and at most
+ * AWS_MP_MONTGOMERY_DIGS digits, anything else is AWS_MP_VAL.
+ */
+
+/* a = a padded with zero digits to "digs" digits [unclamped] */
+static int s_mp_ct_pad(aws_mp_int *a, int digs)
+{
+  int ix, res;
+
+  if (a->alloc < digs) {
+    if ((res = aws_mp_grow(a, digs)) != AWS_MP_OKAY) {
+      return res;
+    }
+  }
+  for (ix = a->used; ix < digs; ix++) {
+    a->dp[ix] = 0;
+  }
+  a->used = digs;
+  return AWS_MP_OKAY;
+}
+
+/* out = T[idx] for 0 <= idx < count, touching every entry the same way.
+ * out must hold "digs" digits, the entries may be shorter.
+ */
+static void s_mp_ct_select(aws_mp_int *T, int count, int idx, aws_mp_int *out, int digs)
+{
+  int          ix, k;
+  aws_mp_digit mask;
+
+  for (ix = 0; ix < digs; ix++) {
+    out->dp[ix] = 0;
+  }
+  for (k = 0; k < count; k++) {
+    /* all ones when k == idx */
+    mask = (aws_mp_digit)0 - (aws_mp_digit)((((unsigned int)(k ^ idx)) - 1u) >> (sizeof(unsigned int) * CHAR_BIT - 1));
+    for (ix = 0; ix < T[k].used && ix < digs; ix++) {
+      out->dp[ix] |= T[k].dp[ix] & mask;
+    }
+  }
+  out->used = digs;
+  out->sign = AWS_MP_ZPOS;
+}
+
+/* bits [b, b + w) of |a|, zero past the top */
+static int s_mp_ct_window(aws_mp_int *a, int b, int w)
+{
+  int ix, y;
+
+  y = 0;
+  for (ix = w - 1; ix >= 0; ix--) {
+    int bit = b + ix, d = bit / AWS_DIGIT_BIT;
+    y = (y << 1) | ((d < a->used) ? (int)((a->dp[d] >> (bit % AWS_DIGIT_BIT)) & 1) : 0);
+  }
+  return y;
+}
+
+int aws_mp_exptmod_ct(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int *Y)
+{
+  aws_mp_mod_ctx ctx;
+  int err;
+
+  /* modulus P must be odd, Montgomery reduction is the only one with a fixed width kernel */
+  if (P->sign == AWS_MP_NEG || aws_mp_isodd(P) == AWS_MP_NO) {
+    return AWS_MP_VAL;
+  }
+  if ((err = aws_mp_mod_ctx_init_mode(&ctx, P, AWS_MP_REDUCE_MONTGOMERY)) != AWS_MP_OKAY) {
+    return err;
+  }
+  err = aws_mp_exptmod_ctx_ct(G, X, &ctx, Y);
+    aws_mp_mod_ctx_clear(&ctx);
+  return err;
+}
+
+/* res = res/R (mod N), out of the Montgomery domain by a product with 1 */
+static int s_mp_ct_from(aws_mp_int *res, aws_mp_mod_ctx *ctx)
+{
+  aws_mp_int one;
+  int        err;
+
+  if ((err = aws_mp_init_scratch(&one, ctx->N.used)) != AWS_MP_OKAY) {
+    return err;
+  }
+    aws_mp_set(&one, 1);
+  if ((err = s_mp_ct_pad(&one, ctx->N.used)) == AWS_MP_OKAY) {
+    err = aws_fast_mp_montgomery_mul_ct(res, &one, &ctx->N, ctx->mp, res);
+  }
+  aws_mp_clear(&one);
+  if (err == AWS_MP_OKAY) {
+      aws_mp_clamp(res);
+  }
+  return err;
+}
+
+/* M[x] = G**x R mod N for 0 <= x < count, M[0] = R mod N, all padded to the
+ * width of N.  t is a temporary of that width.
+ *
+ * G is only divided by N if it is out of range, callers with a secret base
+ * should pass it reduced.
+ */
+static int s_mp_ct_table(aws_mp_int *G, aws_mp_mod_ctx *ctx, aws_mp_int *M, int count, aws_mp_int *t)
+{
+  int err, x, nu = ctx->N.used;
+
+    aws_mp_set(&M[0], 1);
+  if ((err = aws_mp_mod_ctx_to(&M[0], ctx, &M[0])) != AWS_MP_OKAY) {
+    return err;
+  }
+  if (G->sign == AWS_MP_NEG || aws_mp_cmp_mag(G, &ctx->N) != AWS_MP_LT) {
+    err = aws_mp_mod(G, &ctx->N, &M[1]);
+  } else {
+    err = aws_mp_copy(G, &M[1]);
+  }
+  if (err != AWS_MP_OKAY) {
+    return err;
+  }
+  if ((err = aws_mp_copy(&ctx->RR, t)) != AWS_MP_OKAY) {
+    return err;
+  }
+  if ((err = s_mp_ct_pad(&M[0], nu)) != AWS_MP_OKAY) {
+    return err;
+  }
+  if ((err = s_mp_ct_pad(&M[1], nu)) != AWS_MP_OKAY) {
+    return err;
+  }
+  if ((err = s_mp_ct_pad(t, nu)) != AWS_MP_OKAY) {
+    return err;
+  }
+  if ((err = aws_fast_mp_montgomery_mul_ct(&M[1], t, &ctx->N, ctx->mp, &M[1])) != AWS_MP_OKAY) {
+    return err;
+  }
+  for (x = 2; x < count; x++) {
+    if ((err = aws_fast_mp_montgomery_mul_ct(&M[x - 1], &M[1], &ctx->N, ctx->mp, &M[x])) != AWS_MP_OKAY) {
+      return err;
+    }
+  }
+  return AWS_MP_OKAY;
+}
+
+/* the window for a secret exponent of "bits" bits */
+static int s_mp_ct_winsize(int bits)
+{
+  if (bits <= 36) {
+    return 3;
+  } else if (bits <= 140) {
+    return 4;
+  } else if (bits <= 1303) {
+    return 5;
+  }
+  return 6;
+}
+
+int aws_mp_exptmod_ctx_ct(aws_mp_int *G, aws_mp_int *X, aws_mp_mod_ctx *ctx, aws_mp_int *Y)
+{
+  aws_mp_int M[1 << 6], res, t;
+  int        err, nu, winsize, nwin, x, y;
+
+  nu = ctx->N.used;
+  if (ctx->mode != AWS_MP_REDUCE_MONTGOMERY || nu > AWS_MP_MONTGOMERY_DIGS || X->sign == AWS_MP_NEG) {
+    return AWS_MP_VAL;
   }
 
-/* modified diminished radix reduction */
-#if defined(AWS_BN_MP_REDUCE_IS_2K_L_C) && defined(AWS_BN_MP_REDUCE_2K_L_C) && defined(AWS_BN_S_MP_EXPTMOD_C)
-  if (aws_mp_reduce_is_2k_l(P) == AWS_MP_YES) {
-     return aws_s_mp_exptmod(G, X, P, Y, 1);
+  /* the window only depends on the bit length of X */
+  x = aws_mp_count_bits(X);
+  winsize = s_mp_ct_winsize(x);
+  nwin = (x + winsize - 1) / winsize;
+
+  /* the table and temps come from the scratch arena */
+  aws_mp_scratch_begin();
+  for (x = 0; x < (1 << winsize); x++) {
+    if ((err = aws_mp_init_scratch(&M[x], nu + 1)) != AWS_MP_OKAY) {
+      for (y = 0; y < x; y++) {
+          aws_mp_clear(&M[y]);
+      }
+      aws_mp_scratch_end();
+      return err;
+    }
+  }
+  if ((err = aws_mp_init_scratch(&res, nu + 1)) != AWS_MP_OKAY) {
+    goto LBL_M;
+  }
+  if ((err = aws_mp_init_scratch(&t, nu + 1)) != AWS_MP_OKAY) {
+    goto LBL_RES;
   }
-#endif
 
-#ifdef AWS_BN_MP_DR_IS_MODULUS_C
-  /* is it a DR modulus? */
-  dr = aws_mp_dr_is_modulus(P);
-#else
-  /* default to no */
-  dr = 0;
-#endif
+  if ((err = s_mp_ct_table(G, ctx, M, 1 << winsize, &t)) != AWS_MP_OKAY) {
+    goto LBL_T;
+  }
 
-#ifdef AWS_BN_MP_REDUCE_IS_2K_C
-  /* if not, is it a unrestricted DR modulus? */
-  if (dr == 0) {
-     dr = aws_mp_reduce_is_2k(P) << 1;
+  /* res = R mod N, t is the gathered table entry */
+  if ((err = aws_mp_copy(&M[0], &res)) != AWS_MP_OKAY) {
+    goto LBL_T;
   }
-#endif
-    
-  /* if the modulus is odd or dr != 0 use the montgomery method */
-#ifdef AWS_BN_MP_EXPTMOD_FAST_C
-  if (aws_mp_isodd (P) == 1 || dr !=  0) {
-    return aws_mp_exptmod_fast(G, X, P, Y, dr);
-  } else {
-#endif
-#ifdef AWS_BN_S_MP_EXPTMOD_C
-    /* otherwise use the generic Barrett reduction technique */
-    return aws_s_mp_exptmod(G, X, P, Y, 0);
-#else
-    /* no exptmod for evens */
-    return AWS_MP_VAL;
-#endif
-#ifdef AWS_BN_MP_EXPTMOD_FAST_C
+  if ((err = s_mp_ct_pad(&res, nu)) != AWS_MP_OKAY) {
+    goto LBL_T;
   }
-#endif
-}
 
-#endif
+  for (x = nwin - 1; x >= 0; x--) {
+    /* squarings [res is still 1 for the top window] */
+    if (x != nwin - 1) {
+      for (y = 0; y < winsize; y++) {
+        if ((err = aws_fast_mp_montgomery_sqr_ct(&res, &ctx->N, ctx->mp, &res)) != AWS_MP_OKAY) {
+          goto LBL_T;
+        }
+      }
+    }
 
-#ifdef AWS_BN_MP_PRIME_IS_PRIME_C
+    /* then always multiply, M[0] for an all zero window */
+      s_mp_ct_select(M, 1 << winsize, s_mp_ct_window(X, x * winsize, winsize), &t, nu);
+    if ((err = aws_fast_mp_montgomery_mul_ct(&res, &t, &ctx->N, ctx->mp, &res)) != AWS_MP_OKAY) {
+      goto LBL_T;
+    }
+  }
 
-/* performs a variable number of rounds of Miller-Rabin
- *
- * Probability of error after t rounds is no more than
+  if ((err = s_mp_ct_from(&res, ctx)) != AWS_MP_OKAY) {
+    goto LBL_T;
+  }
+  err = aws_mp_copy(&res, Y);
+
+LBL_T:
+aws_mp_clear(&t);
+LBL_RES:
+aws_mp_clear(&res);
+LBL_M:
+  for (x = 0; x < (1 << winsize); x++) {
+      aws_mp_clear(&M[x]);
+  }
+  aws_mp_scratch_end();
+  return err;
+}
 
+/* Y = G[0]**X[0] * G[1]**X[1] * ... * G[n-1]**X[n-1] mod N [Straus/Shamir]
  *
- * Sets result to 1 if probably prime, 0 otherwise
+ * Every base gets its own window table and the windows of all exponents are
+ * walked together, so the squarings are shared: n powers cost the squarings
+ * of one plus a multiplication per base and window.  The same constant time
+ * rules as aws_mp_exptmod_ctx_ct apply, only the length of the longest
+ * exponent is visible.
  */
-int aws_mp_prime_is_prime(aws_mp_int *a, int t, int *result)
+int aws_mp_exptmod_multi(aws_mp_int *G, aws_mp_int *X, int n, aws_mp_mod_ctx *ctx, aws_mp_int *Y)
 {
-  aws_mp_int b;
-  int     ix, err, res;
-
-  /* default to no */
-  *result = AWS_MP_NO;
+  aws_mp_int *M, res, t;
+  int         err, nu, winsize, nwin, bits, count, i, x, y;
 
-  /* valid value of t? */
-  if (t <= 0 || t > AWS_JKTM_PRIME_SIZE) {
+  nu = ctx->N.used;
+  if (ctx->mode != AWS_MP_REDUCE_MONTGOMERY || nu > AWS_MP_MONTGOMERY_DIGS || n < 1) {
     return AWS_MP_VAL;
   }
-
-  /* is the input equal to one of the primes in the table? */
-  for (ix = 0; ix < AWS_JKTM_PRIME_SIZE; ix++) {
-      if (aws_mp_cmp_d(a, aws_ltm_prime_tab[ix]) == AWS_MP_EQ) {
-         *result = 1;
-         return AWS_MP_OKAY;
-      }
+  bits = 0;
+  for (i = 0; i < n; i++) {
+    if (X[i].sign == AWS_MP_NEG) {
+      return AWS_MP_VAL;
+    }
+    bits = AWS_MAX(bits, aws_mp_count_bits(&X[i]));
   }
 
-  /* first perform trial division */
-  if ((err = aws_mp_prime_is_divisible(a, &res)) != AWS_MP_OKAY) {
-    return err;
+  /* each base pays for its own table and multiplications, so the best
+   * window is the one of a single exponentiation
+   */
+  winsize = s_mp_ct_winsize(bits);
+  nwin = (bits + winsize - 1) / winsize;
+  count = n << winsize;
+
+  M = AWS_OPT_CAST(aws_mp_int) AWS_XMALLOC(sizeof(aws_mp_int) * count);
+  if (M == NULL) {
+    return AWS_MP_MEM;
   }
 
-  /* return if it was trivially divisible */
-  if (res == AWS_MP_YES) {
-    return AWS_MP_OKAY;
+  /* the tables and temps come from the scratch arena */
+  aws_mp_scratch_begin();
+  for (x = 0; x < count; x++) {
+    if ((err = aws_mp_init_scratch(&M[x], nu + 1)) != AWS_MP_OKAY) {
+      for (y = 0; y < x; y++) {
+          aws_mp_clear(&M[y]);
+      }
+      goto LBL_END;
+    }
+  }
+  if ((err = aws_mp_init_scratch(&res, nu + 1)) != AWS_MP_OKAY) {
+    goto LBL_M;
+  }
+  if ((err = aws_mp_init_scratch(&t, nu + 1)) != AWS_MP_OKAY) {
+    goto LBL_RES;
   }
 
-  /* now perform the miller-rabin rounds */
-  if ((err = aws_mp_init(&b)) != AWS_MP_OKAY) {
-    return err;
+  for (i = 0; i < n; i++) {
+    if ((err = s_mp_ct_table(&G[i], ctx, &M[i << winsize], 1 << winsize, &t)) != AWS_MP_OKAY) {
+      goto LBL_T;
+    }
   }
 
-  for (ix = 0; ix < t; ix++) {
-    /* set the prime */
-      aws_mp_set(&b, aws_ltm_prime_tab[ix]);
+  /* res = R mod N */
+  if ((err = aws_mp_copy(&M[0], &res)) != AWS_MP_OKAY) {
+    goto LBL_T;
+  }
+  if ((err = s_mp_ct_pad(&res, nu)) != AWS_MP_OKAY) {
+    goto LBL_T;
+  }
 
-    if ((err = aws_mp_prime_miller_rabin(a, &b, &res)) != AWS_MP_OKAY) {
-      goto LBL_B;
+  for (x = nwin - 1; x >= 0; x--) {
+    if (x != nwin - 1) {
+      for (y = 0; y < winsize; y++) {
+        if ((err = aws_fast_mp_montgomery_sqr_ct(&res, &ctx->N, ctx->mp, &res)) != AWS_MP_OKAY) {
+          goto LBL_T;
+        }
+      }
     }
 
-    if (res == AWS_MP_NO) {
-      goto LBL_B;
+    /* one multiplication per base, by its R entry for an all zero window */
+    for (i = 0; i < n; i++) {
+        s_mp_ct_select(&M[i << winsize], 1 << winsize, s_mp_ct_window(&X[i], x * winsize, winsize), &t, nu);
+      if ((err = aws_fast_mp_montgomery_mul_ct(&res, &t, &ctx->N, ctx->mp, &res)) != AWS_MP_OKAY) {
+        goto LBL_T;
+      }
     }
   }
 
-  /* passed the test */
-  *result = AWS_MP_YES;
-LBL_B:
-aws_mp_clear(&b);
+  if ((err = s_mp_ct_from(&res, ctx)) != AWS_MP_OKAY) {
+    goto LBL_T;
+  }
+  err = aws_mp_copy(&res, Y);
+
+LBL_T:
+aws_mp_clear(&t);
+LBL_RES:
+aws_mp_clear(&res);
+LBL_M:
+  for (x = 0; x < count; x++) {
+      aws_mp_clear(&M[x]);
+  }
+LBL_END:
+  aws_mp_scratch_end();
+  AWS_XFREE(M);
   return err;
 }
-#endif
-
-#ifdef AWS_BN_MP_REDUCE_2K_L_C
 
-/* reduces a modulo n where n is of the form 2**p - d 
-   This differs from reduce_2k since "d" can be larger
-   than a single digit.
-*/
-int aws_mp_reduce_2k_l(aws_mp_int *a, aws_mp_int *n, aws_mp_int *d)
+/* aws_mp_exptmod_comb with the same rules: every column of the comb costs one
+ * squaring and one multiplication with a masked gather of the table entry.
+ * The table itself only depends on the public base.
+ */
+int aws_mp_exptmod_comb_ct(aws_mp_comb *comb, aws_mp_int *X, aws_mp_int *Y)
 {
-   aws_mp_int q;
-   int    p, res;
-   
-   if ((res = aws_mp_init(&q)) != AWS_MP_OKAY) {
-      return res;
-   }
-   
-   p = aws_mp_count_bits(n);
-top:
-   /* q = a/2**p, a = a mod 2**p */
-   if ((res = aws_mp_div_2d(a, p, &q, a)) != AWS_MP_OKAY) {
-      goto ERR;
-   }
-   
-   /* q = q * d */
-   if ((res = aws_mp_mul(&q, d, &q)) != AWS_MP_OKAY) {
-      goto ERR;
-   }
-   
-   /* a = a + q */
-   if ((res = aws_s_mp_add(a, &q, a)) != AWS_MP_OKAY) {
-      goto ERR;
-   }
-   
-   if (aws_mp_cmp_mag(a, n) != AWS_MP_LT) {
-       aws_s_mp_sub(a, n, a);
-      goto top;
-   }
-   
-ERR:
-aws_mp_clear(&q);
-   return res;
-}
+  aws_mp_mod_ctx *ctx = comb->ctx;
+  aws_mp_int      res, t;
+  int             err, j, k, idx, nu;
+
+  nu = ctx->N.used;
+  if (ctx->mode != AWS_MP_REDUCE_MONTGOMERY || nu > AWS_MP_MONTGOMERY_DIGS || X->sign == AWS_MP_NEG) {
+    return AWS_MP_VAL;
+  }
+
+  /* exponents wider than the table take the general path */
+  if (aws_mp_count_bits(X) > comb->bits) {
+    return aws_mp_exptmod_ctx_ct(&comb->G, X, ctx, Y);
+  }
+
+  aws_mp_scratch_begin();
+  if ((err = aws_mp_init_scratch(&t, nu + 1)) != AWS_MP_OKAY) {
+    aws_mp_scratch_end();
+    return err;
+  }
+  if ((err = aws_mp_init_scratch(&res, nu + 1)) != AWS_MP_OKAY) {
+    goto LBL_T;
+  }
+  if ((err = aws_mp_copy(&comb->T[0], &res)) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
+  if ((err = s_mp_ct_pad(&res, nu)) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
+  if ((err = s_mp_ct_pad(&t, nu)) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
+
+  for (k = comb->spacing - 1; k >= 0; k--) {
+    if (k != comb->spacing - 1) {
+      if ((err = aws_fast_mp_montgomery_sqr_ct(&res, &ctx->N, ctx->mp, &res)) != AWS_MP_OKAY) {
+        goto LBL_RES;
+      }
+    }
+
+    idx = 0;
+    for (j = comb->teeth - 1; j >= 0; j--) {
+      idx = (idx << 1) | s_mp_ct_window(X, j * comb->spacing + k, 1);
+    }
+      s_mp_ct_select(comb->T, 1 << comb->teeth, idx, &t, nu);
+    if ((err = aws_fast_mp_montgomery_mul_ct(&res, &t, &ctx->N, ctx->mp, &res)) != AWS_MP_OKAY) {
+      goto LBL_RES;
+    }
+  }
+
+  if ((err = s_mp_ct_from(&res, ctx)) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
+  err = aws_mp_copy(&res, Y);
 
+LBL_RES:
+aws_mp_clear(&res);
+LBL_T:
+aws_mp_clear(&t);
+  aws_mp_scratch_end();
+  return err;
+}
 #endif
 
-#ifdef AWS_BN_MP_EXPTMOD_FAST_C
+#ifdef AWS_BN_MP_EXPTMOD_CTX_C
 
-/* computes Y == G**X mod P, HAC pp.616, Algorithm 14.85
+/* computes Y == G**X mod N, HAC pp.616, Algorithm 14.85
  *
  * Uses a left-to-right k-ary sliding window to compute the modular exponentiation.
  * The value of k changes based on the size of the exponent.
  *
- * Uses Montgomery or Diminished Radix reduction [whichever appropriate]
+ * The reduction [Montgomery, DR, 2k, Barrett or 2k_l] and its setup values
+ * come precomputed from the context.
+ * Montgomery products below AWS_MP_MONTGOMERY_DIGS digits go through the
+ * fused CIOS kernels, see aws_mp_mod_ctx_mul and aws_mp_mod_ctx_sqr.
  */
 
 #ifdef AWS_MP_LOW_MEM
@@ -4305,17 +6865,40 @@ aws_mp_clear(&q);
    #define TAB_SIZE 256
 #endif
 
-int aws_mp_exptmod_fast(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int *Y, int redmode)
+int aws_mp_exptmod_ctx(aws_mp_int *G, aws_mp_int *X, aws_mp_mod_ctx *ctx, aws_mp_int *Y)
 {
   aws_mp_int M[TAB_SIZE], res;
-  aws_mp_digit buf, mp;
-  int     err, bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize;
+  aws_mp_digit buf;
+  int     err, bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize, digs;
 
-  /* use a pointer to the reduction algorithm.  This allows us to use
-   * one of many reduction algorithms without modding the guts of
-   * the code with if statements everywhere.
-   */
-  int     (*redux)(aws_mp_int *, aws_mp_int *,aws_mp_digit);
+  /* if exponent X is negative we have to recurse */
+  if (X->sign == AWS_MP_NEG) {
+#ifdef AWS_BN_MP_INVMOD_C
+     aws_mp_int tmpG, tmpX;
+
+     /* first compute 1/G mod P */
+     if ((err = aws_mp_init_multi(&tmpG, &tmpX, NULL)) != AWS_MP_OKAY) {
+        return err;
+     }
+     if ((err = aws_mp_invmod(G, &ctx->N, &tmpG)) != AWS_MP_OKAY) {
+        goto LBL_TMP;
+     }
+
+     /* now get |X| */
+     if ((err = aws_mp_abs(X, &tmpX)) != AWS_MP_OKAY) {
+        goto LBL_TMP;
+     }
+
+     /* and now compute (1/G)**|X| instead of G**X [X < 0] */
+     err = aws_mp_exptmod_ctx(&tmpG, &tmpX, ctx, Y);
+LBL_TMP:
+aws_mp_clear_multi(&tmpG, &tmpX, NULL);
+     return err;
+#else
+     /* no invmod */
+     return AWS_MP_VAL;
+#endif
+  }
 
   /* find window size */
   x = aws_mp_count_bits(X);
@@ -4341,105 +6924,51 @@ int aws_mp_exptmod_fast(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int
   }
 #endif
 
+  /* the table and result live in the scratch arena, sized to hold a full
+   * product so the reductions never have to grow them
+   */
+  digs = ctx->N.used * 2 + 2;
+  aws_mp_scratch_begin();
+
   /* init M array */
   /* init first cell */
-  if ((err = aws_mp_init(&M[1])) != AWS_MP_OKAY) {
+  if ((err = aws_mp_init_scratch(&M[1], digs)) != AWS_MP_OKAY) {
+     aws_mp_scratch_end();
      return err;
   }
 
   /* now init the second half of the array */
   for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
-    if ((err = aws_mp_init(&M[x])) != AWS_MP_OKAY) {
+    if ((err = aws_mp_init_scratch(&M[x], digs)) != AWS_MP_OKAY) {
       for (y = 1<<(winsize-1); y < x; y++) {
           aws_mp_clear(&M[y]);
       }
-        aws_mp_clear(&M[1]);
-      return err;
-    }
-  }
-
-  /* determine and setup reduction code */
-  if (redmode == 0) {
-#ifdef AWS_BN_MP_MONTGOMERY_SETUP_C
-     /* now setup montgomery  */
-     if ((err = aws_mp_montgomery_setup(P, &mp)) != AWS_MP_OKAY) {
-        goto LBL_M;
-     }
-#else
-     err = AWS_MP_VAL;
-     goto LBL_M;
-#endif
-
-     /* automatically pick the comba one if available (saves quite a few calls/ifs) */
-#ifdef AWS_BN_FAST_MP_MONTGOMERY_REDUCE_C
-     if (((P->used * 2 + 1) < AWS_MP_WARRAY) &&
-          P->used < (1 << ((CHAR_BIT * sizeof (aws_mp_word)) - (2 * AWS_DIGIT_BIT)))) {
-        redux = aws_fast_mp_montgomery_reduce;
-     } else 
-#endif
-     {
-#ifdef AWS_BN_MP_MONTGOMERY_REDUCE_C
-        /* use slower baseline Montgomery method */
-        redux = aws_mp_montgomery_reduce;
-#else
-        err = AWS_MP_VAL;
-        goto LBL_M;
-#endif
-     }
-  } else if (redmode == 1) {
-#if defined(AWS_BN_MP_DR_SETUP_C) && defined(AWS_BN_MP_DR_REDUCE_C)
-     /* setup DR reduction for moduli of the form B**k - b */
-      aws_mp_dr_setup(P, &mp);
-     redux = aws_mp_dr_reduce;
-#else
-     err = AWS_MP_VAL;
-     goto LBL_M;
-#endif
-  } else {
-#if defined(AWS_BN_MP_REDUCE_2K_SETUP_C) && defined(AWS_BN_MP_REDUCE_2K_C)
-     /* setup DR reduction for moduli of the form 2**k - b */
-     if ((err = aws_mp_reduce_2k_setup(P, &mp)) != AWS_MP_OKAY) {
-        goto LBL_M;
-     }
-     redux = aws_mp_reduce_2k;
-#else
-     err = AWS_MP_VAL;
-     goto LBL_M;
-#endif
+        aws_mp_clear(&M[1]);
+      aws_mp_scratch_end();
+      return err;
+    }
   }
 
   /* setup result */
-  if ((err = aws_mp_init(&res)) != AWS_MP_OKAY) {
+  if ((err = aws_mp_init_scratch(&res, digs)) != AWS_MP_OKAY) {
     goto LBL_M;
   }
 
   /* create M table
    *
-
+   * The M table contains powers of the base, e.g. M[x] = G**x mod P,
+   * kept in the reduction domain of the context [times R for Montgomery]
    *
    * The first half of the table is not computed though accept for M[0] and M[1]
    */
+  if ((err = aws_mp_mod_ctx_to(G, ctx, &M[1])) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
 
-  if (redmode == 0) {
-#ifdef AWS_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C
-     /* now we need R mod m */
-     if ((err = aws_mp_montgomery_calc_normalization(&res, P)) != AWS_MP_OKAY) {
-       goto LBL_RES;
-     }
-#else 
-     err = AWS_MP_VAL;
-     goto LBL_RES;
-#endif
-
-     /* now set M[1] to G * R mod m */
-     if ((err = aws_mp_mulmod(G, &res, P, &M[1])) != AWS_MP_OKAY) {
-       goto LBL_RES;
-     }
-  } else {
-      aws_mp_set(&res, 1);
-     if ((err = aws_mp_mod(G, P, &M[1])) != AWS_MP_OKAY) {
-        goto LBL_RES;
-     }
+  /* res = 1 in the same domain */
+    aws_mp_set(&res, 1);
+  if ((err = aws_mp_mod_ctx_to(&res, ctx, &res)) != AWS_MP_OKAY) {
+    goto LBL_RES;
   }
 
   /* compute the value at M[1<<(winsize-1)] by squaring M[1] (winsize-1) times */
@@ -4448,20 +6977,14 @@ int aws_mp_exptmod_fast(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int
   }
 
   for (x = 0; x < (winsize - 1); x++) {
-    if ((err = aws_mp_sqr(&M[1 << (winsize - 1)], &M[1 << (winsize - 1)])) != AWS_MP_OKAY) {
-      goto LBL_RES;
-    }
-    if ((err = redux (&M[1 << (winsize - 1)], P, mp)) != AWS_MP_OKAY) {
+    if ((err = aws_mp_mod_ctx_sqr(&M[1 << (winsize - 1)], ctx, &M[1 << (winsize - 1)])) != AWS_MP_OKAY) {
       goto LBL_RES;
     }
   }
 
   /* create upper table */
   for (x = (1 << (winsize - 1)) + 1; x < (1 << winsize); x++) {
-    if ((err = aws_mp_mul(&M[x - 1], &M[1], &M[x])) != AWS_MP_OKAY) {
-      goto LBL_RES;
-    }
-    if ((err = redux (&M[x], P, mp)) != AWS_MP_OKAY) {
+    if ((err = aws_mp_mod_ctx_mul(&M[x - 1], &M[1], ctx, &M[x])) != AWS_MP_OKAY) {
       goto LBL_RES;
     }
   }
@@ -4501,10 +7024,7 @@ int aws_mp_exptmod_fast(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int
 
     /* if the bit is zero and mode == 1 then we square */
     if (mode == 1 && y == 0) {
-      if ((err = aws_mp_sqr(&res, &res)) != AWS_MP_OKAY) {
-        goto LBL_RES;
-      }
-      if ((err = redux (&res, P, mp)) != AWS_MP_OKAY) {
+      if ((err = aws_mp_mod_ctx_sqr(&res, ctx, &res)) != AWS_MP_OKAY) {
         goto LBL_RES;
       }
       continue;
@@ -4518,19 +7038,13 @@ int aws_mp_exptmod_fast(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int
       /* ok window is filled so square as required and multiply  */
       /* square first */
       for (x = 0; x < winsize; x++) {
-        if ((err = aws_mp_sqr(&res, &res)) != AWS_MP_OKAY) {
-          goto LBL_RES;
-        }
-        if ((err = redux (&res, P, mp)) != AWS_MP_OKAY) {
+        if ((err = aws_mp_mod_ctx_sqr(&res, ctx, &res)) != AWS_MP_OKAY) {
           goto LBL_RES;
         }
       }
 
       /* then multiply */
-      if ((err = aws_mp_mul(&res, &M[bitbuf], &res)) != AWS_MP_OKAY) {
-        goto LBL_RES;
-      }
-      if ((err = redux (&res, P, mp)) != AWS_MP_OKAY) {
+      if ((err = aws_mp_mod_ctx_mul(&res, &M[bitbuf], ctx, &res)) != AWS_MP_OKAY) {
         goto LBL_RES;
       }
 
@@ -4545,10 +7059,7 @@ int aws_mp_exptmod_fast(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int
   if (mode == 2 && bitcpy > 0) {
     /* square then multiply if the bit is set */
     for (x = 0; x < bitcpy; x++) {
-      if ((err = aws_mp_sqr(&res, &res)) != AWS_MP_OKAY) {
-        goto LBL_RES;
-      }
-      if ((err = redux (&res, P, mp)) != AWS_MP_OKAY) {
+      if ((err = aws_mp_mod_ctx_sqr(&res, ctx, &res)) != AWS_MP_OKAY) {
         goto LBL_RES;
       }
 
@@ -4556,30 +7067,27 @@ int aws_mp_exptmod_fast(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int
       bitbuf <<= 1;
       if ((bitbuf & (1 << winsize)) != 0) {
         /* then multiply */
-        if ((err = aws_mp_mul(&res, &M[1], &res)) != AWS_MP_OKAY) {
-          goto LBL_RES;
-        }
-        if ((err = redux (&res, P, mp)) != AWS_MP_OKAY) {
+        if ((err = aws_mp_mod_ctx_mul(&res, &M[1], ctx, &res)) != AWS_MP_OKAY) {
           goto LBL_RES;
         }
       }
     }
   }
 
-  if (redmode == 0) {
-     /* fixup result if Montgomery reduction is used
-      * recall that any value in a Montgomery system is
-      * actually multiplied by R mod n.  So we have
-      * to reduce one more time to cancel out the factor
-      * of R.
-      */
-     if ((err = redux(&res, P, mp)) != AWS_MP_OKAY) {
-       goto LBL_RES;
-     }
+  /* fixup result if Montgomery reduction is used
+   * recall that any value in a Montgomery system is
+   * actually multiplied by R mod n.  So we have
+   * to reduce one more time to cancel out the factor
+   * of R.
+   */
+  if ((err = aws_mp_mod_ctx_from(&res, ctx)) != AWS_MP_OKAY) {
+    goto LBL_RES;
   }
 
-  /* swap res with Y */
-    aws_mp_exch(&res, Y);
+  /* copy res out to Y [it can't outlive the scratch scope] */
+  if ((err = aws_mp_copy(&res, Y)) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
   err = AWS_MP_OKAY;
 LBL_RES:
 aws_mp_clear(&res);
@@ -4588,6 +7096,136 @@ aws_mp_clear(&M[1]);
   for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
       aws_mp_clear(&M[x]);
   }
+  aws_mp_scratch_end();
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_MP_PRIME_IS_PRIME_C
+
+/* performs a variable number of rounds of Miller-Rabin
+ *
+ * Probability of error after t rounds is no more than
+
+ *
+ * Sets result to 1 if probably prime, 0 otherwise
+ */
+int aws_mp_prime_is_prime(aws_mp_int *a, int t, int *result)
+{
+  aws_mp_int b;
+  int     ix, err, res;
+
+  /* default to no */
+  *result = AWS_MP_NO;
+
+  /* valid value of t? */
+  if (t <= 0 || t > AWS_JKTM_PRIME_SIZE) {
+    return AWS_MP_VAL;
+  }
+
+  /* is the input equal to one of the primes in the table? */
+  for (ix = 0; ix < AWS_JKTM_PRIME_SIZE; ix++) {
+      if (aws_mp_cmp_d(a, aws_ltm_prime_tab[ix]) == AWS_MP_EQ) {
+         *result = 1;
+         return AWS_MP_OKAY;
+      }
+  }
+
+  /* first perform trial division */
+  if ((err = aws_mp_prime_is_divisible(a, &res)) != AWS_MP_OKAY) {
+    return err;
+  }
+
+  /* return if it was trivially divisible */
+  if (res == AWS_MP_YES) {
+    return AWS_MP_OKAY;
+  }
+
+  /* now perform the miller-rabin rounds */
+  if ((err = aws_mp_init(&b)) != AWS_MP_OKAY) {
+    return err;
+  }
+
+  for (ix = 0; ix < t; ix++) {
+    /* set the prime */
+      aws_mp_set(&b, aws_ltm_prime_tab[ix]);
+
+    if ((err = aws_mp_prime_miller_rabin(a, &b, &res)) != AWS_MP_OKAY) {
+      goto LBL_B;
+    }
+
+    if (res == AWS_MP_NO) {
+      goto LBL_B;
+    }
+  }
+
+  /* passed the test */
+  *result = AWS_MP_YES;
+LBL_B:
+aws_mp_clear(&b);
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_MP_REDUCE_2K_L_C
+
+/* reduces a modulo n where n is of the form 2**p - d 
+   This differs from reduce_2k since "d" can be larger
+   than a single digit.
+*/
+int aws_mp_reduce_2k_l(aws_mp_int *a, aws_mp_int *n, aws_mp_int *d)
+{
+   aws_mp_int q;
+   int    p, res;
+   
+   if ((res = aws_mp_init(&q)) != AWS_MP_OKAY) {
+      return res;
+   }
+   
+   p = aws_mp_count_bits(n);
+top:
+   /* q = a/2**p, a = a mod 2**p */
+   if ((res = aws_mp_div_2d(a, p, &q, a)) != AWS_MP_OKAY) {
+      goto ERR;
+   }
+   
+   /* q = q * d */
+   if ((res = aws_mp_mul(&q, d, &q)) != AWS_MP_OKAY) {
+      goto ERR;
+   }
+   
+   /* a = a + q */
+   if ((res = aws_s_mp_add(a, &q, a)) != AWS_MP_OKAY) {
+      goto ERR;
+   }
+   
+   if (aws_mp_cmp_mag(a, n) != AWS_MP_LT) {
+       aws_s_mp_sub(a, n, a);
+      goto top;
+   }
+   
+ERR:
+aws_mp_clear(&q);
+   return res;
+}
+
+#endif
+
+#ifdef AWS_BN_MP_EXPTMOD_FAST_C
+
+/* computes Y == G**X mod P using Montgomery (redmode 0), DR (redmode 1)
+ * or 2k (redmode 2) reduction, see aws_mp_exptmod_ctx
+ */
+int aws_mp_exptmod_fast(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int *Y, int redmode)
+{
+  aws_mp_mod_ctx ctx;
+  int     err;
+
+  if ((err = aws_mp_mod_ctx_init_mode(&ctx, P, redmode)) != AWS_MP_OKAY) {
+     return err;
+  }
+  err = aws_mp_exptmod_ctx(G, X, &ctx, Y);
+    aws_mp_mod_ctx_clear(&ctx);
   return err;
 }
 #endif
@@ -4945,6 +7583,16 @@ aws_mp_exch(aws_mp_int *a, aws_mp_int *b)
   t  = *a;
   *a = *b;
   *b = t;
+
+#ifdef AWS_MP_INLINE_DIGS
+  /* the inline digits moved along with the structs, repoint dp at them */
+  if (a->dp == b->inl) {
+    a->dp = a->inl;
+  }
+  if (b->dp == a->inl) {
+    b->dp = b->inl;
+  }
+#endif
 }
 #endif
 
@@ -5039,17 +7687,24 @@ unsigned long aws_mp_get_int(aws_mp_int *a)
 int aws_mp_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
 {
   int     res, neg;
+  ulong64 cut = AWS_MP_CUTOFFS_LOAD(&s_mp_cutoffs);
   neg = (a->sign == b->sign) ? AWS_MP_ZPOS : AWS_MP_NEG;
 
+#ifdef AWS_BN_MP_NTT_MUL_C
+  /* use the transforms? [they turn down products too long for them] */
+  if (AWS_MIN (a->used, b->used) >= AWS_MP_CUTOFF_NTT(cut) && (res = aws_mp_ntt_mul(a, b, c)) != AWS_MP_VAL) {
+    /* done, or out of memory */
+  } else
+#endif
   /* use Toom-Cook? */
 #ifdef AWS_BN_MP_TOOM_MUL_C
-  if (AWS_MIN (a->used, b->used) >= AWS_TOOM_MUL_CUTOFF) {
+  if (AWS_MIN (a->used, b->used) >= AWS_MP_CUTOFF(cut, AWS_MP_CUTOFF_TMUL)) {
     res = aws_mp_toom_mul(a, b, c);
   } else 
 #endif
 #ifdef AWS_BN_MP_KARATSUBA_MUL_C
   /* use Karatsuba? */
-  if (AWS_MIN (a->used, b->used) >= AWS_KARATSUBA_MUL_CUTOFF) {
+  if (AWS_MIN (a->used, b->used) >= AWS_MP_CUTOFF(cut, AWS_MP_CUTOFF_KMUL)) {
     res = aws_mp_karatsuba_mul(a, b, c);
   } else 
 #endif
@@ -5134,6 +7789,39 @@ int aws_mp_to_unsigned_bin(aws_mp_int *a, unsigned char *b)
 }
 #endif
 
+#ifdef AWS_BN_MP_TO_UNSIGNED_BIN_STREAM_C
+
+/* hand the unsigned [big endian] format to cb in chunks, each byte read
+ * straight from the digits, so there is no copy of a and no buffer its size
+ */
+int aws_mp_to_unsigned_bin_stream(aws_mp_int *a, aws_ltm_bin_callback cb, void *dat)
+{
+  unsigned char buf[AWS_MP_BIN_CHUNK];
+  int           x, ix, shift, len, res;
+  aws_mp_digit  d;
+
+  len = 0;
+  for (x = aws_mp_unsigned_bin_size(a) - 1; x >= 0; x--) {
+    /* byte x counting from the least significant one, it may span two digits */
+    ix    = (x * 8) / AWS_DIGIT_BIT;
+    shift = (x * 8) % AWS_DIGIT_BIT;
+    d     = a->dp[ix] >> shift;
+    if (shift + 8 > AWS_DIGIT_BIT && ix + 1 < a->used) {
+      d |= a->dp[ix + 1] << (AWS_DIGIT_BIT - shift);
+    }
+    buf[len++] = (unsigned char)(d & 255);
+
+    if (len == AWS_MP_BIN_CHUNK || x == 0) {
+      if ((res = cb(buf, (unsigned long)len, dat)) != AWS_MP_OKAY) {
+        return res;
+      }
+      len = 0;
+    }
+  }
+  return AWS_MP_OKAY;
+}
+#endif
+
 #ifdef AWS_BN_S_MP_SQR_C
 
 /* low level squaring, b = a*a, HAC pp.596-597, Algorithm 14.16 */
@@ -5228,6 +7916,178 @@ int aws_mp_neg(aws_mp_int *a, aws_mp_int *b)
 const char *aws_mp_s_rmap = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz+/";
 #endif
 
+#ifdef AWS_BN_S_MP_COMBA_SIMD_C
+
+/* Comba columns on the vector unit
+ *
+ * With 28-bit digits a product fits 56 bits and a whole column of them a 64-bit
+ * lane, which is just what the 32x32->64 vector multiplies give: AVX2 on x86-64
+ * [vpmuludq, four lanes] and NEON on ARM [vmlal, two lanes].  Eight columns are
+ * formed at a time, each digit of a is broadcast and multiplied with the eight
+ * digits of b it meets there [b padded with zeros so the ends of the product
+ * need no special case], and the carries are then resolved column by column as
+ * the scalar comba loops do, so the digits come out exactly the same.  Squares
+ * go through here too, forming every product instead of doubling half of them.
+ *
+ * AVX2 is looked up once at run time, its kernel is built with a target
+ * attribute so the rest of the library needs no -mavx2.  NEON is part of every
+ * ARMv8 core and is only used on ARMv7 when the library is built for it.  Other
+ * digit sizes, MSVC or AWS_MP_NO_SIMD keep the scalar loops.  Defining
+ * AWS_MP_COMBA_NEON builds the NEON kernel on any target with an arm_neon.h,
+ * which is how tools/tommath checks it on hosts without NEON.
+ */
+
+#if defined(AWS_MP_28BIT) && !defined(AWS_MP_NO_SIMD) && defined(__GNUC__)
+   #if defined(__ARM_NEON) || defined(AWS_MP_COMBA_NEON)
+      #ifndef AWS_MP_COMBA_NEON
+         #define AWS_MP_COMBA_NEON
+      #endif
+      #include <arm_neon.h>
+   #elif defined(__x86_64__)
+      #define AWS_MP_COMBA_AVX2
+      #include <immintrin.h>
+   #endif
+#endif
+
+#if defined(AWS_MP_COMBA_NEON) || defined(AWS_MP_COMBA_AVX2)
+   #define AWS_MP_COMBA_SIMD
+   #include <stdint.h>
+#endif
+
+#ifdef AWS_MP_COMBA_SIMD
+
+/* zero digits either side of the copy of b */
+#define AWS_MP_COMBA_PAD  8
+
+/* the vector unit in use: -1 not looked up yet, 0 none [scalar loops], 1 AVX2 or NEON */
+static volatile int s_mp_comba_unit = -1;
+
+/* resolve the carries of the eight uncarried columns from ix, up to hi */
+static aws_mp_word s_mp_comba_carry(const uint64_t *col, int ix, int hi, aws_mp_word _W, aws_mp_digit *W)
+{
+  int iz;
+
+  for (iz = 0; iz < 8 && ix + iz < hi; iz++) {
+    _W += col[iz];
+    W[ix + iz] = ((aws_mp_digit)_W) & AWS_MP_MASK;
+    _W >>= ((aws_mp_word)AWS_DIGIT_BIT);
+  }
+  return _W;
+}
+
+#ifdef AWS_MP_COMBA_AVX2
+__attribute__((target("avx2")))
+static void s_mp_comba_cols(const aws_mp_digit *a, int an, const aws_mp_digit *b, int bn, int lo, int hi,
+                            aws_mp_digit *W)
+{
+  ulong64      B[AWS_MP_WARRAY + 2 * AWS_MP_COMBA_PAD];
+  uint64_t     col[8];
+  aws_mp_word  _W;
+  int          ix, iy, lim;
+  __m256i      x, s0, s1;
+
+  for (ix = 0; ix < AWS_MP_COMBA_PAD; ix++) {
+    B[ix] = B[AWS_MP_COMBA_PAD + bn + ix] = 0;
+  }
+  for (ix = 0; ix < bn; ix++) {
+    B[AWS_MP_COMBA_PAD + ix] = b[ix];
+  }
+
+  _W = 0;
+  for (ix = lo; ix < hi; ix += 8) {
+    s0 = s1 = _mm256_setzero_si256();
+
+    /* a[iy] meets b[ix - iy] through b[ix - iy + 7] in these columns */
+    iy  = AWS_MAX(0, ix - bn + 1);
+    lim = AWS_MIN(an, ix + 8);
+    for (; iy < lim; iy++) {
+      x  = _mm256_set1_epi64x((long long)a[iy]);
+      s0 = _mm256_add_epi64(s0, _mm256_mul_epu32(x,
+             _mm256_loadu_si256((const __m256i *)(B + AWS_MP_COMBA_PAD + ix - iy))));
+      s1 = _mm256_add_epi64(s1, _mm256_mul_epu32(x,
+             _mm256_loadu_si256((const __m256i *)(B + AWS_MP_COMBA_PAD + 4 + ix - iy))));
+    }
+    _mm256_storeu_si256((__m256i *)col, s0);
+    _mm256_storeu_si256((__m256i *)(col + 4), s1);
+    _W = s_mp_comba_carry(col, ix, hi, _W, W);
+  }
+}
+
+static int s_mp_comba_lookup(void)
+{
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") ? 1 : 0;
+}
+#else
+static void s_mp_comba_cols(const aws_mp_digit *a, int an, const aws_mp_digit *b, int bn, int lo, int hi,
+                            aws_mp_digit *W)
+{
+  uint32_t     B[AWS_MP_WARRAY + 2 * AWS_MP_COMBA_PAD];
+  uint64_t     col[8];
+  aws_mp_word  _W;
+  int          ix, iy, lim;
+  uint32_t     x;
+  const uint32_t *tmpb;
+  uint64x2_t   s0, s1, s2, s3;
+
+  for (ix = 0; ix < AWS_MP_COMBA_PAD; ix++) {
+    B[ix] = B[AWS_MP_COMBA_PAD + bn + ix] = 0;
+  }
+  for (ix = 0; ix < bn; ix++) {
+    B[AWS_MP_COMBA_PAD + ix] = (uint32_t)b[ix];
+  }
+
+  _W = 0;
+  for (ix = lo; ix < hi; ix += 8) {
+    s0 = s1 = s2 = s3 = vdupq_n_u64(0);
+
+    /* a[iy] meets b[ix - iy] through b[ix - iy + 7] in these columns */
+    iy  = AWS_MAX(0, ix - bn + 1);
+    lim = AWS_MIN(an, ix + 8);
+    for (; iy < lim; iy++) {
+      x    = (uint32_t)a[iy];
+      tmpb = B + AWS_MP_COMBA_PAD + ix - iy;
+      s0   = vmlal_n_u32(s0, vld1_u32(tmpb), x);
+      s1   = vmlal_n_u32(s1, vld1_u32(tmpb + 2), x);
+      s2   = vmlal_n_u32(s2, vld1_u32(tmpb + 4), x);
+      s3   = vmlal_n_u32(s3, vld1_u32(tmpb + 6), x);
+    }
+    vst1q_u64(col, s0);
+    vst1q_u64(col + 2, s1);
+    vst1q_u64(col + 4, s2);
+    vst1q_u64(col + 6, s3);
+    _W = s_mp_comba_carry(col, ix, hi, _W, W);
+  }
+}
+
+static int s_mp_comba_lookup(void)
+{
+  return 1;
+}
+#endif
+
+/* digits lo up to hi of a*b into W [the carry into lo taken as zero, as
+ * fast_s_mp_mul_high_digs does], or AWS_MP_VAL for the scalar loops to do it
+ *
+ * The caller has checked that a column of the product fits an aws_mp_word.
+ */
+int aws_s_mp_comba_simd(aws_mp_int *a, aws_mp_int *b, int lo, int hi, aws_mp_digit *W)
+{
+  if (AWS_MIN(a->used, b->used) < AWS_MP_SIMD_CUTOFF || b->used > AWS_MP_WARRAY) {
+    return AWS_MP_VAL;
+  }
+  if (s_mp_comba_unit < 0) {
+    s_mp_comba_unit = s_mp_comba_lookup();
+  }
+  if (s_mp_comba_unit == 0) {
+    return AWS_MP_VAL;
+  }
+  s_mp_comba_cols(a->dp, a->used, b->dp, b->used, lo, hi, W);
+  return AWS_MP_OKAY;
+}
+#endif
+#endif
+
 #ifdef AWS_BN_FAST_S_MP_MUL_DIGS_C
 
 /* Fast (comba) multiplier
@@ -5249,7 +8109,7 @@ const char *aws_mp_s_rmap = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmno
 int aws_fast_s_mp_mul_digs(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int digs)
 {
   int     olduse, res, pa, ix, iz;
-	aws_mp_digit W[AWS_MP_WARRAY] = {};
+  aws_mp_digit W[AWS_MP_WARRAY];
   register aws_mp_word  _W;
 
   /* grow the destination as required */
@@ -5264,7 +8124,14 @@ int aws_fast_s_mp_mul_digs(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int digs
 
   /* clear the carry */
   _W = 0;
-  for (ix = 0; ix < pa; ix++) { 
+  ix = 0;
+#ifdef AWS_MP_COMBA_SIMD
+  /* all the columns on the vector unit if there is one */
+  if (aws_s_mp_comba_simd(a, b, 0, pa, W) == AWS_MP_OKAY) {
+    ix = pa;
+  }
+#endif
+  for (; ix < pa; ix++) { 
       int      tx, ty;
       int      iy;
       aws_mp_digit *tmpx, *tmpy;
@@ -5302,7 +8169,7 @@ int aws_fast_s_mp_mul_digs(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int digs
   {
     register aws_mp_digit *tmpc;
     tmpc = c->dp;
-    for (ix = 0; ix < pa+1; ix++) {
+    for (ix = 0; ix < pa; ix++) {
       /* now extract the previous digit [below the carry] */
       *tmpc++ = W[ix];
     }
@@ -5345,7 +8212,13 @@ int aws_fast_s_mp_mul_high_digs(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int
   /* number of output digits to produce */
   pa = a->used + b->used;
   _W = 0;
-  for (ix = digs; ix < pa; ix++) { 
+  ix = digs;
+#ifdef AWS_MP_COMBA_SIMD
+  if (aws_s_mp_comba_simd(a, b, digs, pa, W) == AWS_MP_OKAY) {
+    ix = pa;
+  }
+#endif
+  for (; ix < pa; ix++) { 
       int      tx, ty, iy;
       aws_mp_digit *tmpx, *tmpy;
 
@@ -5551,7 +8424,13 @@ int aws_fast_s_mp_sqr(aws_mp_int *a, aws_mp_int *b)
 
   /* number of output digits to produce */
   W1 = 0;
-  for (ix = 0; ix < pa; ix++) { 
+  ix = 0;
+#ifdef AWS_MP_COMBA_SIMD
+  if (aws_s_mp_comba_simd(a, a, 0, pa, W) == AWS_MP_OKAY) {
+    ix = pa;
+  }
+#endif
+  for (; ix < pa; ix++) { 
       int      tx, ty, iy;
       aws_mp_word  _W;
       aws_mp_digit *tmpy;
@@ -5630,6 +8509,34 @@ int aws_mp_shrink(aws_mp_int *a)
   if(a->used > 0)
     used = a->used;
   
+#ifdef AWS_BN_MP_SCRATCH_C
+  /* scratch digits are given back with their scope */
+  if (aws_mp_scratch_owns(a->dp) == AWS_MP_YES) {
+    return AWS_MP_OKAY;
+  }
+#endif
+
+#ifdef AWS_MP_INLINE_DIGS
+  if (a->dp == a->inl) {
+    return AWS_MP_OKAY;
+  }
+
+  /* move back into the inline digits when they are large enough */
+  if (used <= AWS_MP_INLINE_DIGS) {
+    int i;
+    for (i = 0; i < used; i++) {
+      a->inl[i] = a->dp[i];
+    }
+    for (; i < AWS_MP_INLINE_DIGS; i++) {
+      a->inl[i] = 0;
+    }
+    AWS_XFREE(a->dp);
+    a->dp    = a->inl;
+    a->alloc = AWS_MP_INLINE_DIGS;
+    return AWS_MP_OKAY;
+  }
+#endif
+
   if (a->alloc != used) {
     if ((tmp = AWS_OPT_CAST(aws_mp_digit) AWS_XREALLOC (a->dp, sizeof (aws_mp_digit) * used)) == NULL) {
       return AWS_MP_MEM;
@@ -5772,6 +8679,46 @@ int aws_mp_toradix_n(aws_mp_int *a, char *str, int radix, int maxlen)
      return AWS_MP_OKAY;
   }
 
+  /* power of two radices are sliced straight out of the digits, keeping the
+   * least significant characters that fit like the loop below
+   */
+  if (aws_s_mp_radix_pow2(radix) != 0) {
+    if (a->sign == AWS_MP_NEG) {
+      *str++ = '-';
+      --maxlen;
+    }
+      aws_s_mp_toradix_pow2(a, str, radix, maxlen - 1);
+    return AWS_MP_OKAY;
+  }
+
+  /* large numbers are converted whole and the tail that fits is kept */
+  if (a->used > AWS_MP_RADIX_DC_CUTOFF) {
+    char *buf;
+    int   y;
+
+    buf = AWS_OPT_CAST(char) AWS_XMALLOC (aws_mp_count_bits(a) + 1);
+    if (buf == NULL) {
+      return AWS_MP_MEM;
+    }
+    if ((res = aws_s_mp_toradix_dc(a, buf, radix, &digs)) != AWS_MP_OKAY) {
+      AWS_XFREE(buf);
+      return res;
+    }
+    if (a->sign == AWS_MP_NEG) {
+      *str++ = '-';
+      --maxlen;
+    }
+    /* keep the least significant characters like the loop below */
+    y = (maxlen > 1) ? maxlen - 1 : 0;
+    if (y > digs) {
+      y = digs;
+    }
+    memcpy(str, buf + digs - y, (size_t)y);
+    str[y] = '\0';
+    AWS_XFREE(buf);
+    return AWS_MP_OKAY;
+  }
+
   if ((res = aws_mp_init_copy(&t, a)) != AWS_MP_OKAY) {
     return res;
   }
@@ -5990,6 +8937,256 @@ int aws_mp_reduce_setup(aws_mp_int *a, aws_mp_int *b)
 }
 #endif
 
+#ifdef AWS_BN_S_MP_GCD_LEHMER_C
+
+/* Lehmer's extended GCD [Knuth 4.5.2, Algorithm L]
+ *
+ * Euclid's quotients are run on the leading AWS_MP_LEHMER_BITS bits of u and
+ * v in a signed double-word, with bounds that say how far they can be off,
+ * for as long as both bounds agree on each quotient.  The 2x2 matrix of the
+ * steps taken is then applied to the full numbers in one pass, which stands
+ * in for up to a digit's worth of quotients.  When not even one step can be
+ * trusted a multiprecision division step is taken instead.
+ *
+ * The cofactors of a alternate in sign along Euclid's sequence, so only their
+ * magnitudes are kept [and added] and the sign follows from the step count.
+ */
+
+#if defined(AWS_MP_64BIT)
+   #ifdef __SIZEOF_INT128__
+      typedef __int128  s_mp_sword;
+   #else
+      typedef long      s_mp_sword __attribute__ ((mode(TI)));
+   #endif
+#else
+   typedef long64       s_mp_sword;
+#endif
+
+/* bits of u, v the single precision steps look at, the rest of the signed double-word is headroom */
+#define AWS_MP_LEHMER_BITS (2 * AWS_DIGIT_BIT - 4)
+
+/* bits [s, s + AWS_MP_LEHMER_BITS) of a */
+static s_mp_sword s_mp_lehmer_top(aws_mp_int *a, int s)
+{
+  aws_mp_word r;
+  int         ix, pos;
+
+  r = 0;
+  for (ix = a->used - 1; ix >= 0 && (ix + 1) * AWS_DIGIT_BIT > s; ix--) {
+    pos = ix * AWS_DIGIT_BIT;
+    if (pos >= s) {
+      r |= ((aws_mp_word)a->dp[ix]) << (pos - s);
+    } else {
+      r |= ((aws_mp_word)a->dp[ix]) >> (s - pos);
+    }
+  }
+  return (s_mp_sword)r;
+}
+
+/* n / d for n >= 0, d > 0 */
+static s_mp_sword s_mp_lehmer_quo(s_mp_sword n, s_mp_sword d)
+{
+  s_mp_sword q;
+
+  /* most quotients are tiny [Gauss-Kuzmin], a few subtractions beat a double-word division */
+  for (q = 0; n >= d; q++) {
+    if (q == 3) {
+      return q + n / d;
+    }
+    n -= d;
+  }
+  return q;
+}
+
+/* r = mx*x - my*y [mod B**n when add is 0] or mx*x + my*y, for x, y >= 0 */
+static int s_mp_lehmer_comb(aws_mp_int *x, aws_mp_digit mx, aws_mp_int *y, aws_mp_digit my, int add, aws_mp_int *r)
+{
+  aws_mp_word  px, py;
+  aws_mp_digit cx, cy, c, d, dx, dy;
+  int          ix, n, olduse, err;
+
+  n = AWS_MAX(x->used, y->used);
+  if (r->alloc < n + 1) {
+    if ((err = aws_mp_grow(r, n + 1)) != AWS_MP_OKAY) {
+      return err;
+    }
+  }
+  olduse = r->used;
+
+  cx = cy = c = 0;
+  for (ix = 0; ix < n; ix++) {
+    dx = (ix < x->used) ? x->dp[ix] : 0;
+    dy = (ix < y->used) ? y->dp[ix] : 0;
+    px = ((aws_mp_word)dx) * ((aws_mp_word)mx) + ((aws_mp_word)cx);
+    py = ((aws_mp_word)dy) * ((aws_mp_word)my) + ((aws_mp_word)cy);
+    cx = (aws_mp_digit)(px >> ((aws_mp_word)AWS_DIGIT_BIT));
+    cy = (aws_mp_digit)(py >> ((aws_mp_word)AWS_DIGIT_BIT));
+    dx = (aws_mp_digit)(px & ((aws_mp_word)AWS_MP_MASK));
+    dy = (aws_mp_digit)(py & ((aws_mp_word)AWS_MP_MASK));
+    if (add != 0) {
+      /* c is the carry */
+      d = dx + dy + c;
+      c = d >> ((aws_mp_digit)AWS_DIGIT_BIT);
+    } else {
+      /* c is the borrow */
+      d = dx - dy - c;
+      c = d >> ((aws_mp_digit)(CHAR_BIT * sizeof(aws_mp_digit) - 1));
+    }
+    r->dp[ix] = d & AWS_MP_MASK;
+  }
+  if (add != 0) {
+    r->dp[n] = cx + cy + c;
+  } else {
+    r->dp[n] = (cx - cy - c) & AWS_MP_MASK;
+  }
+
+  for (ix = n + 1; ix < olduse; ix++) {
+    r->dp[ix] = 0;
+  }
+  r->used = n + 1;
+  r->sign = AWS_MP_ZPOS;
+    aws_mp_clamp(r);
+  return AWS_MP_OKAY;
+}
+
+/* g = gcd(|a|, |b|) and, if U isn't NULL, U with U*|a| + V*|b| = g for some V
+ *
+ * U is the cofactor Euclid's algorithm ends with, so |U| <= |b|/(2g).
+ */
+int aws_s_mp_gcd_lehmer(aws_mp_int *a, aws_mp_int *b, aws_mp_int *g, aws_mp_int *U)
+{
+  aws_mp_int  u, v, x, y, s, t, q;
+  s_mp_sword  uh, vh, A, B, C, D, T, W, qq, n1, n2, d1, d2, mask;
+  int         err, shift, k, neg;
+
+  mask = (s_mp_sword)AWS_MP_MASK;
+
+  aws_mp_scratch_begin();
+  if ((err = aws_mp_init_multi_scratch(AWS_MAX(a->used, b->used) + 2, &u, &v, &x, &y, &s, &t, &q, NULL)) != AWS_MP_OKAY) {
+    aws_mp_scratch_end();
+    return err;
+  }
+
+  /* u >= v, as if a first step with a zero quotient had been taken when |a| < |b| */
+  neg = (aws_mp_cmp_mag(a, b) == AWS_MP_LT) ? 1 : 0;
+  if ((err = aws_mp_abs(neg ? b : a, &u)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+  if ((err = aws_mp_abs(neg ? a : b, &v)) != AWS_MP_OKAY) {
+    goto LBL_ERR;
+  }
+  /* x and y are the cofactors of a for u and v */
+  aws_mp_set(neg ? &y : &x, 1);
+
+  while (aws_mp_iszero(&v) == AWS_MP_NO) {
+    shift = AWS_MAX(aws_mp_count_bits(&u) - AWS_MP_LEHMER_BITS, 0);
+    uh = s_mp_lehmer_top(&u, shift);
+    vh = s_mp_lehmer_top(&v, shift);
+
+    /* after k steps the signs of A, B, C, D are +-, -+, -+, +- [k even, odd] */
+    A = D = 1;
+    B = C = 0;
+    k = 0;
+    for (;;) {
+      if (k == 0) {
+        n1 = uh + A; d1 = vh - C;
+        n2 = uh - B; d2 = vh + D;
+      } else {
+        n1 = uh - A; d1 = vh + C;
+        n2 = uh + B; d2 = vh - D;
+      }
+      if (n1 < 0 || n2 < 0 || d1 <= 0 || d2 <= 0) {
+        break;
+      }
+      qq = s_mp_lehmer_quo(n1, d1);
+      if (qq != s_mp_lehmer_quo(n2, d2) || qq > mask) {
+        break;
+      }
+
+      /* the cofactors have to stay single digits */
+      T = A + qq * C;
+      W = B + qq * D;
+      if (T > mask || W > mask) {
+        break;
+      }
+      A = C; C = T;
+      B = D; D = W;
+
+      T  = uh - qq * vh;
+      uh = vh;
+      vh = T;
+      k ^= 1;
+    }
+
+    if (B == 0) {
+      /* not even the first quotient is known, (u, v) = (v, u mod v) */
+      if ((err = aws_mp_div(&u, &v, &q, &s)) != AWS_MP_OKAY) {
+        goto LBL_ERR;
+      }
+        aws_mp_exch(&u, &v);
+        aws_mp_exch(&v, &s);
+      if (U != NULL) {
+        if ((err = aws_mp_mul(&q, &y, &t)) != AWS_MP_OKAY) {
+          goto LBL_ERR;
+        }
+        if ((err = aws_mp_add(&t, &x, &t)) != AWS_MP_OKAY) {
+          goto LBL_ERR;
+        }
+          aws_mp_exch(&x, &y);
+          aws_mp_exch(&y, &t);
+      }
+      neg ^= 1;
+      continue;
+    }
+
+    /* (u, v) = (A*u + B*v, C*u + D*v), both come out >= 0 */
+    if (k == 0) {
+      err = s_mp_lehmer_comb(&u, (aws_mp_digit)A, &v, (aws_mp_digit)B, 0, &s);
+      if (err == AWS_MP_OKAY) {
+        err = s_mp_lehmer_comb(&v, (aws_mp_digit)D, &u, (aws_mp_digit)C, 0, &t);
+      }
+    } else {
+      err = s_mp_lehmer_comb(&v, (aws_mp_digit)B, &u, (aws_mp_digit)A, 0, &s);
+      if (err == AWS_MP_OKAY) {
+        err = s_mp_lehmer_comb(&u, (aws_mp_digit)C, &v, (aws_mp_digit)D, 0, &t);
+      }
+    }
+    if (err != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+      aws_mp_exch(&u, &s);
+      aws_mp_exch(&v, &t);
+
+    if (U != NULL) {
+      if ((err = s_mp_lehmer_comb(&x, (aws_mp_digit)A, &y, (aws_mp_digit)B, 1, &s)) != AWS_MP_OKAY) {
+        goto LBL_ERR;
+      }
+      if ((err = s_mp_lehmer_comb(&x, (aws_mp_digit)C, &y, (aws_mp_digit)D, 1, &t)) != AWS_MP_OKAY) {
+        goto LBL_ERR;
+      }
+        aws_mp_exch(&x, &s);
+        aws_mp_exch(&y, &t);
+    }
+    neg ^= k;
+  }
+
+  if (U != NULL) {
+    if (neg != 0 && aws_mp_iszero(&x) == AWS_MP_NO) {
+      x.sign = AWS_MP_NEG;
+    }
+    if ((err = aws_mp_copy(&x, U)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+  }
+  err = aws_mp_copy(&u, g);
+
+LBL_ERR:
+aws_mp_clear_multi(&u, &v, &x, &y, &s, &t, &q, NULL);
+  aws_mp_scratch_end();
+  return err;
+}
+#endif
+
 #ifdef AWS_BN_MP_GCD_C
 
 /* Greatest Common Divisor using the binary method */
@@ -6006,6 +9203,13 @@ int aws_mp_gcd(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
     return aws_mp_abs(a, c);
   }
 
+#ifdef AWS_BN_S_MP_GCD_LEHMER_C
+  /* Lehmer's method takes a digit's worth of quotients per pass over u and v */
+  if (AWS_MIN(a->used, b->used) >= AWS_MP_LEHMER_CUTOFF) {
+    return aws_s_mp_gcd_lehmer(a, b, c, NULL);
+  }
+#endif
+
   /* get copies of a and b we can modify */
   if ((res = aws_mp_init_copy(&u, a)) != AWS_MP_OKAY) {
     return res;
@@ -6150,6 +9354,330 @@ aws_s_mp_sub(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
 
 #endif
 
+#ifdef AWS_BN_S_MP_NTT_C
+
+/* Multiplication by number theoretic transforms
+ *
+ * The operands are cut into coefficients of AWS_MP_NTT_DIGS digits [at most 60
+ * bits] and their convolution is taken modulo three primes k*2**40 + 1 just
+ * below 2**62, with transforms of the first power of two the product fits.  A
+ * column of the product is below n*2**120 and the primes multiply to 2**186,
+ * so Garner's form of the Chinese remainder theorem gets every column back
+ * exactly, and the columns are then carried into digits as the comba routines
+ * do.  The arithmetic mod p is Montgomery's on 64-bit words [R = 2**64], the
+ * same for every digit size.
+ *
+ * The forward transforms decimate in frequency and leave the points in bit
+ * reversed order, the inverse decimates in time and takes them that way, so
+ * nothing is ever permuted.  A square transforms its operand once per prime.
+ *
+ * That is O(n log n), but nine transforms of twice the operand size only beat
+ * Toom-Cook on thousands of digits, see AWS_MP_NTT_MUL_DEFAULT.
+ */
+
+/* digits per coefficient and the longest transform, as a power of two */
+#define AWS_MP_NTT_DIGS     ((60 / AWS_DIGIT_BIT) > 0 ? (60 / AWS_DIGIT_BIT) : 1)
+#define AWS_MP_NTT_MAX_LOG  30
+
+typedef struct {
+   ulong64 p,       /* the prime */
+           pinv,    /* -p**-1 mod 2**64 */
+           r2,      /* R**2 mod p */
+           root,    /* a root of unity of order 2**AWS_MP_NTT_MAX_LOG, times R */
+           iroot;   /* its inverse, times R */
+} s_mp_ntt_prime;
+
+static const s_mp_ntt_prime s_mp_ntt_primes[3] = {
+   { 0x3FFFC00000000001ULL, 0x3FFFBFFFFFFFFFFFULL, 0x3FF8BFFBFFFC000DULL, 0x1156C291A43FC8AAULL, 0x17A5AFC97CA65CE9ULL },
+   { 0x3FFFBE0000000001ULL, 0x3FFFBDFFFFFFFFFFULL, 0x2180D7FBBEFB9D04ULL, 0x3A1865AFB005CF6DULL, 0x1AC479774F6588E6ULL },
+   { 0x3FFF840000000001ULL, 0x3FFF83FFFFFFFFFFULL, 0x178C9FF0FBE2E818ULL, 0x1335535B9A26DC09ULL, 0x228382B8FE56F528ULL }
+};
+
+/* Garner's constants, times R: p1**-1 mod p2, p1 mod p3 and (p1*p2)**-1 mod p3 */
+#define AWS_MP_NTT_INV12  0x0000000000800000ULL
+#define AWS_MP_NTT_P1_3   0x346637FE2EFC7B0AULL
+#define AWS_MP_NTT_INV123 0x11A797276E1611A8ULL
+
+/* the high word of a*b, the low one goes to *lo */
+static ulong64 s_mp_ntt_mul64(ulong64 a, ulong64 b, ulong64 *lo)
+{
+#ifdef __SIZEOF_INT128__
+  __uint128_t t = (__uint128_t)a * b;
+
+  *lo = (ulong64)t;
+  return (ulong64)(t >> 64);
+#else
+  ulong64 a0 = a & 0xFFFFFFFFULL, a1 = a >> 32, b0 = b & 0xFFFFFFFFULL, b1 = b >> 32;
+  ulong64 m0 = a0 * b0, m1 = a0 * b1, m2 = a1 * b0, mid;
+
+  mid = (m0 >> 32) + (m1 & 0xFFFFFFFFULL) + (m2 & 0xFFFFFFFFULL);
+  *lo = (mid << 32) | (m0 & 0xFFFFFFFFULL);
+  return a1 * b1 + (m1 >> 32) + (m2 >> 32) + (mid >> 32);
+#endif
+}
+
+/* abR**-1 mod p */
+static ulong64 s_mp_ntt_mul(ulong64 a, ulong64 b, const s_mp_ntt_prime *q)
+{
+  ulong64 tlo, thi, mlo, mhi, r;
+
+  thi = s_mp_ntt_mul64(a, b, &tlo);
+  mhi = s_mp_ntt_mul64(tlo * q->pinv, q->p, &mlo);
+
+  /* tlo + mlo is 0 mod 2**64, with a carry unless both are 0 */
+  r = thi + mhi + (tlo != 0);
+  return (r >= q->p) ? r - q->p : r;
+}
+
+static ulong64 s_mp_ntt_sub(ulong64 a, ulong64 b, ulong64 p)
+{
+  return (a >= b) ? a - b : a + p - b;
+}
+
+/* x mod p for x < 4p */
+static ulong64 s_mp_ntt_low(ulong64 x, ulong64 p)
+{
+  x = (x >= 2 * p) ? x - 2 * p : x;
+  return (x >= p) ? x - p : x;
+}
+
+/* xw mod p, in [0, 2p), for any x < 2**64 and ws = floor(w*2**64/p) [Shoup's] */
+static ulong64 s_mp_ntt_mulw(ulong64 x, ulong64 w, ulong64 ws, ulong64 p)
+{
+  ulong64 lo, qt;
+
+  qt = s_mp_ntt_mul64(x, ws, &lo);
+  return x * w - qt * p;
+}
+
+/* w[2(len + j)] = r**j and w[2(len + j) + 1] its Shoup constant for every level
+ * len < n, r of order 2*len
+ *
+ * With wR the power in Montgomery form, w*2**64 = ws*p + wR, so ws is just
+ * -wR/p mod 2**64, that is wR*pinv, and no division is needed.
+ */
+static void s_mp_ntt_roots(ulong64 *w, int n, ulong64 root, const s_mp_ntt_prime *q)
+{
+  int     len, j;
+  ulong64 one = s_mp_ntt_mul(1, q->r2, q), wr;
+
+  /* root is of order 2**AWS_MP_NTT_MAX_LOG, square it down to order n */
+  for (len = 1 << (AWS_MP_NTT_MAX_LOG - 1); len >= n; len >>= 1) {
+    root = s_mp_ntt_mul(root, root, q);
+  }
+  for (len = n >> 1; len > 0; len >>= 1) {
+    wr = one;
+    for (j = 0; j < len; j++) {
+      w[2 * (len + j)]     = s_mp_ntt_mul(wr, 1, q);
+      w[2 * (len + j) + 1] = wr * q->pinv;
+      wr = s_mp_ntt_mul(wr, root, q);
+    }
+    root = s_mp_ntt_mul(root, root, q);
+  }
+}
+
+/* forward transform, natural order in, bit reversed order out, all in [0, 2p) */
+static void s_mp_ntt_forward(ulong64 *x, int n, const ulong64 *w, ulong64 p)
+{
+  int           len, s, j;
+  ulong64       u, v, t, p2 = 2 * p;
+  const ulong64 *tw;
+
+  for (len = n >> 1; len > 0; len >>= 1) {
+    for (s = 0; s < n; s += 2 * len) {
+      tw = w + 2 * len;
+      for (j = 0; j < len; j++) {
+        u = x[s + j];
+        v = x[s + j + len];
+        t = u + v;
+        x[s + j]       = (t >= p2) ? t - p2 : t;
+        x[s + j + len] = s_mp_ntt_mulw(u - v + p2, tw[2 * j], tw[2 * j + 1], p);
+      }
+    }
+  }
+}
+
+/* inverse transform without the 1/n, bit reversed order in [0, 2p), natural
+ * order out in [0, 4p)
+ */
+static void s_mp_ntt_inverse(ulong64 *x, int n, const ulong64 *w, ulong64 p)
+{
+  int           len, s, j;
+  ulong64       u, v, p2 = 2 * p;
+  const ulong64 *tw;
+
+  for (len = 1; len < n; len <<= 1) {
+    for (s = 0; s < n; s += 2 * len) {
+      tw = w + 2 * len;
+      for (j = 0; j < len; j++) {
+        u = x[s + j];
+        u = (u >= p2) ? u - p2 : u;
+        v = s_mp_ntt_mulw(x[s + j + len], tw[2 * j], tw[2 * j + 1], p);
+        x[s + j]       = u + v;
+        x[s + j + len] = u - v + p2;
+      }
+    }
+  }
+}
+
+/* the coefficients of a, AWS_MP_NTT_DIGS digits each, padded with zeros to n */
+static void s_mp_ntt_load(ulong64 *x, int n, aws_mp_int *a)
+{
+  int ix;
+
+  for (ix = 0; ix < n; ix++) {
+    x[ix] = 0;
+  }
+  for (ix = 0; ix < a->used; ix++) {
+    x[ix / AWS_MP_NTT_DIGS] |= ((ulong64)a->dp[ix]) << ((ix % AWS_MP_NTT_DIGS) * AWS_DIGIT_BIT);
+  }
+}
+
+/* c = a*b [a*a when b is NULL] by transforms, AWS_MP_VAL if the product needs
+ * more than 2**AWS_MP_NTT_MAX_LOG coefficients
+ */
+int aws_s_mp_ntt(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
+{
+  const s_mp_ntt_prime *q;
+  ulong64  *X[3], *B, *W, *WI, nscale, r1, r2, r3, t2, t3, x0, x1, x2, y0, y1, lo, acc[4];
+  int       na, nb, nc, n, ix, iy, olduse, pa, bits, res;
+
+  na = (a->used + AWS_MP_NTT_DIGS - 1) / AWS_MP_NTT_DIGS;
+  nb = (b == NULL) ? na : (b->used + AWS_MP_NTT_DIGS - 1) / AWS_MP_NTT_DIGS;
+  if (na == 0 || nb == 0) {
+    aws_mp_zero(c);
+    return AWS_MP_OKAY;
+  }
+  nc = na + nb - 1;
+  if (nc > (1 << AWS_MP_NTT_MAX_LOG)) {
+    return AWS_MP_VAL;
+  }
+  for (n = 1; n < nc; n <<= 1);
+  if ((size_t)n > ((size_t)-1) / (8 * sizeof(ulong64))) {
+    return AWS_MP_MEM;
+  }
+
+  /* three residues of the product, the other operand and the two root tables */
+  X[0] = AWS_OPT_CAST(ulong64) AWS_XMALLOC(sizeof(ulong64) * (size_t)n * 8);
+  if (X[0] == NULL) {
+    return AWS_MP_MEM;
+  }
+  X[1] = X[0] + n;
+  X[2] = X[1] + n;
+  B    = X[2] + n;
+  W    = B + n;
+  WI   = W + 2 * n;
+
+  for (ix = 0; ix < 3; ix++) {
+    q = &s_mp_ntt_primes[ix];
+    s_mp_ntt_roots(W, n, q->root, q);
+    s_mp_ntt_roots(WI, n, q->iroot, q);
+
+    /* 1/n = -(p-1)/n, times R**2 to undo the Montgomery factor of the product too */
+    nscale = s_mp_ntt_mul(s_mp_ntt_mul(q->p - (q->p - 1) / (ulong64)n, q->r2, q), q->r2, q);
+
+    s_mp_ntt_load(X[ix], n, a);
+    s_mp_ntt_forward(X[ix], n, W, q->p);
+    if (b == NULL) {
+      for (iy = 0; iy < n; iy++) {
+        X[ix][iy] = s_mp_ntt_mul(s_mp_ntt_mul(X[ix][iy], X[ix][iy], q), nscale, q);
+      }
+    } else {
+      s_mp_ntt_load(B, n, b);
+      s_mp_ntt_forward(B, n, W, q->p);
+      for (iy = 0; iy < n; iy++) {
+        X[ix][iy] = s_mp_ntt_mul(s_mp_ntt_mul(X[ix][iy], B[iy], q), nscale, q);
+      }
+    }
+    s_mp_ntt_inverse(X[ix], n, WI, q->p);
+  }
+
+  /* a and b are no longer read, c may be either */
+  bits = AWS_MP_NTT_DIGS * AWS_DIGIT_BIT;
+  pa   = (nc + 1) * AWS_MP_NTT_DIGS;
+  if (c->alloc < pa) {
+    if ((res = aws_mp_grow(c, pa)) != AWS_MP_OKAY) {
+      AWS_XFREE(X[0]);
+      return res;
+    }
+  }
+
+  acc[0] = acc[1] = acc[2] = acc[3] = 0;
+  for (ix = 0; ix <= nc; ix++) {
+    if (ix < nc) {
+      /* x = r1 + p1*(t2 + p2*t3) with t2 < p2 and t3 < p3 */
+      r1 = s_mp_ntt_low(X[0][ix], s_mp_ntt_primes[0].p);
+      r2 = s_mp_ntt_low(X[1][ix], s_mp_ntt_primes[1].p);
+      r3 = s_mp_ntt_low(X[2][ix], s_mp_ntt_primes[2].p);
+      t2 = s_mp_ntt_mul(s_mp_ntt_sub(r2, (r1 >= s_mp_ntt_primes[1].p) ? r1 - s_mp_ntt_primes[1].p : r1,
+                                     s_mp_ntt_primes[1].p), AWS_MP_NTT_INV12, &s_mp_ntt_primes[1]);
+      t3 = s_mp_ntt_sub(r3, (r1 >= s_mp_ntt_primes[2].p) ? r1 - s_mp_ntt_primes[2].p : r1, s_mp_ntt_primes[2].p);
+      t3 = s_mp_ntt_sub(t3, s_mp_ntt_mul((t2 >= s_mp_ntt_primes[2].p) ? t2 - s_mp_ntt_primes[2].p : t2,
+                                         AWS_MP_NTT_P1_3, &s_mp_ntt_primes[2]), s_mp_ntt_primes[2].p);
+      t3 = s_mp_ntt_mul(t3, AWS_MP_NTT_INV123, &s_mp_ntt_primes[2]);
+
+      y1 = s_mp_ntt_mul64(t3, s_mp_ntt_primes[1].p, &y0);
+      y0 += t2;
+      y1 += (y0 < t2);
+      x1 = s_mp_ntt_mul64(y0, s_mp_ntt_primes[0].p, &x0);
+      x2 = s_mp_ntt_mul64(y1, s_mp_ntt_primes[0].p, &lo);
+      x1 += lo;
+      x2 += (x1 < lo);
+      x0 += r1;
+      x1 += (x0 < r1);
+      x2 += (x1 == 0 && x0 < r1);
+
+      /* acc += x */
+      acc[0] += x0;
+      x1 += (acc[0] < x0);
+      x2 += (x1 == 0 && acc[0] < x0);
+      acc[1] += x1;
+      x2 += (acc[1] < x1);
+      acc[2] += x2;
+      acc[3] += (acc[2] < x2);
+    }
+
+    /* the low coefficient's worth of the columns are digits now */
+    for (iy = 0; iy < AWS_MP_NTT_DIGS; iy++) {
+      c->dp[ix * AWS_MP_NTT_DIGS + iy] = ((aws_mp_digit)(acc[0] >> (iy * AWS_DIGIT_BIT))) & AWS_MP_MASK;
+    }
+    acc[0] = (acc[0] >> bits) | (acc[1] << (64 - bits));
+    acc[1] = (acc[1] >> bits) | (acc[2] << (64 - bits));
+    acc[2] = (acc[2] >> bits) | (acc[3] << (64 - bits));
+    acc[3] >>= bits;
+  }
+
+  AWS_XFREE(X[0]);
+
+  olduse  = c->used;
+  c->used = pa;
+  for (ix = pa; ix < olduse; ix++) {
+    c->dp[ix] = 0;
+  }
+  c->sign = AWS_MP_ZPOS;
+  aws_mp_clamp(c);
+  return AWS_MP_OKAY;
+}
+#endif
+
+#ifdef AWS_BN_MP_NTT_MUL_C
+
+/* multiplication by number theoretic transforms, see aws_s_mp_ntt */
+int aws_mp_ntt_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
+{
+  return aws_s_mp_ntt(a, b, c);
+}
+#endif
+
+#ifdef AWS_BN_MP_NTT_SQR_C
+
+/* squaring by number theoretic transforms, see aws_s_mp_ntt */
+int aws_mp_ntt_sqr(aws_mp_int *a, aws_mp_int *b)
+{
+  return aws_s_mp_ntt(a, NULL, b);
+}
+#endif
+
 #ifdef AWS_BN_MP_TOOM_MUL_C
 
 /* multiplication using the Toom-Cook 3-way algorithm 
@@ -6164,10 +9692,19 @@ int aws_mp_toom_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
     aws_mp_int w0, w1, w2, w3, w4, tmp1, tmp2, a0, a1, a2, b0, b1, b2;
     int res, B;
         
-    /* init temps */
-    if ((res = aws_mp_init_multi(&w0, &w1, &w2, &w3, &w4,
-            &a0, &a1, &a2, &b0, &b1,
-            &b2, &tmp1, &tmp2, NULL)) != AWS_MP_OKAY) {
+    /* init temps from the scratch arena, the w's and tmp1 are shifted up to
+     * the size of the product, the pieces of a and b stay below the larger input
+     */
+    aws_mp_scratch_begin();
+    if ((res = aws_mp_init_multi_scratch(a->used + b->used, &w0, &w1, &w2, &w3, &w4,
+            &tmp1, NULL)) != AWS_MP_OKAY) {
+       aws_mp_scratch_end();
+       return res;
+    }
+    if ((res = aws_mp_init_multi_scratch(AWS_MAX(a->used, b->used) + 2,
+            &a0, &a1, &a2, &b0, &b1, &b2, &tmp2, NULL)) != AWS_MP_OKAY) {
+       aws_mp_clear_multi(&w0, &w1, &w2, &w3, &w4, &tmp1, NULL);
+       aws_mp_scratch_end();
        return res;
     }
     
@@ -6411,6 +9948,7 @@ ERR:
 aws_mp_clear_multi(&w0, &w1, &w2, &w3, &w4,
         &a0, &a1, &a2, &b0, &b1,
         &b2, &tmp1, &tmp2, NULL);
+     aws_mp_scratch_end();
      return res;
 }     
      
@@ -6440,7 +9978,7 @@ int aws_mp_init_set_int(aws_mp_int *a, unsigned long b)
 int aws_fast_mp_invmod(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
 {
   aws_mp_int x, y, u, v, B, D;
-  int     res, neg;
+  int     res;
 
   /* 2. [modified] b must be odd   */
   if (aws_mp_iseven (b) == 1) {
@@ -6462,6 +10000,12 @@ int aws_fast_mp_invmod(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
     goto LBL_ERR;
   }
 
+  /* a multiple of b has no inverse [and would never let v go odd below] */
+  if (aws_mp_iszero(&y) == 1) {
+    res = AWS_MP_VAL;
+    goto LBL_ERR;
+  }
+
   /* 3. u=x, v=y, A=1, B=0, C=0,D=1 */
   if ((res = aws_mp_copy(&x, &u)) != AWS_MP_OKAY) {
     goto LBL_ERR;
@@ -6543,15 +10087,13 @@ top:
     goto LBL_ERR;
   }
 
-  /* b is now the inverse */
-  neg = a->sign;
+  /* D is now the inverse of y = a mod b, which is the one of a */
   while (D.sign == AWS_MP_NEG) {
     if ((res = aws_mp_add(&D, b, &D)) != AWS_MP_OKAY) {
       goto LBL_ERR;
     }
   }
     aws_mp_exch(&D, c);
-  c->sign = neg;
   res = AWS_MP_OKAY;
 
 LBL_ERR:
@@ -6575,6 +10117,21 @@ int aws_mp_to_signed_bin(aws_mp_int *a, unsigned char *b)
 }
 #endif
 
+#ifdef AWS_BN_MP_TO_SIGNED_BIN_STREAM_C
+
+/* the signed format of aws_mp_to_signed_bin handed to cb, see aws_mp_to_unsigned_bin_stream */
+int aws_mp_to_signed_bin_stream(aws_mp_int *a, aws_ltm_bin_callback cb, void *dat)
+{
+  unsigned char sign = (unsigned char) ((a->sign == AWS_MP_ZPOS) ? 0 : 1);
+  int           res;
+
+  if ((res = cb(&sign, 1, dat)) != AWS_MP_OKAY) {
+    return res;
+  }
+  return aws_mp_to_unsigned_bin_stream(a, cb, dat);
+}
+#endif
+
 #ifdef AWS_BN_MP_MOD_C
 
 /* c = a mod b, 0 <= c < b */
@@ -6788,8 +10345,7 @@ aws_mp_rand(aws_mp_int *a, int digits)
 /* read a string [ASCII] in a given radix */
 int aws_mp_read_radix(aws_mp_int *a, const char *str, int radix)
 {
-  int     y, res, neg;
-  char    ch;
+  int     res, neg;
 
   /* zero the digit bignum */
     aws_mp_zero(a);
@@ -6809,37 +10365,18 @@ int aws_mp_read_radix(aws_mp_int *a, const char *str, int radix)
     neg = AWS_MP_ZPOS;
   }
 
-  /* set the integer to the default of zero */
-    aws_mp_zero(a);
-  
-  /* process each digit of the string */
-  while (*str) {
-    /* if the radix < 36 the conversion is case insensitive
-     * this allows numbers like 1AB and 1ab to represent the same  value
-     * [e.g. in hex]
-     */
-    ch = (char) ((radix < 36) ? toupper (*str) : *str);
-    for (y = 0; y < 64; y++) {
-      if (ch == aws_mp_s_rmap[y]) {
-         break;
-      }
-    }
-
-    /* if the char was found in the map 
-     * and is less than the given radix add it
-     * to the number, otherwise exit the loop. 
-     */
-    if (y < radix) {
-      if ((res = aws_mp_mul_d(a, (aws_mp_digit) radix, a)) != AWS_MP_OKAY) {
-         return res;
-      }
-      if ((res = aws_mp_add_d(a, (aws_mp_digit) y, a)) != AWS_MP_OKAY) {
-         return res;
-      }
-    } else {
-      break;
-    }
-    ++str;
+  /* read the leading characters that are valid in the radix, if the
+   * radix < 36 the conversion is case insensitive.  Power of two radices
+   * are packed straight into the digits, the others are joined recursively
+   * by powers of the radix.
+   */
+  if (aws_s_mp_radix_pow2(radix) != 0) {
+    res = aws_s_mp_read_radix_pow2(a, str, radix);
+  } else {
+    res = aws_s_mp_read_radix_dc(a, str, radix);
+  }
+  if (res != AWS_MP_OKAY) {
+    return res;
   }
   
   /* set the sign only if a != 0 */
@@ -160,6 +160,29 @@ typedef NS_ENUM(NSUInteger, AWSDDLogLevel){
     AWSDDLogLevelAll       = NSUIntegerMax
 };
 
+/**
+ *  What an asynchronous log statement does when `AWSDDLOG_MAX_QUEUE_SIZE` messages are already waiting.
+ *  Synchronous log statements always wait for room.
+ */
+typedef NS_ENUM(NSUInteger, AWSDDLogOverflowPolicy){
+    /**
+     *  The issuing thread waits until the logging queue has taken a message (the default)
+     */
+    AWSDDLogOverflowPolicyBlock      = 0,
+
+    /**
+     *  The new message is discarded
+     */
+    AWSDDLogOverflowPolicyDropNewest = 1,
+
+    /**
+     *  The oldest waiting message is discarded to make room for the new one.
+     *  A message a synchronous log statement is waiting for is never discarded:
+     *  when it is the oldest, the new message is discarded instead.
+     */
+    AWSDDLogOverflowPolicyDropOldest = 2
+};
+
 NS_ASSUME_NONNULL_BEGIN
 
 /**
@@ -228,6 +251,22 @@ NSString * __nullable AWSDDExtractFileNameWithoutExtension(const char *filePath,
  **/
 @property (class, nonatomic, DISPATCH_QUEUE_REFERENCE_TYPE, readonly) dispatch_queue_t loggingQueue;
 
+/**
+ * What asynchronous log statements do once the queue of waiting messages is full.
+ * Defaults to `AWSDDLogOverflowPolicyBlock`.
+ **/
+@property (class, atomic, assign) AWSDDLogOverflowPolicy overflowPolicy;
+
+/**
+ * The number of messages discarded by the overflow policy since launch.
+ **/
+@property (class, atomic, readonly) NSUInteger droppedMessageCount;
+
+/**
+ * The number of log statements that had to wait for room in the queue since launch.
+ **/
+@property (class, atomic, readonly) NSUInteger blockedMessageCount;
+
 /**
  * Logging Primitive.
  *
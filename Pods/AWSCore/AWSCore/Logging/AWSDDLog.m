@@ -19,6 +19,7 @@
 #endif
 
 #import "AWSDDLog.h"
+#import "AWSDDLogRing.h"
 
 #import <pthread.h>
 #import <dispatch/dispatch.h>
@@ -27,6 +28,7 @@
 #import <mach/host_info.h>
 #import <libkern/OSAtomic.h>
 #import <Availability.h>
+#import <stdatomic.h>
 #if TARGET_OS_IOS
     #import <UIKit/UIDevice.h>
 #endif
@@ -58,12 +60,20 @@
 //
 // This property caps the queue size at a given number of outstanding log statements.
 // If a thread attempts to issue a log statement when the queue is already maxed out,
-// the issuing thread will block until the queue size drops below the max again.
+// [AWSDDLog overflowPolicy] decides what happens. By default the issuing thread will block
+// until the queue size drops below the max again.
 
 #ifndef AWSDDLOG_MAX_QUEUE_SIZE
     #define AWSDDLOG_MAX_QUEUE_SIZE 1000 // Should not exceed INT32_MAX
 #endif
 
+// The logging queue takes at most this many messages in one go before giving other work
+// (adding a logger, flushing, ...) a turn.
+
+#ifndef AWSDDLOG_DRAIN_BATCH_SIZE
+    #define AWSDDLOG_DRAIN_BATCH_SIZE 64
+#endif
+
 // The "global logging queue" refers to [AWSDDLog loggingQueue].
 // It is the queue that all log statements go through.
 //
@@ -72,6 +82,21 @@
 
 static void *const GlobalLoggingQueueIdentityKey = (void *)&GlobalLoggingQueueIdentityKey;
 
+// Queued log messages wait in a ring of AWSDDLOG_MAX_QUEUE_SIZE slots, see AWSDDLogRing.h.
+// A slot holds the message and the AWSDDLog that queued it, both retained while in the ring.
+
+_Static_assert((int)AWSDDLogOverflowPolicyBlock == (int)AWSDDLogRingOverflowBlock &&
+               (int)AWSDDLogOverflowPolicyDropNewest == (int)AWSDDLogRingOverflowDropNewest &&
+               (int)AWSDDLogOverflowPolicyDropOldest == (int)AWSDDLogRingOverflowDropOldest,
+               "AWSDDLogOverflowPolicy is passed to the ring as is");
+
+static AWSDDLogRing _ring;
+
+static void AWSDDLogRingReleaseMessage(void *message, void *owner) {
+    CFBridgingRelease(message);
+    CFBridgingRelease(owner);
+}
+
 @interface AWSDDLoggerNode : NSObject
 {
     // Direct accessors to be used only for performance
@@ -113,9 +138,11 @@ static dispatch_queue_t _loggingQueue;
 // Each logger has it's own associated queue, and a dispatch group is used for synchrnoization.
 static dispatch_group_t _loggingGroup;
 
-// In order to prevent to queue from growing infinitely large,
-// a maximum size is enforced (AWSDDLOG_MAX_QUEUE_SIZE).
-static dispatch_semaphore_t _queueSemaphore;
+// Set while a drain of the ring is queued or running on the logging queue,
+// so that only a log statement finding the ring idle has to dispatch one.
+static atomic_bool _drainScheduled;
+
+static _Atomic(NSUInteger) _overflowPolicy = AWSDDLogOverflowPolicyBlock;
 
 // Minor optimization for uniprocessor machines
 static NSUInteger _numProcessors;
@@ -157,7 +184,11 @@ static NSUInteger _numProcessors;
         void *nonNullValue = GlobalLoggingQueueIdentityKey; // Whatever, just not null
         dispatch_queue_set_specific(_loggingQueue, GlobalLoggingQueueIdentityKey, nonNullValue, NULL);
         
-        _queueSemaphore = dispatch_semaphore_create(AWSDDLOG_MAX_QUEUE_SIZE);
+        // In order to prevent to queue from growing infinitely large,
+        // a maximum size is enforced (AWSDDLOG_MAX_QUEUE_SIZE).
+        BOOL ringAllocated = AWSDDLogRingInit(&_ring, AWSDDLOG_MAX_QUEUE_SIZE, AWSDDLogRingReleaseMessage);
+        NSCAssert(ringAllocated, @"Failed to allocate the message queue");
+        (void)ringAllocated;
         
         // Figure out how many processors are available.
         // This may be used later for an optimization on uniprocessor machines.
@@ -223,6 +254,22 @@ static NSUInteger _numProcessors;
     return _loggingQueue;
 }
 
++ (AWSDDLogOverflowPolicy)overflowPolicy {
+    return atomic_load_explicit(&_overflowPolicy, memory_order_relaxed);
+}
+
++ (void)setOverflowPolicy:(AWSDDLogOverflowPolicy)overflowPolicy {
+    atomic_store_explicit(&_overflowPolicy, overflowPolicy, memory_order_relaxed);
+}
+
++ (NSUInteger)droppedMessageCount {
+    return (NSUInteger)atomic_load_explicit(&_ring.droppedCount, memory_order_relaxed);
+}
+
++ (NSUInteger)blockedMessageCount {
+    return (NSUInteger)atomic_load_explicit(&_ring.blockedCount, memory_order_relaxed);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma mark Notifications
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -314,59 +361,36 @@ static NSUInteger _numProcessors;
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 - (void)queueLogMessage:(AWSDDLogMessage *)logMessage asynchronously:(BOOL)asyncFlag {
-    // We have a tricky situation here...
-    //
-    // In the common case, when the queueSize is below the maximumQueueSize,
-    // we want to simply enqueue the logMessage. And we want to do this as fast as possible,
-    // which means we don't want to block and we don't want to use any locks.
+    // In the common case there is room in the ring, and queueing the message takes
+    // a compare-and-swap and no lock, no kernel call and no dispatch.
     //
-    // However, if the queueSize gets too big, we want to block.
-    // But we have very strict requirements as to when we block, and how long we block.
-    //
-    // The following example should help illustrate our requirements:
-    //
-    // Imagine that the maximum queue size is configured to be 5,
-    // and that there are already 5 log messages queued.
-    // Let us call these 5 queued log messages A, B, C, D, and E. (A is next to be executed)
-    //
-    // Now if our thread issues a log statement (let us call the log message F),
-    // it should block before the message is added to the queue.
-    // Furthermore, it should be unblocked immediately after A has been unqueued.
-    //
-    // The requirements are strict in this manner so that we block only as long as necessary,
-    // and so that blocked threads are unblocked in the order in which they were blocked.
-    //
-    // Returning to our previous example, let us assume that log messages A through E are still queued.
-    // Our aforementioned thread is blocked attempting to queue log message F.
-    // Now assume we have another separate thread that attempts to issue log message G.
-    // It should block until log messages A and B have been unqueued.
+    // When the ring is full, the overflow policy applies. Synchronous statements always wait,
+    // since the caller asked for the message to be written before returning, and their
+    // messages are never dropped to make room for another.
 
+    uint64_t ticket;
+    AWSDDLogRingOverflow policy = (AWSDDLogRingOverflow)atomic_load_explicit(&_overflowPolicy, memory_order_relaxed);
 
-    // We are using a counting semaphore provided by GCD.
-    // The semaphore is initialized with our AWSDDLOG_MAX_QUEUE_SIZE value.
-    // Everytime we want to queue a log message we decrement this value.
-    // If the resulting value is less than zero,
-    // the semaphore function waits in FIFO order for a signal to occur before returning.
-    //
-    // A dispatch semaphore is an efficient implementation of a traditional counting semaphore.
-    // Dispatch semaphores call down to the kernel only when the calling thread needs to be blocked.
-    // If the calling semaphore does not need to block, no kernel call is made.
-
-    dispatch_semaphore_wait(_queueSemaphore, DISPATCH_TIME_FOREVER);
+    if (!AWSDDLogRingQueue(&_ring, (__bridge_retained void *)logMessage, (__bridge_retained void *)self,
+                           policy, !asyncFlag, &ticket)) {
+        return;
+    }
 
-    // We've now sure we won't overflow the queue.
-    // It is time to queue our log message.
+    // The message is visible in the ring, and AWSDDLogRingQueue ended with a full barrier.
+    // Make sure a drain will run after this point: either one is already scheduled
+    // (and will see the message), or we schedule it.
 
-    dispatch_block_t logBlock = ^{
-        @autoreleasepool {
-            [self lt_log:logMessage];
-        }
-    };
+    if (!atomic_load_explicit(&_drainScheduled, memory_order_relaxed) &&
+        !atomic_exchange(&_drainScheduled, true)) {
+        dispatch_async(_loggingQueue, ^{
+            [AWSDDLog lt_drainScheduled];
+        });
+    }
 
-    if (asyncFlag) {
-        dispatch_async(_loggingQueue, logBlock);
-    } else {
-        dispatch_sync(_loggingQueue, logBlock);
+    if (!asyncFlag) {
+        dispatch_sync(_loggingQueue, ^{
+            [AWSDDLog lt_drainThroughTicket:ticket];
+        });
     }
 }
 
@@ -693,6 +717,10 @@ static NSUInteger _numProcessors;
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 - (void)lt_addLogger:(id <AWSDDLogger>)logger level:(AWSDDLogLevel)level {
+    // Messages queued before the logger was added go to the loggers of the time.
+
+    [AWSDDLog lt_drainRing];
+
     // Add to loggers array.
     // Need to create loggerQueue if loggerNode doesn't provide one.
 
@@ -748,6 +776,8 @@ static NSUInteger _numProcessors;
     NSAssert(dispatch_get_specific(GlobalLoggingQueueIdentityKey),
              @"This method should only be run on the logging thread/queue");
 
+    [AWSDDLog lt_drainRing];
+
     AWSDDLoggerNode *loggerNode = nil;
 
     for (AWSDDLoggerNode *node in self._loggers) {
@@ -776,6 +806,8 @@ static NSUInteger _numProcessors;
 - (void)lt_removeAllLoggers {
     NSAssert(dispatch_get_specific(GlobalLoggingQueueIdentityKey),
              @"This method should only be run on the logging thread/queue");
+
+    [AWSDDLog lt_drainRing];
     
     // Notify all loggers
     for (AWSDDLoggerNode *loggerNode in self._loggers) {
@@ -860,25 +892,79 @@ static NSUInteger _numProcessors;
             } });
         }
     }
+}
 
-    // If our queue got too big, there may be blocked threads waiting to add log messages to the queue.
-    // Since we've now dequeued an item from the log, we may need to unblock the next thread.
++ (BOOL)lt_drainBatch {
+    // Takes up to AWSDDLOG_DRAIN_BATCH_SIZE messages off the ring and logs them.
+    // Returns YES if the batch was full, i.e. there may be more.
 
-    // We are using a counting semaphore provided by GCD.
-    // The semaphore is initialized with our AWSDDLOG_MAX_QUEUE_SIZE value.
-    // When a log message is queued this value is decremented.
-    // When a log message is dequeued this value is incremented.
-    // If the value ever drops below zero,
-    // the queueing thread blocks and waits in FIFO order for us to signal it.
-    //
-    // A dispatch semaphore is an efficient implementation of a traditional counting semaphore.
-    // Dispatch semaphores call down to the kernel only when the calling thread needs to be blocked.
-    // If the calling semaphore does not need to block, no kernel call is made.
+    NSAssert(dispatch_get_specific(GlobalLoggingQueueIdentityKey),
+             @"This method should only be run on the logging thread/queue");
+
+    NSUInteger taken = 0;
+
+    while (taken < AWSDDLOG_DRAIN_BATCH_SIZE) { @autoreleasepool {
+        void *message, *owner;
 
-    dispatch_semaphore_signal(_queueSemaphore);
+        // Lets in a thread blocked on a full ring, if there is one
+        if (!AWSDDLogRingPop(&_ring, &message, &owner)) {
+            break;
+        }
+
+        taken++;
+
+        AWSDDLogMessage *logMessage = (__bridge_transfer AWSDDLogMessage *)message;
+        [(__bridge_transfer AWSDDLog *)owner lt_log:logMessage];
+    } }
+
+    return taken == AWSDDLOG_DRAIN_BATCH_SIZE;
+}
+
++ (void)lt_drainRing {
+    while ([self lt_drainBatch]) {
+    }
+}
+
++ (void)lt_drainScheduled {
+    // Runs one batch at a time, so that blocks queued behind the drain don't wait for a busy ring to empty.
+
+    if ([self lt_drainBatch]) {
+        dispatch_async(_loggingQueue, ^{
+            [AWSDDLog lt_drainScheduled];
+        });
+        return;
+    }
+
+    // The ring looked empty. Clear the flag, then look once more: a producer that published
+    // before seeing the flag cleared didn't schedule a drain, so we must.
+
+    atomic_store(&_drainScheduled, false);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if (AWSDDLogRingHasMessage(&_ring) && !atomic_exchange(&_drainScheduled, true)) {
+        dispatch_async(_loggingQueue, ^{
+            [AWSDDLog lt_drainScheduled];
+        });
+    }
+}
+
++ (void)lt_drainThroughTicket:(uint64_t)ticket {
+    // Logs every message up to and including the given one.
+    // A producer ahead of it may have taken its ticket without having stored its message yet.
+    // Sleep until it has, rather than spin: the producer may run at a lower priority than we do.
+
+    while (AWSDDLogRingHead(&_ring) <= ticket) {
+        if (![self lt_drainBatch] && AWSDDLogRingHead(&_ring) <= ticket) {
+            AWSDDLogRingWaitForPublish(&_ring);
+        }
+    }
 }
 
 - (void)lt_flush {
+    // Log what is still waiting in the ring.
+
+    [AWSDDLog lt_drainRing];
+
     // All log statements issued before the flush method was invoked have now been executed.
     //
     // Now we need to propogate the flush request to any loggers that implement the flush method.
@@ -0,0 +1,244 @@
+// Software License Agreement (BSD License)
+//
+// Copyright (c) 2010-2016, Deusty, LLC
+// All rights reserved.
+//
+// Redistribution and use of this software in source and binary forms,
+// with or without modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Neither the name of Deusty nor the names of its contributors may be used
+//   to endorse or promote products derived from this software without specific
+//   prior written permission of Deusty, LLC.
+
+#include "AWSDDLogRing.h"
+
+#include <stdlib.h>
+
+typedef enum {
+    AWSDDLogRingDropResultDropped,     // The oldest message is gone
+    AWSDDLogRingDropResultSynchronous, // The oldest message is waited for and stays
+    AWSDDLogRingDropResultNone         // Empty, or the oldest message is still being stored
+} AWSDDLogRingDropResult;
+
+bool AWSDDLogRingInit(AWSDDLogRing *ring, uint64_t capacity, AWSDDLogRingReleaseFunction releaseFunction) {
+    ring->slots = calloc((size_t)capacity, sizeof(AWSDDLogRingSlot));
+    if (ring->slots == NULL) {
+        return false;
+    }
+    for (uint64_t i = 0; i < capacity; i++) {
+        atomic_init(&ring->slots[i].sequence, i);
+        atomic_init(&ring->slots[i].synchronous, false);
+    }
+    ring->capacity = capacity;
+    ring->releaseFunction = releaseFunction;
+
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->droppedCount, 0);
+    atomic_init(&ring->blockedCount, 0);
+
+    pthread_mutex_init(&ring->roomLock, NULL);
+    pthread_cond_init(&ring->roomCondition, NULL);
+    atomic_init(&ring->roomWaiters, 0);
+
+    pthread_mutex_init(&ring->publishLock, NULL);
+    pthread_cond_init(&ring->publishCondition, NULL);
+    atomic_init(&ring->publishWaiters, 0);
+    return true;
+}
+
+static bool AWSDDLogRingPush(AWSDDLogRing *ring, void *message, void *owner, bool synchronous, uint64_t *ticket) {
+    uint64_t pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    for (;;) {
+        AWSDDLogRingSlot *slot = &ring->slots[pos % ring->capacity];
+        int64_t lag = (int64_t)(atomic_load_explicit(&slot->sequence, memory_order_acquire) - pos);
+
+        if (lag == 0) {
+            if (atomic_compare_exchange_weak_explicit(&ring->tail, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                slot->message = message;
+                slot->owner = owner;
+                atomic_store_explicit(&slot->synchronous, synchronous, memory_order_relaxed);
+                atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+
+                // Either the consumer sees the message, or we see it waiting for one and wake it.
+
+                atomic_thread_fence(memory_order_seq_cst);
+
+                if (atomic_load_explicit(&ring->publishWaiters, memory_order_relaxed) > 0) {
+                    pthread_mutex_lock(&ring->publishLock);
+                    pthread_cond_signal(&ring->publishCondition);
+                    pthread_mutex_unlock(&ring->publishLock);
+                }
+
+                *ticket = pos;
+                return true;
+            }
+        } else if (lag < 0) {
+            // The slot still holds the message from the previous lap: the ring is full
+            return false;
+        } else {
+            pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        }
+    }
+}
+
+static AWSDDLogRingDropResult AWSDDLogRingDropOldest(AWSDDLogRing *ring) {
+    uint64_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    for (;;) {
+        AWSDDLogRingSlot *slot = &ring->slots[pos % ring->capacity];
+        int64_t lag = (int64_t)(atomic_load_explicit(&slot->sequence, memory_order_acquire) - (pos + 1));
+
+        if (lag == 0) {
+            // The slot is only refilled once the head has moved past it. If it has, the flag
+            // may be the next lap's: look again from the new head.
+            if (atomic_load_explicit(&slot->synchronous, memory_order_relaxed)) {
+                uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+                if (head == pos) {
+                    return AWSDDLogRingDropResultSynchronous;
+                }
+                pos = head;
+                continue;
+            }
+            if (atomic_compare_exchange_weak_explicit(&ring->head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                void *message = slot->message;
+                void *owner = slot->owner;
+
+                atomic_store_explicit(&slot->sequence, pos + ring->capacity, memory_order_release);
+                ring->releaseFunction(message, owner);
+                return AWSDDLogRingDropResultDropped;
+            }
+        } else if (lag < 0) {
+            return AWSDDLogRingDropResultNone;
+        } else {
+            pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        }
+    }
+}
+
+bool AWSDDLogRingQueue(AWSDDLogRing *ring, void *message, void *owner, AWSDDLogRingOverflow policy,
+                       bool synchronous, uint64_t *ticket) {
+    if (AWSDDLogRingPush(ring, message, owner, synchronous, ticket)) {
+        return true;
+    }
+
+    if (synchronous) {
+        // The caller asked for the message to be written before returning
+        policy = AWSDDLogRingOverflowBlock;
+    }
+
+    if (policy == AWSDDLogRingOverflowDropNewest) {
+        atomic_fetch_add_explicit(&ring->droppedCount, 1, memory_order_relaxed);
+        ring->releaseFunction(message, owner);
+        return false;
+    } else if (policy == AWSDDLogRingOverflowDropOldest) {
+        do {
+            AWSDDLogRingDropResult dropResult = AWSDDLogRingDropOldest(ring);
+
+            if (dropResult == AWSDDLogRingDropResultSynchronous) {
+                // A synchronous statement is waiting for the oldest message: drop ours instead.
+                // The logging queue is bound to run, that statement drains the ring up to it.
+                atomic_fetch_add_explicit(&ring->droppedCount, 1, memory_order_relaxed);
+                ring->releaseFunction(message, owner);
+                return false;
+            }
+            if (dropResult == AWSDDLogRingDropResultDropped) {
+                atomic_fetch_add_explicit(&ring->droppedCount, 1, memory_order_relaxed);
+            }
+        } while (!AWSDDLogRingPush(ring, message, owner, false, ticket));
+        return true;
+    }
+
+    // Announce ourselves before looking again, so that either we find room
+    // or the consumer sees a waiter and signals after taking a message.
+    // Waiters are not woken in the order they blocked.
+
+    atomic_fetch_add_explicit(&ring->blockedCount, 1, memory_order_relaxed);
+
+    pthread_mutex_lock(&ring->roomLock);
+    atomic_fetch_add_explicit(&ring->roomWaiters, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    while (!AWSDDLogRingPush(ring, message, owner, synchronous, ticket)) {
+        pthread_cond_wait(&ring->roomCondition, &ring->roomLock);
+    }
+
+    atomic_fetch_sub_explicit(&ring->roomWaiters, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&ring->roomLock);
+    return true;
+}
+
+bool AWSDDLogRingPop(AWSDDLogRing *ring, void **message, void **owner) {
+    uint64_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    for (;;) {
+        AWSDDLogRingSlot *slot = &ring->slots[pos % ring->capacity];
+        int64_t lag = (int64_t)(atomic_load_explicit(&slot->sequence, memory_order_acquire) - (pos + 1));
+
+        if (lag == 0) {
+            if (atomic_compare_exchange_weak_explicit(&ring->head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                *message = slot->message;
+                *owner = slot->owner;
+                atomic_store_explicit(&slot->sequence, pos + ring->capacity, memory_order_release);
+
+                // A slot is free again. If a thread is blocked on a full ring, let it in
+                // before the message is logged, which may take a while.
+
+                atomic_thread_fence(memory_order_seq_cst);
+
+                if (atomic_load_explicit(&ring->roomWaiters, memory_order_relaxed) > 0) {
+                    pthread_mutex_lock(&ring->roomLock);
+                    pthread_cond_signal(&ring->roomCondition);
+                    pthread_mutex_unlock(&ring->roomLock);
+                }
+                return true;
+            }
+        } else if (lag < 0) {
+            // Empty, or the next message is still being stored by its producer
+            return false;
+        } else {
+            pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        }
+    }
+}
+
+bool AWSDDLogRingHasMessage(AWSDDLogRing *ring) {
+    uint64_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    AWSDDLogRingSlot *slot = &ring->slots[pos % ring->capacity];
+
+    return atomic_load_explicit(&slot->sequence, memory_order_acquire) == pos + 1;
+}
+
+uint64_t AWSDDLogRingHead(AWSDDLogRing *ring) {
+    return atomic_load_explicit(&ring->head, memory_order_relaxed);
+}
+
+void AWSDDLogRingWaitForPublish(AWSDDLogRing *ring) {
+    uint64_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    if (atomic_load_explicit(&ring->tail, memory_order_relaxed) == pos) {
+        return;
+    }
+
+    // Announce ourselves before looking, so that either we see the message
+    // or its producer sees a waiter and signals after storing it.
+
+    pthread_mutex_lock(&ring->publishLock);
+    atomic_fetch_add_explicit(&ring->publishWaiters, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    while (!AWSDDLogRingHasMessage(ring) && atomic_load_explicit(&ring->head, memory_order_relaxed) == pos) {
+        pthread_cond_wait(&ring->publishCondition, &ring->publishLock);
+    }
+
+    atomic_fetch_sub_explicit(&ring->publishWaiters, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&ring->publishLock);
+}
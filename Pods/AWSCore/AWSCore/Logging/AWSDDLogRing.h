@@ -0,0 +1,113 @@
+// Software License Agreement (BSD License)
+//
+// Copyright (c) 2010-2016, Deusty, LLC
+// All rights reserved.
+//
+// Redistribution and use of this software in source and binary forms,
+// with or without modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Neither the name of Deusty nor the names of its contributors may be used
+//   to endorse or promote products derived from this software without specific
+//   prior written permission of Deusty, LLC.
+
+#ifndef AWSDDLogRing_h
+#define AWSDDLogRing_h
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The bounded ring AWSDDLog queues messages in, in plain C so that tools/ddlog can check
+// the same code off the device.
+//
+// Any thread may add to the ring and (almost) only the logging queue takes from it, without locks:
+// each slot carries a sequence number saying whose turn it is.
+// The slot for ticket `pos` is free for a producer when its sequence is `pos`,
+// holds a message for the consumer when it is `pos + 1`,
+// and is handed to the producer one lap later by setting it to `pos + capacity`.
+//
+// Tickets are taken with a compare-and-swap on both ends, so a producer may also take
+// the oldest message when the overflow policy says to drop it. It never takes one that
+// a synchronous log statement is waiting for: that statement returns once the logging
+// queue is past its ticket, which must mean the message was logged.
+//
+// Threads that have to wait, a producer for room or the consumer for a message whose ticket
+// is taken but which isn't stored yet, sleep on a condition variable instead of spinning,
+// so that a waiting logging queue never keeps the producer it waits for off the CPU.
+
+// Same values as AWSDDLogOverflowPolicy
+typedef enum {
+    AWSDDLogRingOverflowBlock      = 0,
+    AWSDDLogRingOverflowDropNewest = 1,
+    AWSDDLogRingOverflowDropOldest = 2
+} AWSDDLogRingOverflow;
+
+typedef struct {
+    _Atomic(uint64_t) sequence;
+    void *message;          // Owned by the ring while in it
+    void *owner;            // Owned by the ring while in it
+    atomic_bool synchronous; // Queued by a synchronous log statement, never dropped
+} AWSDDLogRingSlot;
+
+// Gives up a message and its owner that the overflow policy dropped
+typedef void (*AWSDDLogRingReleaseFunction)(void *message, void *owner);
+
+typedef struct {
+    AWSDDLogRingSlot *slots;
+    uint64_t capacity;
+    AWSDDLogRingReleaseFunction releaseFunction;
+
+    _Atomic(uint64_t) head; // Next ticket to take
+    _Atomic(uint64_t) tail; // Next ticket to fill
+
+    _Atomic(uint64_t) droppedCount; // Messages dropped by the overflow policy
+    _Atomic(uint64_t) blockedCount; // Messages that had to wait for room
+
+    // Producers blocked on a full ring, woken one per message taken while there are any
+    pthread_mutex_t roomLock;
+    pthread_cond_t roomCondition;
+    _Atomic(uint32_t) roomWaiters;
+
+    // The consumer waiting for a producer to store the message of a ticket it has taken
+    pthread_mutex_t publishLock;
+    pthread_cond_t publishCondition;
+    _Atomic(uint32_t) publishWaiters;
+} AWSDDLogRing;
+
+// Sets up an empty ring of capacity slots. Returns false if out of memory.
+bool AWSDDLogRingInit(AWSDDLogRing *ring, uint64_t capacity, AWSDDLogRingReleaseFunction releaseFunction);
+
+// Queues message and owner, which the ring then owns, and sets ticket to the message's ticket.
+// On a full ring a synchronous message always waits; others go by policy. Returns false if
+// the message was dropped, after giving it to the release function.
+// Returns after a full memory barrier that follows the message being stored.
+bool AWSDDLogRingQueue(AWSDDLogRing *ring, void *message, void *owner, AWSDDLogRingOverflow policy,
+                       bool synchronous, uint64_t *ticket);
+
+// Takes the oldest message, which the caller then owns. Returns false if the ring is empty
+// or the oldest message is still being stored by its producer.
+bool AWSDDLogRingPop(AWSDDLogRing *ring, void **message, void **owner);
+
+// Returns true if the oldest message can be taken.
+bool AWSDDLogRingHasMessage(AWSDDLogRing *ring);
+
+// The ticket of the oldest message, or of the next one if the ring is empty.
+uint64_t AWSDDLogRingHead(AWSDDLogRing *ring);
+
+// Sleeps until the oldest ticket's message has been stored, for the consumer only.
+// Returns at once if no ticket beyond the head has been taken.
+void AWSDDLogRingWaitForPublish(AWSDDLogRing *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,80 @@
+//
+// Copyright 2014-2016 Amazon.com,
+// Inc. or its affiliates. All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSCognitoIdentityProviderSrpHelper.h"
+#import "AWSCognitoIdentityProviderSrpVerifier.h"
+
+static NSString *const AWSCognitoIdentityProviderSrpVerifierTestsPoolName = @"testPool";
+static NSString *const AWSCognitoIdentityProviderSrpVerifierTestsUserName = @"test-user";
+static NSString *const AWSCognitoIdentityProviderSrpVerifierTestsPassword = @"test-password";
+
+// Sign-ins as AWSCognitoIdentityUser answers PASSWORD_VERIFIER, checked by tools/srp's stand-in for the service
+@interface AWSCognitoIdentityProviderSrpVerifierTests : XCTestCase
+@property(nonatomic, strong) AWSCognitoIdentityProviderSrpVerifier *verifier;
+@end
+
+@implementation AWSCognitoIdentityProviderSrpVerifierTests
+
+- (void)setUp {
+    [super setUp];
+    self.verifier = [[AWSCognitoIdentityProviderSrpVerifier alloc] initWithPoolName:AWSCognitoIdentityProviderSrpVerifierTestsPoolName
+                                                                           userName:AWSCognitoIdentityProviderSrpVerifierTestsUserName
+                                                                           password:AWSCognitoIdentityProviderSrpVerifierTestsPassword];
+}
+
+- (BOOL)signInWithPassword:(NSString *)password {
+    AWSCognitoIdentityProviderSrpHelper *helper = [AWSCognitoIdentityProviderSrpHelper beginUserAuthentication:AWSCognitoIdentityProviderSrpVerifierTestsUserName
+                                                                                                      password:password];
+    AWSCognitoIdentityProviderSrpServerState *serverState = [self.verifier challengeForPublicA:helper.clientState.publicA];
+    XCTAssertNotNil(serverState);
+    NSData *signature = [helper completeAuthentication:serverState];
+    return [self.verifier verifySignature:signature
+                                timestamp:[AWSCognitoIdentityProviderSrpHelper generateDateString:helper.clientState.timestamp]];
+}
+
+- (void)testSignInVerifies {
+    XCTAssertTrue([self signInWithPassword:AWSCognitoIdentityProviderSrpVerifierTestsPassword]);
+}
+
+- (void)testSignInWithPooledKeyPairVerifies {
+    AWSCognitoIdentityProviderSrpKeyPool *pool = [AWSCognitoIdentityProviderSrpKeyPool sharedPool];
+    [pool refill];
+    [self expectationForPredicate:[NSPredicate predicateWithFormat:@"count > 0"] evaluatedWithObject:pool handler:nil];
+    [self waitForExpectationsWithTimeout:30.0 handler:nil];
+
+    NSUInteger hits = pool.hits;
+    XCTAssertTrue([self signInWithPassword:AWSCognitoIdentityProviderSrpVerifierTestsPassword]);
+    XCTAssertEqual(pool.hits, hits + 1);
+}
+
+- (void)testSignInWithWrongPasswordFails {
+    XCTAssertFalse([self signInWithPassword:@"wrong-password"]);
+}
+
+- (void)testSignatureAnswersOneChallengeOnly {
+    AWSCognitoIdentityProviderSrpHelper *helper = [AWSCognitoIdentityProviderSrpHelper beginUserAuthentication:AWSCognitoIdentityProviderSrpVerifierTestsUserName
+                                                                                                      password:AWSCognitoIdentityProviderSrpVerifierTestsPassword];
+    AWSCognitoIdentityProviderSrpServerState *serverState = [self.verifier challengeForPublicA:helper.clientState.publicA];
+    NSData *signature = [helper completeAuthentication:serverState];
+    NSString *timestamp = [AWSCognitoIdentityProviderSrpHelper generateDateString:helper.clientState.timestamp];
+
+    XCTAssertTrue([self.verifier verifySignature:signature timestamp:timestamp]);
+    XCTAssertFalse([self.verifier verifySignature:signature timestamp:timestamp]);
+}
+
+- (void)testBenchmarkHandshakes {
+    NSDictionary<NSString *, NSDictionary<NSString *, NSNumber *> *> *result = [AWSCognitoIdentityProviderSrpVerifier benchmarkHandshakes:20];
+    XCTAssertNotNil(result, @"a handshake failed to verify");
+    for (NSString *phase in @[@"publicA", @"challenge", @"completeAuthentication", @"verify"]) {
+        XCTAssertNotNil(result[phase][@"p50"], @"%@", phase);
+        XCTAssertNotNil(result[phase][@"p99"], @"%@", phase);
+    }
+    NSLog(@"SRP handshake p50/p99 ms: %@", result);
+}
+
+@end
@@ -0,0 +1,216 @@
+/* Check the AWSDDLog message ring under each overflow policy
+ *
+ * Builds Pods/AWSCore/AWSCore/Logging/AWSDDLogRing.c, the ring AWSDDLog.m
+ * queues its messages in, so it runs on any host:
+ *
+ *    make ring
+ *    ./ring [rounds]
+ *
+ * For each policy, RING_ASYNC producers log asynchronously into a ring of
+ * RING_SIZE slots as fast as they can while a slow consumer [the logging
+ * queue] takes the messages one by one.  At the same time a synchronous
+ * producer logs "rounds" messages; each waits on the consumer until it has
+ * drained the ring through the message's ticket, as lt_drainThroughTicket:
+ * does, and that message must then have been logged.
+ *
+ * Every message must be logged or dropped exactly once, the ring's dropped
+ * count must be the number of messages it gave back, and each producer's
+ * messages must be logged in order.  Under Block nothing is dropped and
+ * producers must have waited for room; under the drop policies messages must
+ * have been dropped.
+ *
+ * The exit status is nonzero on the first failed check.
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "AWSDDLogRing.h"
+
+#define RING_SIZE   8
+#define RING_ASYNC  4
+#define RING_ROUNDS 500
+
+/* a message is its producer in the top bits and its number, from 1, below */
+#define RING_MESSAGE(p, n) ((void *)(uintptr_t)(((uint64_t)(p) << 32) | (uint64_t)(n)))
+#define RING_PRODUCERS     (RING_ASYNC + 1)
+
+static AWSDDLogRing        s_ring;
+static AWSDDLogRingOverflow s_policy;
+static _Atomic(long)        s_released;
+static atomic_int           s_producing, s_waiting; /* producers left, the synchronous one still logging */
+static _Atomic(uint64_t)    s_request; /* a ticket to drain through, as with dispatch_sync */
+static atomic_int           s_served;
+static long                 s_logged[RING_PRODUCERS]; /* last message number logged, per producer */
+static long                 s_sent[RING_PRODUCERS];
+static long                 s_count, s_bad;
+
+static void s_release(void *message, void *owner)
+{
+  (void)message;
+  (void)owner;
+  atomic_fetch_add(&s_released, 1);
+}
+
+/* the logging queue: one message, slowly */
+static int s_log_one(void)
+{
+  void             *message, *owner;
+  long              producer, n;
+  volatile unsigned spin;
+
+  if (!AWSDDLogRingPop(&s_ring, &message, &owner)) {
+    return 0;
+  }
+  producer = (long)((uintptr_t)message >> 32);
+  n = (long)((uintptr_t)message & 0xFFFFFFFFu);
+  if (n <= s_logged[producer]) {
+    printf("producer %ld: message %ld logged after %ld\n", producer, n, s_logged[producer]);
+    ++s_bad;
+  }
+  s_logged[producer] = n;
+  ++s_count;
+  for (spin = 0; spin < 2000; spin++) {
+  }
+  return 1;
+}
+
+static void *s_consumer(void *arg)
+{
+  uint64_t ticket;
+
+  (void)arg;
+  for (;;) {
+    ticket = atomic_load(&s_request);
+    if (ticket != UINT64_MAX) {
+      /* lt_drainThroughTicket: */
+      while (AWSDDLogRingHead(&s_ring) <= ticket) {
+        if (!s_log_one() && AWSDDLogRingHead(&s_ring) <= ticket) {
+          AWSDDLogRingWaitForPublish(&s_ring);
+        }
+      }
+      atomic_store(&s_request, UINT64_MAX);
+      atomic_store(&s_served, 1);
+    } else if (!s_log_one()) {
+      if (atomic_load(&s_producing) == 0) {
+        break;
+      }
+      sched_yield();
+    }
+  }
+  while (s_log_one()) {
+  }
+  return NULL;
+}
+
+/* queueLogMessage:asynchronously:YES */
+static void *s_async(void *arg)
+{
+  long     producer = (long)(intptr_t)arg, n = 0;
+  uint64_t ticket;
+
+  while (atomic_load(&s_waiting) || n < RING_ROUNDS) {
+    ++n;
+    AWSDDLogRingQueue(&s_ring, RING_MESSAGE(producer, n), NULL, s_policy, false, &ticket);
+  }
+  s_sent[producer] = n;
+  atomic_fetch_sub(&s_producing, 1);
+  return NULL;
+}
+
+static int s_run(AWSDDLogRingOverflow policy, const char *name, long rounds)
+{
+  pthread_t consumer, async[RING_ASYNC];
+  long      n, sent, dropped, blocked, ix;
+  uint64_t  ticket;
+
+  if (!AWSDDLogRingInit(&s_ring, RING_SIZE, s_release)) {
+    fprintf(stderr, "no memory\n");
+    return 0;
+  }
+  s_policy = policy;
+  s_released = 0;
+  s_count = s_bad = 0;
+  for (ix = 0; ix < RING_PRODUCERS; ix++) {
+    s_logged[ix] = s_sent[ix] = 0;
+  }
+  atomic_store(&s_request, UINT64_MAX);
+  atomic_store(&s_waiting, 1);
+  atomic_store(&s_producing, RING_PRODUCERS);
+  if (pthread_create(&consumer, NULL, s_consumer, NULL) != 0) {
+    fprintf(stderr, "no thread\n");
+    return 0;
+  }
+  for (ix = 0; ix < RING_ASYNC; ix++) {
+    if (pthread_create(&async[ix], NULL, s_async, (void *)(intptr_t)(ix + 1)) != 0) {
+      fprintf(stderr, "no thread\n");
+      return 0;
+    }
+  }
+
+  /* queueLogMessage:asynchronously:NO, producer 0: waits for room, then for the drain */
+  for (n = 1; n <= rounds; n++) {
+    if (!AWSDDLogRingQueue(&s_ring, RING_MESSAGE(0, n), NULL, policy, true, &ticket)) {
+      printf("%s: synchronous message %ld dropped\n", name, n);
+      return 0;
+    }
+    atomic_store(&s_served, 0);
+    atomic_store(&s_request, ticket);
+    while (!atomic_load(&s_served)) {
+      sched_yield();
+    }
+    if (s_logged[0] != n) {
+      printf("%s: synchronous message %ld returned without being logged\n", name, n);
+      return 0;
+    }
+  }
+  s_sent[0] = rounds;
+  atomic_store(&s_waiting, 0);
+  atomic_fetch_sub(&s_producing, 1);
+
+  for (ix = 0; ix < RING_ASYNC; ix++) {
+    pthread_join(async[ix], NULL);
+  }
+  pthread_join(consumer, NULL);
+  free(s_ring.slots);
+  pthread_mutex_destroy(&s_ring.roomLock);
+  pthread_cond_destroy(&s_ring.roomCondition);
+  pthread_mutex_destroy(&s_ring.publishLock);
+  pthread_cond_destroy(&s_ring.publishCondition);
+
+  sent = 0;
+  for (ix = 0; ix < RING_PRODUCERS; ix++) {
+    sent += s_sent[ix];
+  }
+  dropped = (long)atomic_load(&s_ring.droppedCount);
+  blocked = (long)atomic_load(&s_ring.blockedCount);
+  printf("%-10s %ld messages: %ld logged [%ld of them synchronous], %ld dropped, %ld blocked\n", name, sent,
+         s_count, rounds, dropped, blocked);
+  if (s_count + atomic_load(&s_released) != sent) {
+    printf("%s: %ld messages were neither logged nor dropped\n", name, sent - s_count - (long)atomic_load(&s_released));
+    return 0;
+  }
+  if (dropped != atomic_load(&s_released)) {
+    printf("%s: %ld messages counted as dropped, %ld given back\n", name, dropped, (long)atomic_load(&s_released));
+    return 0;
+  }
+  if (policy == AWSDDLogRingOverflowBlock ? dropped != 0 || blocked == 0 : dropped == 0) {
+    printf("%s: the ring never overflowed as it should\n", name);
+    return 0;
+  }
+  return s_bad == 0;
+}
+
+int main(int argc, char **argv)
+{
+  long rounds = argc > 1 ? atol(argv[1]) : RING_ROUNDS;
+
+  if (!s_run(AWSDDLogRingOverflowBlock, "Block", rounds) ||
+      !s_run(AWSDDLogRingOverflowDropNewest, "DropNewest", rounds) ||
+      !s_run(AWSDDLogRingOverflowDropOldest, "DropOldest", rounds)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
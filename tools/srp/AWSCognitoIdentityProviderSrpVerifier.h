@@ -0,0 +1,44 @@
+//
+// Copyright 2014-2016 Amazon.com,
+// Inc. or its affiliates. All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#import <Foundation/Foundation.h>
+#import "AWSCognitoIdentityProviderSrpHelper.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/* A local stand-in for the service side of SRP sign-in, on the same tommath
+ * primitives as the client. It keeps the salt and verifier of one user,
+ * issues SRP_B/salt challenges and checks PASSWORD_CLAIM_SIGNATURE, so the
+ * client can be exercised and timed without network access. Only the last
+ * challenge is answered and an instance is not thread safe.
+ *
+ * Test and benchmark code only: it is not part of the pod. The
+ * TopcoderMobileAppTests target builds it and runs it from
+ * AWSCognitoIdentityProviderSrpVerifierTests.
+ */
+@interface AWSCognitoIdentityProviderSrpVerifier : NSObject
+/* registers the user through -[AWSCognitoIdentityProviderSrpHelper initWithPoolName:userName:password:] */
+- (instancetype)initWithPoolName:(NSString *)poolName userName:(NSString *)userName password:(NSString *)password;
+
+@property(nonatomic, strong, readonly) NSString *poolName;
+@property(nonatomic, strong, readonly) NSString *userName;
+@property(nonatomic, strong, readonly) AWSJKBigInteger *salt;
+@property(nonatomic, strong, readonly) AWSJKBigInteger *v;
+
+/* a fresh b and SRP_B = (k * v + g^b) % N, as the client receives them; nil if A % N is 0 */
+- (nullable AWSCognitoIdentityProviderSrpServerState *)challengeForPublicA:(AWSJKBigInteger *)publicA;
+/* YES if signature is the PASSWORD_CLAIM_SIGNATURE for the last challenge at timestamp [the TIMESTAMP parameter] */
+- (BOOL)verifySignature:(NSData *)signature timestamp:(NSString *)timestamp;
+
+/* Runs count sign-ins against a verifier and returns the p50 and p99 time of each
+ * phase in milliseconds, keyed by phase: publicA, challenge, completeAuthentication
+ * [S, the key and the signature] and verify. nil if one failed.
+ */
++ (nullable NSDictionary<NSString *, NSDictionary<NSString *, NSNumber *> *> *)benchmarkHandshakes:(NSUInteger)count;
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,207 @@
+//
+// Copyright 2014-2016 Amazon.com,
+// Inc. or its affiliates. All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#import "AWSCognitoIdentityProviderSrpVerifier.h"
+#import "AWSCognitoIdentityProviderHKDF.h"
+#import "AWSJKBigInteger.h"
+#import "NSData+AWSCognitoIdentityProvider.h"
+#import <CommonCrypto/CommonCrypto.h>
+#import <Security/Security.h>
+#import <mach/mach_time.h>
+#import <math.h>
+
+// What AWSCognitoIdentityUser passes for every SRP challenge
+static NSString *const AWSCognitoIdentityProviderSrpVerifierDerivedKeyInfo = @"Caldera Derived Key";
+static const NSInteger AWSCognitoIdentityProviderSrpVerifierDerivedKeySize = 16;
+
+// mach_absolute_time() ticks to nanoseconds; clock_gettime_nsec_np() needs iOS 10
+static uint64_t srpNanoseconds(uint64_t ticks) {
+    static mach_timebase_info_data_t timebase;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info(&timebase);
+    });
+    return ticks * timebase.numer / timebase.denom;
+}
+
+// The nearest rank p-th percentile of sorted samples
+static NSNumber *srpPercentile(NSArray<NSNumber *> *sorted, double p) {
+    NSUInteger rank = (NSUInteger)ceil(p * sorted.count);
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+@interface AWSCognitoIdentityProviderSrpVerifier ()
+@property(nonatomic, strong, readwrite) NSString *poolName;
+@property(nonatomic, strong, readwrite) NSString *userName;
+@property(nonatomic, strong, readwrite) AWSJKBigInteger *salt;
+@property(nonatomic, strong, readwrite) AWSJKBigInteger *v;
+
+// The open challenge
+@property(nonatomic, strong) AWSJKBigInteger *publicA;
+@property(nonatomic, strong) AWSJKBigInteger *privateB;
+@property(nonatomic, strong) AWSCognitoIdentityProviderSrpServerState *serverState;
+@end
+
+@implementation AWSCognitoIdentityProviderSrpVerifier
+
+- (instancetype)initWithPoolName:(NSString *)poolName userName:(NSString *)userName password:(NSString *)password {
+    if (self = [super init]) {
+        AWSCognitoIdentityProviderSrpHelper *registration = [[AWSCognitoIdentityProviderSrpHelper alloc] initWithPoolName:poolName
+                                                                                                                 userName:userName
+                                                                                                                 password:password];
+        self.poolName = poolName;
+        self.userName = userName;
+        self.salt = registration.salt;
+        self.v = registration.v;
+    }
+    return self;
+}
+
+- (AWSCognitoIdentityProviderSrpServerState *)challengeForPublicA:(AWSJKBigInteger *)publicA {
+    AWSCognitoIdentityProviderSrpCommonState *commonState = [AWSCognitoIdentityProviderSrpCommonState defaultState];
+
+    // an A of 0 mod N would fix S whatever the password, the service refuses it
+    AWSJKBigInteger *reducedA = [publicA remainder:commonState.N];
+    if (reducedA == nil || aws_mp_iszero([reducedA value])) {
+        return nil;
+    }
+
+    AWSJKBigInteger *privateB = [AWSCognitoIdentityProviderSrpHelper generatePrivateABigInt:commonState.N];
+    AWSJKBigInteger *gb = [AWSCognitoIdentityProviderSrpHelper powGenerator:commonState.g exponent:privateB N:commonState.N];
+    AWSJKBigInteger *publicB = [[[commonState.k multiply:self.v] add:gb] remainder:commonState.N];
+    if (publicB == nil) {
+        return nil;
+    }
+
+    uint8_t secretBlock[32];
+    if (SecRandomCopyBytes(kSecRandomDefault, sizeof(secretBlock), secretBlock) != errSecSuccess) {
+        return nil;
+    }
+
+    self.publicA = publicA;
+    self.privateB = privateB;
+    // B and the salt go through hex like the challenge parameters do
+    self.serverState = [AWSCognitoIdentityProviderSrpServerState
+                        serverStateForPoolName:self.poolName
+                              publicBHexString:[publicB stringValueWithRadix:16]
+                                 saltHexString:[self.salt stringValueWithRadix:16]
+                                derivedKeyInfo:AWSCognitoIdentityProviderSrpVerifierDerivedKeyInfo
+                                derivedKeySize:AWSCognitoIdentityProviderSrpVerifierDerivedKeySize
+                            serviceSecretBlock:[NSData dataWithBytes:secretBlock length:sizeof(secretBlock)]];
+    return self.serverState;
+}
+
+- (BOOL)verifySignature:(NSData *)signature timestamp:(NSString *)timestamp {
+    AWSCognitoIdentityProviderSrpCommonState *commonState = [AWSCognitoIdentityProviderSrpCommonState defaultState];
+    AWSCognitoIdentityProviderSrpServerState *serverState = self.serverState;
+    AWSJKBigInteger *privateB = self.privateB;
+
+    // one answer per challenge
+    self.serverState = nil;
+    self.privateB = nil;
+    if (serverState == nil) {
+        return NO;
+    }
+
+    // S = (A * v^u)^b % N, the S the client reaches as (B - k * g^x)^(a + u * x) % N
+    AWSJKBigInteger *u = [AWSCognitoIdentityProviderSrpHelper hashBigInts:@[self.publicA, serverState.publicB]];
+    AWSJKBigInteger *vu = [self.v pow:u andMod:commonState.N];
+    if (vu == nil) {
+        return NO;
+    }
+    // A and v^u are non-negative, so remainder: reduces into [0, N)
+    AWSJKBigInteger *S = [[[self.publicA multiply:vu] remainder:commonState.N] constantTimePow:privateB andMod:commonState.N];
+    if (S == nil) {
+        return NO;
+    }
+
+    NSData *key = [AWSCognitoIdentityProviderHKDF
+                   deriveKeyWithInputKeyingMaterial:[NSData aws_dataWithSignedBigInteger:S]
+                                               salt:[NSData aws_dataWithSignedBigInteger:u]
+                                               info:[serverState.derivedKeyInfo dataUsingEncoding:NSUTF8StringEncoding]
+                                       outputLength:(NSUInteger)serverState.derivedKeyLength];
+
+    uint8_t expected[CC_SHA256_DIGEST_LENGTH];
+    CCHmacContext ctx;
+    CCHmacInit(&ctx, kCCHmacAlgSHA256, key.bytes, key.length);
+    CCHmacUpdate(&ctx, self.poolName.UTF8String, (CC_LONG)[self.poolName lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    CCHmacUpdate(&ctx, self.userName.UTF8String, (CC_LONG)[self.userName lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    CCHmacUpdate(&ctx, serverState.serviceSecretBlock.bytes, serverState.serviceSecretBlock.length);
+    CCHmacUpdate(&ctx, timestamp.UTF8String, (CC_LONG)[timestamp lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    CCHmacFinal(&ctx, expected);
+
+    if (signature.length != sizeof(expected)) {
+        return NO;
+    }
+    // every byte is compared, the time does not tell where a forged signature goes wrong
+    const uint8_t *signatureBytes = signature.bytes;
+    uint8_t difference = 0;
+    for (size_t i = 0; i < sizeof(expected); i++) {
+        difference |= signatureBytes[i] ^ expected[i];
+    }
+    return difference == 0;
+}
+
++ (NSDictionary<NSString *, NSDictionary<NSString *, NSNumber *> *> *)benchmarkHandshakes:(NSUInteger)count {
+    NSArray<NSString *> *phases = @[@"publicA", @"challenge", @"completeAuthentication", @"verify"];
+    NSString *userName = @"benchmark-user";
+    NSString *password = @"benchmark-password";
+    AWSCognitoIdentityProviderSrpCommonState *commonState = [AWSCognitoIdentityProviderSrpCommonState defaultState];
+    AWSCognitoIdentityProviderSrpVerifier *verifier = [[AWSCognitoIdentityProviderSrpVerifier alloc] initWithPoolName:@"benchmarkPool"
+                                                                                                              userName:userName
+                                                                                                              password:password];
+
+    NSMutableArray<NSMutableArray<NSNumber *> *> *samples = [NSMutableArray arrayWithCapacity:phases.count];
+    for (NSUInteger phase = 0; phase < phases.count; phase++) {
+        [samples addObject:[NSMutableArray arrayWithCapacity:count]];
+    }
+
+    for (NSUInteger round = 0; round < count; round++) {
+        @autoreleasepool {
+            uint64_t times[5];
+
+            // a and A made here rather than taken from the key pool, which makes them ahead of time
+            times[0] = mach_absolute_time();
+            AWSJKBigInteger *privateA = [AWSCognitoIdentityProviderSrpHelper generatePrivateABigInt:commonState.N];
+            AWSJKBigInteger *publicA = [AWSCognitoIdentityProviderSrpHelper generatePublicABigInt:privateA N:commonState.N g:commonState.g];
+            AWSCognitoIdentityProviderSrpHelper *helper = [[AWSCognitoIdentityProviderSrpHelper alloc]
+                                                           initWithClientState:[AWSCognitoIdentityProviderSrpClientState clientStateForUserName:userName
+                                                                                                                                       password:password
+                                                                                                                                       privateA:privateA
+                                                                                                                                        publicA:publicA]];
+            times[1] = mach_absolute_time();
+            AWSCognitoIdentityProviderSrpServerState *serverState = [verifier challengeForPublicA:publicA];
+            if (serverState == nil) {
+                return nil;
+            }
+
+            // S, the key and the signature, as AWSCognitoIdentityUser answers PASSWORD_VERIFIER
+            times[2] = mach_absolute_time();
+            NSData *signature = [helper completeAuthentication:serverState];
+            times[3] = mach_absolute_time();
+            BOOL verified = [verifier verifySignature:signature
+                                            timestamp:[AWSCognitoIdentityProviderSrpHelper generateDateString:helper.clientState.timestamp]];
+            times[4] = mach_absolute_time();
+            if (!verified) {
+                return nil;
+            }
+
+            for (NSUInteger phase = 0; phase < phases.count; phase++) {
+                [samples[phase] addObject:@((double)srpNanoseconds(times[phase + 1] - times[phase]) / 1e6)];
+            }
+        }
+    }
+
+    NSMutableDictionary<NSString *, NSDictionary<NSString *, NSNumber *> *> *result = [NSMutableDictionary dictionaryWithCapacity:phases.count];
+    for (NSUInteger phase = 0; phase < phases.count && count > 0; phase++) {
+        NSArray<NSNumber *> *sorted = [samples[phase] sortedArrayUsingSelector:@selector(compare:)];
+        result[phases[phase]] = @{@"p50": srpPercentile(sorted, 0.50), @"p99": srpPercentile(sorted, 0.99)};
+    }
+    return result;
+}
+
+@end
@@ -0,0 +1,239 @@
+/* Count the heap calls of the SRP exponentiations
+ *
+ * The library is compiled into this file with a counting allocator:
+ *
+ *    make alloc
+ *    ./alloc
+ *
+ * Every exponentiation the SRP helper makes against the 3072-bit group
+ * [aws_mp_exptmod, aws_mp_exptmod_ct, aws_mp_exptmod_multi with a context
+ * and aws_mp_exptmod_comb_ct] is run twice to warm up [the first call leaves
+ * the size the scratch arena should have, the second one takes the block],
+ * then once and ALLOC_ROUNDS times for exponents of 256, 1024 and 3072 bits.  The number of
+ * allocations per call must be the same for every exponent size and every
+ * round and at most ALLOC_MAX, with the scratch arena serving the
+ * temporaries.  A thread that exponentiates and exits without
+ * aws_mp_scratch_release() must not leave its arena behind either.
+ *
+ * The counts go to stdout, the exit status is nonzero on the first failed
+ * check.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ALLOC_ROUNDS 20
+#define ALLOC_MAX    16
+
+#define AWS_XMALLOC  alloc_malloc
+#define AWS_XFREE    alloc_free
+#define AWS_XREALLOC alloc_realloc
+#define AWS_XCALLOC  alloc_calloc
+#include "tommath.c"
+
+#include <pthread.h>
+
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned long   s_allocs;
+static long            s_live;
+
+void *alloc_malloc(size_t n)
+{
+  void *p = malloc(n);
+
+  pthread_mutex_lock(&s_lock);
+  ++s_allocs;
+  s_live += (p != NULL);
+  pthread_mutex_unlock(&s_lock);
+  return p;
+}
+
+void *alloc_realloc(void *p, size_t n)
+{
+  void *q = realloc(p, n);
+
+  pthread_mutex_lock(&s_lock);
+  ++s_allocs;
+  s_live += (p == NULL && q != NULL);
+  pthread_mutex_unlock(&s_lock);
+  return q;
+}
+
+void *alloc_calloc(size_t n, size_t s)
+{
+  void *p = calloc(n, s);
+
+  pthread_mutex_lock(&s_lock);
+  ++s_allocs;
+  s_live += (p != NULL);
+  pthread_mutex_unlock(&s_lock);
+  return p;
+}
+
+void alloc_free(void *p)
+{
+  pthread_mutex_lock(&s_lock);
+  s_live -= (p != NULL);
+  pthread_mutex_unlock(&s_lock);
+  free(p);
+}
+
+static unsigned long s_count(void)
+{
+  unsigned long n;
+
+  pthread_mutex_lock(&s_lock);
+  n = s_allocs;
+  pthread_mutex_unlock(&s_lock);
+  return n;
+}
+
+static long s_outstanding(void)
+{
+  long n;
+
+  pthread_mutex_lock(&s_lock);
+  n = s_live;
+  pthread_mutex_unlock(&s_lock);
+  return n;
+}
+
+static const char *s_n_hex =
+  "FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22514A08798E3404DDEF9519B3CD3A431B"
+  "302B0A6DF25F14374FE1356D6D51C245E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F24117C4B1FE6"
+  "49286651ECE45B3DC2007CB8A163BF0598DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F356208552BB9ED529077096966D"
+  "670C354E4ABC9804F1746C08CA18217C32905E462E36CE3BE39E772C180E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF695581718"
+  "3995497CEA956AE515D2261898FA051015728E5A8AAAC42DAD33170D04507A33A85521ABDF1CBA64ECFB850458DBEF0A8AEA71575D060C7D"
+  "B3970F85A6E1E4C7ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06D98A0864D87602733EC86A64521F2B18177B200C"
+  "BBE117577A615D6C770988C0BAD946E208E24FA074E5AB3143DB5BFCE0FD108E4B82D120A93AD2CAFFFFFFFFFFFFFFFF";
+
+/* fixed operands, the same on every run */
+static ulong64 s_state = 0x9E3779B97F4A7C15ULL;
+
+static ulong64 s_next(void)
+{
+  s_state ^= s_state << 13;
+  s_state ^= s_state >> 7;
+  s_state ^= s_state << 17;
+  return s_state;
+}
+
+/* a = random number of exactly "bits" bits */
+static int s_rand(aws_mp_int *a, int bits)
+{
+  unsigned char buf[384];
+  int           ix, n = (bits + 7) / 8;
+
+  for (ix = 0; ix < n; ix++) {
+    buf[ix] = (unsigned char)s_next();
+  }
+  if ((bits & 7) != 0) {
+    buf[0] &= (unsigned char)((1 << (bits & 7)) - 1);
+  }
+  buf[0] |= (unsigned char)(1 << ((bits - 1) & 7));
+  return aws_mp_read_unsigned_bin(a, buf, n);
+}
+
+typedef struct {
+  aws_mp_int     N, g, b, x, r;
+  aws_mp_mod_ctx ctx;
+  aws_mp_comb    comb;
+} alloc_ops;
+
+typedef int alloc_fn(alloc_ops *o);
+
+static int a_exptmod(alloc_ops *o)    { return aws_mp_exptmod(&o->b, &o->x, &o->N, &o->r); }
+static int a_exptmod_ct(alloc_ops *o) { return aws_mp_exptmod_ct(&o->b, &o->x, &o->N, &o->r); }
+static int a_multi(alloc_ops *o)      { return aws_mp_exptmod_multi(&o->b, &o->x, 1, &o->ctx, &o->r); }
+static int a_comb_ct(alloc_ops *o)    { return aws_mp_exptmod_comb_ct(&o->comb, &o->x, &o->r); }
+
+static const struct {
+  const char *name;
+  alloc_fn   *fn;
+} s_ops[] = {
+  { "exptmod",       a_exptmod },
+  { "exptmod_ct",    a_exptmod_ct },
+  { "exptmod_multi", a_multi },
+  { "exptmod_comb_ct", a_comb_ct },
+};
+
+static const int s_exp_bits[] = { 256, 1024, 3072 };
+
+/* exponentiates on a thread of its own, which exits with its arena */
+static void *s_thread(void *arg)
+{
+  alloc_ops *o = (alloc_ops *)arg;
+
+  if (a_exptmod_ct(o) != AWS_MP_OKAY) {
+    return arg;
+  }
+  return s_mp_scratch.dp == NULL ? arg : NULL;
+}
+
+int main(void)
+{
+  alloc_ops     o;
+  pthread_t     tid;
+  void         *res;
+  unsigned long n, one, per, first;
+  long          live;
+  int           op, size, ix;
+
+  if (aws_mp_init_multi(&o.N, &o.g, &o.b, &o.x, &o.r, NULL) != AWS_MP_OKAY ||
+      aws_mp_read_radix(&o.N, s_n_hex, 16) != AWS_MP_OKAY ||
+      aws_mp_set_int(&o.g, 2) != AWS_MP_OKAY ||
+      s_rand(&o.b, 3000) != AWS_MP_OKAY ||
+      aws_mp_mod_ctx_init_mode(&o.ctx, &o.N, AWS_MP_REDUCE_MONTGOMERY) != AWS_MP_OKAY ||
+      aws_mp_comb_init(&o.comb, &o.g, &o.ctx, 3072, 6) != AWS_MP_OKAY) {
+    fprintf(stderr, "setup failed\n");
+    return EXIT_FAILURE;
+  }
+
+  for (op = 0; op < (int)(sizeof(s_ops) / sizeof(s_ops[0])); op++) {
+    first = 0;
+    for (size = 0; size < (int)(sizeof(s_exp_bits) / sizeof(s_exp_bits[0])); size++) {
+      if (s_rand(&o.x, s_exp_bits[size]) != AWS_MP_OKAY || s_ops[op].fn(&o) != AWS_MP_OKAY ||
+          s_ops[op].fn(&o) != AWS_MP_OKAY) {
+        fprintf(stderr, "%s failed\n", s_ops[op].name);
+        return EXIT_FAILURE;
+      }
+
+      n = s_count();
+      s_ops[op].fn(&o);
+      one = s_count() - n;
+
+      n = s_count();
+      for (ix = 0; ix < ALLOC_ROUNDS; ix++) {
+        s_ops[op].fn(&o);
+      }
+      per = (s_count() - n) / ALLOC_ROUNDS;
+
+      printf("%-16s %4d-bit exponent: %lu allocations per call\n", s_ops[op].name, s_exp_bits[size], one);
+      if (per != one || one > ALLOC_MAX || (size > 0 && one != first)) {
+        printf("%s does not allocate a fixed number of times per call\n", s_ops[op].name);
+        return EXIT_FAILURE;
+      }
+      first = one;
+    }
+  }
+
+  /* the arena of a thread that never releases it goes with the thread */
+  live = s_outstanding();
+  if (pthread_create(&tid, NULL, s_thread, &o) != 0 || pthread_join(tid, &res) != 0) {
+    fprintf(stderr, "no thread\n");
+    return EXIT_FAILURE;
+  }
+  if (res != NULL) {
+    printf("the thread did not use a scratch arena\n");
+    return EXIT_FAILURE;
+  }
+  if (s_outstanding() != live) {
+    printf("a thread exited and left %ld blocks behind\n", s_outstanding() - live);
+    return EXIT_FAILURE;
+  }
+  printf("a thread's scratch arena is freed when it exits\n");
+
+  aws_mp_comb_clear(&o.comb);
+  aws_mp_mod_ctx_clear(&o.ctx);
+  aws_mp_clear_multi(&o.N, &o.g, &o.b, &o.x, &o.r, NULL);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,344 @@
+/* Benchmarks for the LibTomMath core
+ *
+ * The library is compiled into this file so the heap can be counted, build it
+ * with the same compiler and flags as the library:
+ *
+ *    make bench
+ *    ./bench [seconds per measurement] [operation] > run.json
+ *
+ * Most operations are timed over operand sizes from 256 to 8192 bits and reported
+ * as JSON, one result per line, in ns/op, cycles/op [x86 only, null elsewhere]
+ * and heap allocations/op.  The operands come from a fixed xorshift sequence,
+ * not rand(), so two runs on different commits time the very same numbers.
+ * One invmod_batch inverts BENCH_BATCH values, compare it to BENCH_BATCH times
+ * the invmod figure.  exptmod_comb raises g = 2 with a comb of BENCH_TEETH
+ * teeth built once per size, next to exptmod_fast [the sliding window with
+ * the Montgomery setup on every call] on the same exponents.  exptmod_ct is
+ * the constant-time fixed window on those exponents too, its cycles/op over
+ * those of exptmod_fast is the price of not leaking the exponent.
+ * exptmod_batch_tN raises BENCH_BATCH bases to as many full size exponents
+ * with one aws_mp_exptmod_batch on N threads [_tall on every online core],
+ * from 1024 to 4096 bits; its ns/op over that of _t1 shows how the batch
+ * scales with the threads.
+ *
+ * The *_toom and *_ntt operations call Toom-Cook and the transforms directly,
+ * from 16384 bits up to BENCH_MAX_BITS, next to mul and sqr on the same
+ * sizes, which shows where the transform cutoff falls.  The radix
+ * conversions go on to 66439 bits [20000 decimal digits, 33220 bits is
+ * 10000], where the divide and conquer converters pay off most.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_BATCH 64
+#define BENCH_TEETH 6
+#define BENCH_STR   (BENCH_MAX_BITS / 3 + 16)   /* chars of the longest string */
+#define BENCH_MAX_BITS (1 << 20)
+
+#define AWS_XMALLOC  bench_malloc
+#define AWS_XFREE    bench_free
+#define AWS_XREALLOC bench_realloc
+#define AWS_XCALLOC  bench_calloc
+#include "tommath.c"
+
+#if defined(__x86_64__) || defined(__i386__)
+   #include <x86intrin.h>
+   #define BENCH_CYCLES()   ((double)__rdtsc())
+#else
+   #define BENCH_CYCLES()   (-1.0)
+#endif
+
+/* the batch workers allocate too */
+#if defined(__GNUC__) || defined(__clang__)
+   #define BENCH_COUNT()    __atomic_fetch_add(&s_allocs, 1, __ATOMIC_RELAXED)
+#else
+   #define BENCH_COUNT()    (++s_allocs)
+#endif
+
+static unsigned long s_allocs;
+
+void *bench_malloc(size_t n)
+{
+  BENCH_COUNT();
+  return malloc(n);
+}
+
+void *bench_realloc(void *p, size_t n)
+{
+  BENCH_COUNT();
+  return realloc(p, n);
+}
+
+void *bench_calloc(size_t n, size_t s)
+{
+  BENCH_COUNT();
+  return calloc(n, s);
+}
+
+void bench_free(void *p)
+{
+  free(p);
+}
+
+static double s_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* fixed operands, the same on every run */
+static ulong64 s_state = 0x9E3779B97F4A7C15ULL;
+
+static ulong64 s_next(void)
+{
+  s_state ^= s_state << 13;
+  s_state ^= s_state >> 7;
+  s_state ^= s_state << 17;
+  return s_state;
+}
+
+/* a = random number of exactly "bits" bits */
+static void s_rand(aws_mp_int *a, int bits)
+{
+  static unsigned char buf[2 * BENCH_MAX_BITS / 8];
+  int                  ix, n = (bits + 7) / 8;
+
+  for (ix = 0; ix < n; ix++) {
+    buf[ix] = (unsigned char)s_next();
+  }
+  if ((bits & 7) != 0) {
+    buf[0] &= (unsigned char)((1 << (bits & 7)) - 1);
+  }
+  buf[0] |= (unsigned char)(1 << ((bits - 1) & 7));
+  if (aws_mp_read_unsigned_bin(a, buf, n) != AWS_MP_OKAY) {
+    fprintf(stderr, "out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+typedef struct {
+  aws_mp_int     a, b, m, e, r, q;
+  aws_mp_int     v[BENCH_BATCH], w[BENCH_BATCH], x[BENCH_BATCH];
+  aws_mp_mod_ctx ctx;
+  aws_mp_comb    comb;
+  char          *dec, *hex, *str;
+} bench_ops;
+
+typedef int bench_fn(bench_ops *o);
+
+static int b_mul(bench_ops *o)     { return aws_mp_mul(&o->a, &o->b, &o->r); }
+static int b_sqr(bench_ops *o)     { return aws_mp_sqr(&o->a, &o->r); }
+static int b_div(bench_ops *o)     { return aws_mp_div(&o->q, &o->m, &o->r, &o->e); }
+static int b_exptmod(bench_ops *o) { return aws_mp_exptmod(&o->a, &o->e, &o->m, &o->r); }
+static int b_exptmod_fast(bench_ops *o) { return aws_mp_exptmod_fast(&o->a, &o->e, &o->m, &o->r, 0); }
+static int b_exptmod_comb(bench_ops *o) { return aws_mp_exptmod_comb(&o->comb, &o->e, &o->r); }
+static int b_exptmod_ct(bench_ops *o)   { return aws_mp_exptmod_ct(&o->a, &o->e, &o->m, &o->r); }
+static int b_invmod(bench_ops *o)  { return aws_mp_invmod(&o->a, &o->m, &o->r); }
+static int b_invmod_batch(bench_ops *o) { return aws_mp_invmod_batch(o->v, o->w, BENCH_BATCH, &o->ctx); }
+static int b_batch(bench_ops *o, int threads)
+{
+  return aws_mp_exptmod_batch(o->v, o->x, o->w, BENCH_BATCH, &o->ctx, threads);
+}
+static int b_batch1(bench_ops *o)  { return b_batch(o, 1); }
+static int b_batch2(bench_ops *o)  { return b_batch(o, 2); }
+static int b_batch4(bench_ops *o)  { return b_batch(o, 4); }
+static int b_batch8(bench_ops *o)  { return b_batch(o, 8); }
+static int b_batch_all(bench_ops *o) { return b_batch(o, 0); }
+static int b_gcd(bench_ops *o)     { return aws_mp_gcd(&o->a, &o->b, &o->r); }
+static int b_to10(bench_ops *o)    { return aws_mp_toradix(&o->a, o->str, 10); }
+static int b_read10(bench_ops *o)  { return aws_mp_read_radix(&o->r, o->dec, 10); }
+static int b_to16(bench_ops *o)    { return aws_mp_toradix(&o->a, o->str, 16); }
+static int b_read16(bench_ops *o)  { return aws_mp_read_radix(&o->r, o->hex, 16); }
+static int b_mul_toom(bench_ops *o) { return aws_mp_toom_mul(&o->a, &o->b, &o->r); }
+static int b_mul_ntt(bench_ops *o)  { return aws_mp_ntt_mul(&o->a, &o->b, &o->r); }
+static int b_sqr_toom(bench_ops *o) { return aws_mp_toom_sqr(&o->a, &o->r); }
+static int b_sqr_ntt(bench_ops *o)  { return aws_mp_ntt_sqr(&o->a, &o->r); }
+
+/* what s_setup prepares and which sizes are timed */
+enum { BENCH_SMALL, BENCH_LARGE, BENCH_RADIX, BENCH_SCALE };
+
+static const struct {
+  const char *name;
+  bench_fn   *fn;
+  int         sizes;    /* row of s_sizes it is timed on */
+} s_ops[] = {
+  { "mul",        b_mul, BENCH_SMALL },
+  { "sqr",        b_sqr, BENCH_SMALL },
+  { "div",        b_div, BENCH_SMALL },
+  { "exptmod",    b_exptmod, BENCH_SMALL },
+  { "exptmod_fast", b_exptmod_fast, BENCH_SMALL },
+  { "exptmod_comb", b_exptmod_comb, BENCH_SMALL },
+  { "exptmod_ct", b_exptmod_ct, BENCH_SMALL },
+  { "invmod",     b_invmod, BENCH_SMALL },
+  { "invmod_batch", b_invmod_batch, BENCH_SMALL },
+  { "gcd",        b_gcd, BENCH_SMALL },
+  { "exptmod_batch_t1", b_batch1, BENCH_SCALE },
+  { "exptmod_batch_t2", b_batch2, BENCH_SCALE },
+  { "exptmod_batch_t4", b_batch4, BENCH_SCALE },
+  { "exptmod_batch_t8", b_batch8, BENCH_SCALE },
+  { "exptmod_batch_tall", b_batch_all, BENCH_SCALE },
+  { "toradix10",  b_to10, BENCH_RADIX },
+  { "read_radix10", b_read10, BENCH_RADIX },
+  { "toradix16",  b_to16, BENCH_RADIX },
+  { "read_radix16", b_read16, BENCH_RADIX },
+  { "mul",        b_mul, BENCH_LARGE },
+  { "mul_toom",   b_mul_toom, BENCH_LARGE },
+  { "mul_ntt",    b_mul_ntt, BENCH_LARGE },
+  { "sqr",        b_sqr, BENCH_LARGE },
+  { "sqr_toom",   b_sqr_toom, BENCH_LARGE },
+  { "sqr_ntt",    b_sqr_ntt, BENCH_LARGE },
+};
+
+#define BENCH_SIZES 7
+
+/* a row ends early at a 0 */
+static const int s_sizes[][BENCH_SIZES] = {
+  { 256, 512, 1024, 2048, 3072, 4096, 8192 },
+  { 16384, 32768, 65536, 131072, 262144, 524288, BENCH_MAX_BITS },
+  { 256, 1024, 4096, 8192, 16384, 33220, 66439 },
+  { 1024, 2048, 3072, 4096 },
+};
+
+/* a = a mod m, stepped up until it is invertible */
+static void s_unit(aws_mp_int *a, aws_mp_int *m)
+{
+  aws_mp_int g;
+
+  aws_mp_init(&g);
+  aws_mp_mod(a, m, a);
+  for (;;) {
+    aws_mp_gcd(a, m, &g);
+    if (aws_mp_cmp_d(&g, 1) == AWS_MP_EQ) {
+      break;
+    }
+    aws_mp_add_d(a, 1, a);
+  }
+  aws_mp_clear(&g);
+}
+
+/* sets up the operands of one kind of operation for one size */
+static void s_setup(bench_ops *o, int bits, int sizes)
+{
+  aws_mp_int g;
+  int        ix;
+
+  s_rand(&o->a, bits);
+  s_rand(&o->b, bits);
+  if (sizes == BENCH_LARGE) {
+    return;
+  } else if (sizes == BENCH_RADIX) {
+    aws_mp_toradix(&o->a, o->dec, 10);
+    aws_mp_toradix(&o->a, o->hex, 16);
+    return;
+  }
+  s_rand(&o->e, bits);
+  s_rand(&o->q, 2 * bits);
+
+  /* odd modulus the bases are invertible against, a < m */
+  s_rand(&o->m, bits);
+  o->m.dp[0] |= 1;
+  s_unit(&o->a, &o->m);
+  for (ix = 0; ix < BENCH_BATCH; ix++) {
+    s_rand(&o->v[ix], bits);
+    s_unit(&o->v[ix], &o->m);
+    s_rand(&o->x[ix], bits);
+  }
+  if (aws_mp_mod_ctx_init(&o->ctx, &o->m) != AWS_MP_OKAY ||
+      aws_mp_init_set(&g, 2) != AWS_MP_OKAY ||
+      aws_mp_comb_init(&o->comb, &g, &o->ctx, bits, BENCH_TEETH) != AWS_MP_OKAY) {
+    fprintf(stderr, "out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  aws_mp_clear(&g);
+
+}
+
+int main(int argc, char **argv)
+{
+  bench_ops     o;
+  double        min_time = 0.2, t, c;
+  unsigned long allocs, n, ix;
+  int           op, size, bits, err, first = 1;
+
+  if (argc > 1) {
+    min_time = atof(argv[1]);
+  }
+
+  aws_mp_init_multi(&o.a, &o.b, &o.m, &o.e, &o.r, &o.q, NULL);
+  for (ix = 0; ix < BENCH_BATCH; ix++) {
+    aws_mp_init_multi(&o.v[ix], &o.w[ix], &o.x[ix], NULL);
+  }
+  o.dec = malloc(BENCH_STR);
+  o.hex = malloc(BENCH_STR);
+  o.str = malloc(BENCH_STR);
+
+  printf("{\"digit_bit\": %d, \"results\": [\n", AWS_DIGIT_BIT);
+  for (op = 0; op < (int)(sizeof(s_ops) / sizeof(s_ops[0])); op++) {
+    if (argc > 2 && strcmp(argv[2], s_ops[op].name) != 0) {
+      continue;
+    }
+    for (size = 0; size < BENCH_SIZES; size++) {
+      if ((bits = s_sizes[s_ops[op].sizes][size]) == 0) {
+        break;
+      }
+      s_setup(&o, bits, s_ops[op].sizes);
+
+      /* warm up, so buffers have grown and the scratch arena is sized, and
+       * leave out the sizes an operation doesn't take [exptmod_ct past
+       * AWS_MP_MONTGOMERY_DIGS]
+       */
+      if ((err = s_ops[op].fn(&o)) == AWS_MP_VAL) {
+        goto LBL_NEXT;
+      } else if (err != AWS_MP_OKAY) {
+        fprintf(stderr, "%s failed at %d bits\n", s_ops[op].name, bits);
+        return EXIT_FAILURE;
+      }
+
+      /* double the count until one batch takes min_time */
+      for (n = 1;; n *= 2) {
+        allocs = s_allocs;
+        c = BENCH_CYCLES();
+        t = s_now();
+        for (ix = 0; ix < n; ix++) {
+          s_ops[op].fn(&o);
+        }
+        t = s_now() - t;
+        c = BENCH_CYCLES() - c;
+        allocs = s_allocs - allocs;
+        if (t >= min_time) {
+          break;
+        }
+      }
+
+      printf("%s  {\"op\": \"%s\", \"bits\": %d, \"ns_per_op\": %.1f, ", first ? "" : ",\n",
+             s_ops[op].name, bits, t * 1e9 / (double)n);
+      if (BENCH_CYCLES() < 0) {
+        printf("\"cycles_per_op\": null, ");
+      } else {
+        printf("\"cycles_per_op\": %.0f, ", c / (double)n);
+      }
+      printf("\"allocs_per_op\": %.2f}", (double)allocs / (double)n);
+      fflush(stdout);
+      first = 0;
+LBL_NEXT:
+      if (s_ops[op].sizes == BENCH_SMALL || s_ops[op].sizes == BENCH_SCALE) {
+        aws_mp_comb_clear(&o.comb);
+        aws_mp_mod_ctx_clear(&o.ctx);
+      }
+    }
+  }
+  printf("\n]}\n");
+
+  aws_mp_clear_multi(&o.a, &o.b, &o.m, &o.e, &o.r, &o.q, NULL);
+  for (ix = 0; ix < BENCH_BATCH; ix++) {
+    aws_mp_clear_multi(&o.v[ix], &o.w[ix], &o.x[ix], NULL);
+  }
+  free(o.dec);
+  free(o.hex);
+  free(o.str);
+  return EXIT_SUCCESS;
+}
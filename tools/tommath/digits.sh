@@ -0,0 +1,29 @@
+#!/bin/sh
+# Compare the 28-bit and 60-bit digit builds on aws_mp_exptmod
+#
+#    make digits [or ./digits.sh [seconds per measurement] after make bench bench28]
+#
+# Runs the exptmod rows of bench and bench28 [the same benchmark built with
+# AWS_MP_28BIT] and prints both times side by side for the sizes an SRP group
+# comes in.  The raw JSON of both runs is left in bench28.json and bench60.json.
+
+secs=${1:-0.5}
+
+./bench28 "$secs" exptmod > bench28.json || exit 1
+./bench "$secs" exptmod > bench60.json || exit 1
+
+cat bench28.json bench60.json | awk '
+  /"digit_bit"/ { split($0, f, /[:,]/); digits = f[2] + 0 }
+  /"op": "exptmod"/ {
+    split($0, f, /[:,]/)
+    bits = f[4] + 0
+    ns[digits, bits] = f[6] + 0
+  }
+  END {
+    printf "%6s  %12s  %12s  %7s\n", "bits", "28-bit us", "60-bit us", "28/60"
+    n = split("2048 3072 4096", size, " ")
+    for (i = 1; i <= n; i++) {
+      b = size[i]
+      printf "%6d  %12.1f  %12.1f  %7.2f\n", b, ns[28, b] / 1e3, ns[60, b] / 1e3, ns[28, b] / ns[60, b]
+    }
+  }'
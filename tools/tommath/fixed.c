@@ -0,0 +1,255 @@
+/* Write the fixed width Montgomery kernels for one modulus size
+ *
+ * The fused Montgomery routines run the same few loops for every modulus and
+ * test the digit counts of the operands in every row.  For the one modulus
+ * size an application uses all the time [the 3072-bit SRP group] this tool
+ * writes the rows out for exactly that many digits, once for 60-bit and once
+ * for 28-bit digits:
+ *
+ *    make fixed
+ *    ./fixed 3072 $LTM/aws_tommath_fixed.h
+ *
+ * and build the library with AWS_MP_FIXED_BITS set to the same size [3072 is
+ * the default].  Without a file name the header goes to stdout.
+ *
+ * Each row of the multiplication, the squaring and the reduction is written
+ * out digit by digit, the loop over the rows is kept: a fully unrolled 3072-bit
+ * multiplication is 2n**2 statements, over 100KB of code with 28-bit digits,
+ * which would no longer fit the instruction cache the loop it replaces ran from.
+ * The carry resolution and the final subtraction are written out in full.
+ *
+ * All three keep the n column window of the CIOS kernels in memory and write
+ * each column once per row.  Shapes where a row only adds into some of the
+ * columns [a second pass for the cross products of the square, or the classic
+ * reduction that moves its window up instead of shifting the columns down]
+ * let the compiler carry the columns across rows in registers, and with 50 to
+ * 110 of them that spills far worse than the loops ever did.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+static FILE *s_out;
+
+/* the digit sizes a header is written for, in the order they are tested */
+static const int s_digit_bits[] = { 60, 28 };
+
+/* W = abR**-1 as n uncarried columns, a and b padded to n digits */
+static void s_mul(int n)
+{
+  int iy;
+
+  fprintf(s_out,
+          "/* W = abR**-1 (mod m) as %d uncarried columns, see s_mp_montgomery_mul_cols */\n"
+          "static void s_mp_fixed_mul_cols(const aws_mp_digit *a, const aws_mp_digit *b, const aws_mp_digit *m,\n"
+          "                                aws_mp_digit mp, aws_mp_word *W)\n"
+          "{\n"
+          "  int ix;\n"
+          "  register aws_mp_digit bi, mu;\n"
+          "  register aws_mp_word  r;\n"
+          "\n"
+          "  for (ix = 0; ix < %d; ix++) {\n"
+          "    W[ix] = 0;\n"
+          "  }\n"
+          "\n"
+          "  /* the top column only ever holds zero and is not touched */\n"
+          "  for (ix = 0; ix < %d; ix++) {\n"
+          "    bi = b[ix];\n"
+          "    r  = W[0] + ((aws_mp_word)bi) * ((aws_mp_word)a[0]);\n"
+          "    mu = (aws_mp_digit)(((r & ((aws_mp_word)AWS_MP_MASK)) * ((aws_mp_word)mp)) & ((aws_mp_word)AWS_MP_MASK));\n"
+          "    r  = (r + ((aws_mp_word)mu) * ((aws_mp_word)m[0])) >> ((aws_mp_word)AWS_DIGIT_BIT);\n",
+          n, n, n);
+  for (iy = 1; iy < n - 1; iy++) {
+    fprintf(s_out,
+            "    W[%d] = W[%d] + ((aws_mp_word)bi) * ((aws_mp_word)a[%d]) + ((aws_mp_word)mu) * ((aws_mp_word)m[%d]);\n",
+            iy - 1, iy, iy, iy);
+  }
+  fprintf(s_out,
+          "    W[%d] = ((aws_mp_word)bi) * ((aws_mp_word)a[%d]) + ((aws_mp_word)mu) * ((aws_mp_word)m[%d]);\n"
+          "    W[0] += r;\n"
+          "  }\n"
+          "}\n\n",
+          n - 2, n - 1, n - 1);
+}
+
+/* W = aaR**-1 as n uncarried columns
+ *
+ * Row ix only adds products to the columns from ix up, the columns below it
+ * just shift with the reduction.  That part runs as a loop, the rest of the
+ * row is entered with a switch at the column of the square.
+ */
+static void s_sqr(int n)
+{
+  int iy;
+
+  fprintf(s_out,
+          "/* W = aaR**-1 (mod m) as %d uncarried columns, see s_mp_montgomery_sqr_cols\n"
+          " *\n"
+          " * The columns below ix only see the reduction, the square of a[ix] and its\n"
+          " * doubled products with the digits above start at column ix, so the row is\n"
+          " * entered there.\n"
+          " */\n"
+          "static void s_mp_fixed_sqr_cols(const aws_mp_digit *a, const aws_mp_digit *m, aws_mp_digit mp, aws_mp_word *W)\n"
+          "{\n"
+          "  int ix, iy;\n"
+          "  register aws_mp_digit ai, mu;\n"
+          "  register aws_mp_word  r;\n"
+          "  aws_mp_digit a2[%d];\n"
+          "\n"
+          "  /* a digit and its double both fit an aws_mp_digit, so 2a[iy] is taken once */\n"
+          "  for (ix = 0; ix < %d; ix++) {\n"
+          "    W[ix]  = 0;\n"
+          "    a2[ix] = a[ix] << 1;\n"
+          "  }\n"
+          "\n"
+          "  for (ix = 0; ix < %d; ix++) {\n"
+          "    ai = a[ix];\n"
+          "    r  = W[0];\n"
+          "    if (ix == 0) {\n"
+          "      r += ((aws_mp_word)ai) * ((aws_mp_word)ai);\n"
+          "    }\n"
+          "    mu = (aws_mp_digit)(((r & ((aws_mp_word)AWS_MP_MASK)) * ((aws_mp_word)mp)) & ((aws_mp_word)AWS_MP_MASK));\n"
+          "    r  = (r + ((aws_mp_word)mu) * ((aws_mp_word)m[0])) >> ((aws_mp_word)AWS_DIGIT_BIT);\n"
+          "\n"
+          "    for (iy = 1; iy < ix; iy++) {\n"
+          "      W[iy - 1] = W[iy] + ((aws_mp_word)mu) * ((aws_mp_word)m[iy]);\n"
+          "    }\n"
+          "    if (ix > 0) {\n"
+          "      W[ix - 1] = W[ix] + ((aws_mp_word)ai) * ((aws_mp_word)ai) + ((aws_mp_word)mu) * ((aws_mp_word)m[ix]);\n"
+          "    }\n"
+          "\n"
+          "    switch (ix) {\n",
+          n, n, n, n);
+  for (iy = 1; iy < n - 1; iy++) {
+    fprintf(s_out,
+            "    case %d: W[%d] = W[%d] + ((aws_mp_word)ai) * ((aws_mp_word)a2[%d]) + ((aws_mp_word)mu) * ((aws_mp_word)m[%d]); /* fall through */\n",
+            iy - 1, iy - 1, iy, iy, iy);
+  }
+  fprintf(s_out,
+          "    case %d: W[%d] = ((aws_mp_word)ai) * ((aws_mp_word)a2[%d]) + ((aws_mp_word)mu) * ((aws_mp_word)m[%d]); /* fall through */\n"
+          "    default: break;\n"
+          "    }\n"
+          "    W[0] += r;\n"
+          "  }\n"
+          "}\n\n",
+          n - 2, n - 2, n - 1, n - 1);
+}
+
+/* c = W with the carries resolved, less m if that is not negative */
+static void s_out_digits(int n)
+{
+  int iy;
+
+  fprintf(s_out,
+          "/* c = W with the carries resolved and m subtracted unless that borrows,\n"
+          " * both results are formed and one is picked by mask\n"
+          " */\n"
+          "static void s_mp_fixed_out(aws_mp_word *W, const aws_mp_digit *m, aws_mp_digit *c)\n"
+          "{\n"
+          "  register aws_mp_word  r;\n"
+          "  register aws_mp_digit d, u, mask;\n"
+          "  aws_mp_digit t[%d];\n"
+          "\n"
+          "  r = 0;\n"
+          "  u = 0;\n",
+          n);
+  for (iy = 0; iy < n; iy++) {
+    fprintf(s_out,
+            "  r += W[%d]; c[%d] = (aws_mp_digit)(r & ((aws_mp_word)AWS_MP_MASK)); r >>= ((aws_mp_word)AWS_DIGIT_BIT);\n"
+            "  d = c[%d] - m[%d] - u; u = d >> (sizeof(aws_mp_digit) * CHAR_BIT - 1); t[%d] = d & AWS_MP_MASK;\n",
+            iy, iy, iy, iy, iy);
+  }
+  fprintf(s_out,
+          "\n"
+          "  /* keep c only if c - m went negative, i.e. borrowed past the top digit */\n"
+          "  mask = (aws_mp_digit)0 - (u & (((aws_mp_digit)r) ^ 1u));\n");
+  for (iy = 0; iy < n; iy++) {
+    fprintf(s_out, "  c[%d] = (c[%d] & mask) | (t[%d] & ~mask);\n", iy, iy, iy);
+  }
+  fprintf(s_out, "}\n\n");
+}
+
+/* W = xR**-1 as n uncarried columns, x padded to 2n digits
+ *
+ * The same window as the multiplication: every row shifts it down one column
+ * and the next digit of x enters at the top.
+ */
+static void s_reduce(int n)
+{
+  int iy;
+
+  fprintf(s_out,
+          "/* W = xR**-1 (mod m) as %d uncarried columns for x < mR padded to %d digits,\n"
+          " * see aws_fast_mp_montgomery_reduce\n"
+          " */\n"
+          "static void s_mp_fixed_reduce_cols(const aws_mp_digit *x, const aws_mp_digit *m, aws_mp_digit rho, aws_mp_word *W)\n"
+          "{\n"
+          "  int ix;\n"
+          "  register aws_mp_digit mu;\n"
+          "  register aws_mp_word  r;\n"
+          "\n"
+          "  for (ix = 0; ix < %d; ix++) {\n"
+          "    W[ix] = x[ix];\n"
+          "  }\n"
+          "\n"
+          "  for (ix = 0; ix < %d; ix++) {\n"
+          "    r  = W[0];\n"
+          "    mu = (aws_mp_digit)(((r & ((aws_mp_word)AWS_MP_MASK)) * ((aws_mp_word)rho)) & ((aws_mp_word)AWS_MP_MASK));\n"
+          "    r  = (r + ((aws_mp_word)mu) * ((aws_mp_word)m[0])) >> ((aws_mp_word)AWS_DIGIT_BIT);\n",
+          n, 2 * n, n, n);
+  for (iy = 1; iy < n; iy++) {
+    fprintf(s_out, "    W[%d] = W[%d] + ((aws_mp_word)mu) * ((aws_mp_word)m[%d]);\n", iy - 1, iy, iy);
+  }
+  fprintf(s_out,
+          "    W[%d] = x[ix + %d];\n"
+          "    W[0] += r;\n"
+          "  }\n"
+          "}\n\n",
+          n - 1, n);
+}
+
+int main(int argc, char **argv)
+{
+  int bits, n, ix;
+
+  if (argc < 2 || (bits = atoi(argv[1])) < 64) {
+    fprintf(stderr, "usage: %s bits [header]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  s_out = stdout;
+  if (argc > 2 && (s_out = fopen(argv[2], "w")) == NULL) {
+    perror(argv[2]);
+    return EXIT_FAILURE;
+  }
+
+  fprintf(s_out,
+          "/* Montgomery kernels for %d-bit moduli, written by tools/tommath/fixed.c -- do not edit\n"
+          " *\n"
+          " *    cd tools/tommath && make fixed && ./fixed %d $LTM/aws_tommath_fixed.h\n"
+          " *\n"
+          " * Only the section for the AWS_DIGIT_BIT the library is built with is used,\n"
+          " * and only when AWS_MP_FIXED_BITS is %d.  It defines AWS_MP_FIXED_DIGS, the\n"
+          " * digit count of the moduli the kernels are for.\n"
+          " */\n",
+          bits, bits, bits);
+
+  for (ix = 0; ix < (int)(sizeof(s_digit_bits) / sizeof(s_digit_bits[0])); ix++) {
+    n = (bits + s_digit_bits[ix] - 1) / s_digit_bits[ix];
+    fprintf(s_out,
+            "\n%s AWS_MP_FIXED_BITS == %d && AWS_DIGIT_BIT == %d\n"
+            "\n"
+            "#define AWS_MP_FIXED_DIGS %d\n"
+            "\n",
+            ix == 0 ? "#if" : "#elif", bits, s_digit_bits[ix], n);
+    s_mul(n);
+    s_sqr(n);
+    s_out_digits(n);
+    s_reduce(n);
+  }
+  fprintf(s_out, "#endif\n");
+
+  if (s_out != stdout && fclose(s_out) != 0) {
+    perror(argv[2]);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
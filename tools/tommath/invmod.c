@@ -0,0 +1,295 @@
+/* Check aws_mp_invmod_batch against aws_mp_invmod one value at a time
+ *
+ *    make invmod
+ *    ./invmod
+ *
+ * For odd, even, prime, composite, single digit and pseudo-Mersenne moduli,
+ * with the context aws_mp_mod_ctx_init() picks and with Montgomery and
+ * Barrett ones, batches of INVMOD_SIZES values are inverted at once and each
+ * inverse must be the one aws_mp_invmod() gives for that value alone.  The
+ * values are negative and above the modulus too, the inverses are written
+ * to a second array and in place.  Batches with duplicates [the same value,
+ * and one differing by a multiple of the modulus] must agree as well.  A
+ * batch with a zero [0, N or -2N] or, for composite moduli, a value sharing
+ * a factor with N in it must fail with AWS_MP_VAL, the single inversion of
+ * that value failing too.
+ *
+ * The exit status is nonzero on the first disagreement.
+ */
+#include "aws_tommath.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define INVMOD_MAX 33
+
+static const int s_sizes[] = { 1, 2, 7, INVMOD_MAX };
+
+static const char *s_n_hex =
+  "FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22514A08798E3404DDEF9519B3CD3A431B"
+  "302B0A6DF25F14374FE1356D6D51C245E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F24117C4B1FE6"
+  "49286651ECE45B3DC2007CB8A163BF0598DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F356208552BB9ED529077096966D"
+  "670C354E4ABC9804F1746C08CA18217C32905E462E36CE3BE39E772C180E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF695581718"
+  "3995497CEA956AE515D2261898FA051015728E5A8AAAC42DAD33170D04507A33A85521ABDF1CBA64ECFB850458DBEF0A8AEA71575D060C7D"
+  "B3970F85A6E1E4C7ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06D98A0864D87602733EC86A64521F2B18177B200C"
+  "BBE117577A615D6C770988C0BAD946E208E24FA074E5AB3143DB5BFCE0FD108E4B82D120A93AD2CAFFFFFFFFFFFFFFFF";
+
+/* fixed values, the same on every run */
+static ulong64 s_state = 0x9E3779B97F4A7C15ULL;
+
+static ulong64 s_next(void)
+{
+  s_state ^= s_state << 13;
+  s_state ^= s_state >> 7;
+  s_state ^= s_state << 17;
+  return s_state;
+}
+
+/* a = random number of 1 to "bits" bits, either sign */
+static int s_rand(aws_mp_int *a, int bits)
+{
+  unsigned char buf[512];
+  int           ix, n;
+
+  bits = 1 + (int)(s_next() % (ulong64)bits);
+  n = (bits + 7) / 8;
+  for (ix = 0; ix < n; ix++) {
+    buf[ix] = (unsigned char)s_next();
+  }
+  if ((bits & 7) != 0) {
+    buf[0] &= (unsigned char)((1 << (bits & 7)) - 1);
+  }
+  if ((ix = aws_mp_read_unsigned_bin(a, buf, n)) != AWS_MP_OKAY) {
+    return ix;
+  }
+  return ((s_next() & 3) == 0) ? aws_mp_neg(a, a) : AWS_MP_OKAY;
+}
+
+/* a = random value with an inverse mod N */
+static int s_unit(aws_mp_int *a, aws_mp_int *N, aws_mp_int *g)
+{
+  int err;
+
+  do {
+    if ((err = s_rand(a, aws_mp_count_bits(N) + 20)) != AWS_MP_OKAY ||
+        (err = aws_mp_gcd(a, N, g)) != AWS_MP_OKAY) {
+      return err;
+    }
+  } while (aws_mp_cmp_d(g, 1) != AWS_MP_EQ);
+  return AWS_MP_OKAY;
+}
+
+typedef struct {
+  const char *name;
+  aws_mp_int  N, factor;   /* factor of N, zero for primes */
+} invmod_modulus;
+
+static aws_mp_int s_a[INVMOD_MAX], s_b[INVMOD_MAX], s_r, s_g;
+static int        s_checks;
+
+/* inverts a[0..n-1] into out [s_b, or s_a itself] and compares it with aws_mp_invmod() */
+static int s_agree(invmod_modulus *m, aws_mp_mod_ctx *ctx, const char *mode, int n, aws_mp_int *out)
+{
+  aws_mp_int save[INVMOD_MAX];
+  int        ix, err;
+
+  for (ix = 0; ix < n; ix++) {
+    if (aws_mp_init_copy(&save[ix], &s_a[ix]) != AWS_MP_OKAY) {
+      return AWS_MP_MEM;
+    }
+  }
+  if ((err = aws_mp_invmod_batch(s_a, out, n, ctx)) != AWS_MP_OKAY) {
+    printf("%s, %s, %d values: the batch failed, %s\n", m->name, mode, n, aws_mp_error_to_string(err));
+    return AWS_MP_VAL;
+  }
+  for (ix = 0; ix < n; ix++) {
+    if ((err = aws_mp_invmod(&save[ix], &m->N, &s_r)) != AWS_MP_OKAY) {
+      return err;
+    }
+    if (aws_mp_cmp(&s_r, &out[ix]) != AWS_MP_EQ) {
+      printf("%s, %s, %d values%s: value %d differs from aws_mp_invmod\n", m->name, mode, n,
+             out == s_a ? " in place" : "", ix);
+      return AWS_MP_VAL;
+    }
+    ++s_checks;
+  }
+  for (ix = 0; ix < n; ix++) {
+    aws_mp_exch(&save[ix], &s_a[ix]);
+    aws_mp_clear(&save[ix]);
+  }
+  return AWS_MP_OKAY;
+}
+
+/* value z of the batch has no inverse: the batch and aws_mp_invmod() of it must both fail */
+static int s_refused(invmod_modulus *m, aws_mp_mod_ctx *ctx, const char *mode, int n, int z, const char *what)
+{
+  int err;
+
+  if (aws_mp_invmod(&s_a[z], &m->N, &s_r) != AWS_MP_VAL) {
+    printf("%s, %s: aws_mp_invmod inverts %s\n", m->name, mode, what);
+    return AWS_MP_VAL;
+  }
+  if ((err = aws_mp_invmod_batch(s_a, s_b, n, ctx)) != AWS_MP_VAL) {
+    printf("%s, %s, %d values: a batch with %s gives %s\n", m->name, mode, n, what, aws_mp_error_to_string(err));
+    return AWS_MP_VAL;
+  }
+  ++s_checks;
+  return AWS_MP_OKAY;
+}
+
+static int s_check(invmod_modulus *m, aws_mp_mod_ctx *ctx, const char *mode)
+{
+  int size, n, ix, z, err;
+
+  for (size = 0; size < (int)(sizeof(s_sizes) / sizeof(s_sizes[0])); size++) {
+    n = s_sizes[size];
+
+    /* distinct values, into a second array and in place */
+    for (ix = 0; ix < n; ix++) {
+      if ((err = s_unit(&s_a[ix], &m->N, &s_g)) != AWS_MP_OKAY) {
+        return err;
+      }
+    }
+    if ((err = s_agree(m, ctx, mode, n, s_b)) != AWS_MP_OKAY ||
+        (err = s_agree(m, ctx, mode, n, s_a)) != AWS_MP_OKAY) {
+      return err;
+    }
+
+    /* duplicates, as they are and off by a multiple of N */
+    for (ix = 1; ix < n; ix++) {
+      if ((ix & 1) != 0) {
+        err = aws_mp_copy(&s_a[0], &s_a[ix]);
+      } else {
+        err = aws_mp_mul_d(&m->N, (aws_mp_digit)ix, &s_r) == AWS_MP_OKAY ? aws_mp_add(&s_a[0], &s_r, &s_a[ix]) : AWS_MP_MEM;
+      }
+      if (err != AWS_MP_OKAY) {
+        return err;
+      }
+    }
+    if ((err = s_agree(m, ctx, mode, n, s_b)) != AWS_MP_OKAY) {
+      return err;
+    }
+
+    /* a zero anywhere in the batch */
+    z = (int)(s_next() % (ulong64)n);
+    aws_mp_zero(&s_a[z]);
+    if ((err = s_refused(m, ctx, mode, n, z, "0")) != AWS_MP_OKAY) {
+      return err;
+    }
+    if ((err = aws_mp_copy(&m->N, &s_a[z])) != AWS_MP_OKAY ||
+        (err = s_refused(m, ctx, mode, n, z, "N")) != AWS_MP_OKAY) {
+      return err;
+    }
+    if ((err = aws_mp_mul_2(&m->N, &s_a[z])) != AWS_MP_OKAY || (err = aws_mp_neg(&s_a[z], &s_a[z])) != AWS_MP_OKAY ||
+        (err = s_refused(m, ctx, mode, n, z, "-2N")) != AWS_MP_OKAY) {
+      return err;
+    }
+
+    /* a value sharing a factor with N */
+    if (aws_mp_iszero(&m->factor) == 0) {
+      if ((err = s_unit(&s_a[z], &m->N, &s_g)) != AWS_MP_OKAY ||
+          (err = aws_mp_mul(&s_a[z], &m->factor, &s_a[z])) != AWS_MP_OKAY ||
+          (err = s_refused(m, ctx, mode, n, z, "a common factor")) != AWS_MP_OKAY) {
+        return err;
+      }
+    }
+  }
+  return AWS_MP_OKAY;
+}
+
+int main(void)
+{
+  invmod_modulus m[6];
+  aws_mp_int     p, q;
+  aws_mp_mod_ctx ctx;
+  int            ix, k, err, nm = (int)(sizeof(m) / sizeof(m[0]));
+  static const struct {
+    const char *name;
+    int         mode;
+  } modes[] = {
+    { "default context", -1 },
+    { "Montgomery", AWS_MP_REDUCE_MONTGOMERY },
+    { "Barrett", AWS_MP_REDUCE_BARRETT },
+  };
+
+  if (aws_mp_init_multi(&p, &q, &s_r, &s_g, NULL) != AWS_MP_OKAY) {
+    fprintf(stderr, "out of memory\n");
+    return EXIT_FAILURE;
+  }
+  for (ix = 0; ix < INVMOD_MAX; ix++) {
+    if (aws_mp_init_multi(&s_a[ix], &s_b[ix], NULL) != AWS_MP_OKAY) {
+      fprintf(stderr, "out of memory\n");
+      return EXIT_FAILURE;
+    }
+  }
+  for (ix = 0; ix < nm; ix++) {
+    if (aws_mp_init_multi(&m[ix].N, &m[ix].factor, NULL) != AWS_MP_OKAY) {
+      fprintf(stderr, "out of memory\n");
+      return EXIT_FAILURE;
+    }
+  }
+
+  /* the SRP group, 2**255 - 19, a one digit prime and one digit composite,
+   * an odd composite and an even one
+   */
+  m[0].name = "3072-bit SRP prime";
+  m[1].name = "2**255 - 19";
+  m[2].name = "1000003";
+  m[3].name = "15";
+  m[4].name = "odd 1024-bit composite";
+  m[5].name = "even 1024-bit composite";
+  if (aws_mp_read_radix(&m[0].N, s_n_hex, 16) != AWS_MP_OKAY ||
+      aws_mp_2expt(&m[1].N, 255) != AWS_MP_OKAY || aws_mp_sub_d(&m[1].N, 19, &m[1].N) != AWS_MP_OKAY ||
+      aws_mp_set_int(&m[2].N, 1000003) != AWS_MP_OKAY ||
+      aws_mp_set_int(&m[3].N, 15) != AWS_MP_OKAY || aws_mp_set_int(&m[3].factor, 3) != AWS_MP_OKAY ||
+      s_rand(&p, 512) != AWS_MP_OKAY || s_rand(&q, 512) != AWS_MP_OKAY ||
+      aws_mp_abs(&p, &p) != AWS_MP_OKAY || aws_mp_abs(&q, &q) != AWS_MP_OKAY ||
+      aws_mp_add_d(&p, 3, &p) != AWS_MP_OKAY || aws_mp_add_d(&q, 3, &q) != AWS_MP_OKAY) {
+    fprintf(stderr, "setup failed\n");
+    return EXIT_FAILURE;
+  }
+  p.dp[0] |= 1;
+  q.dp[0] |= 1;
+  if (aws_mp_mul(&p, &q, &m[4].N) != AWS_MP_OKAY || aws_mp_copy(&p, &m[4].factor) != AWS_MP_OKAY ||
+      aws_mp_mul_2(&m[4].N, &m[5].N) != AWS_MP_OKAY || aws_mp_set_int(&m[5].factor, 2) != AWS_MP_OKAY) {
+    fprintf(stderr, "setup failed\n");
+    return EXIT_FAILURE;
+  }
+
+  for (ix = 0; ix < nm; ix++) {
+    for (k = 0; k < (int)(sizeof(modes) / sizeof(modes[0])); k++) {
+      if (modes[k].mode == AWS_MP_REDUCE_MONTGOMERY && aws_mp_iseven(&m[ix].N)) {
+        continue;
+      }
+      err = (modes[k].mode < 0) ? aws_mp_mod_ctx_init(&ctx, &m[ix].N)
+                                : aws_mp_mod_ctx_init_mode(&ctx, &m[ix].N, modes[k].mode);
+      if (err != AWS_MP_OKAY) {
+        printf("%s, %s: no context, %s\n", m[ix].name, modes[k].name, aws_mp_error_to_string(err));
+        return EXIT_FAILURE;
+      }
+      err = s_check(&m[ix], &ctx, modes[k].name);
+      aws_mp_mod_ctx_clear(&ctx);
+      if (err != AWS_MP_OKAY) {
+        if (err != AWS_MP_VAL) {
+          printf("%s, %s: %s\n", m[ix].name, modes[k].name, aws_mp_error_to_string(err));
+        }
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  /* empty and negative batches */
+  if (aws_mp_invmod_batch(s_a, s_b, 0, NULL) != AWS_MP_OKAY || aws_mp_invmod_batch(s_a, s_b, -1, NULL) != AWS_MP_VAL) {
+    printf("empty or negative batch sizes are not handled\n");
+    return EXIT_FAILURE;
+  }
+  printf("%d checks, aws_mp_invmod_batch agrees with aws_mp_invmod\n", s_checks);
+
+  for (ix = 0; ix < nm; ix++) {
+    aws_mp_clear_multi(&m[ix].N, &m[ix].factor, NULL);
+  }
+  for (ix = 0; ix < INVMOD_MAX; ix++) {
+    aws_mp_clear_multi(&s_a[ix], &s_b[ix], NULL);
+  }
+  aws_mp_clear_multi(&p, &q, &s_r, &s_g, NULL);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+/* The NEON intrinsics the comba kernel uses, lane by lane in plain C
+ *
+ * Not the real header: "make simd-neon" puts this directory on the include
+ * path and defines AWS_MP_COMBA_NEON, so the NEON kernel of tommath.c is
+ * compiled and checked against the scalar loops on hosts without NEON.  Each
+ * function does what the ARM reference says of the instruction, nothing more.
+ */
+#ifndef AWS_TOOLS_ARM_NEON_H_
+#define AWS_TOOLS_ARM_NEON_H_
+
+#include <stdint.h>
+
+typedef struct {
+  uint32_t val[2];
+} uint32x2_t;
+
+typedef struct {
+  uint64_t val[2];
+} uint64x2_t;
+
+/* vdup.64: every lane set to v */
+static inline uint64x2_t vdupq_n_u64(uint64_t v)
+{
+  uint64x2_t r;
+
+  r.val[0] = r.val[1] = v;
+  return r;
+}
+
+/* vld1.32: two lanes from p */
+static inline uint32x2_t vld1_u32(const uint32_t *p)
+{
+  uint32x2_t r;
+
+  r.val[0] = p[0];
+  r.val[1] = p[1];
+  return r;
+}
+
+/* vmlal.u32: each 64-bit lane of a plus the full 64-bit product of a 32-bit lane of b and c */
+static inline uint64x2_t vmlal_n_u32(uint64x2_t a, uint32x2_t b, uint32_t c)
+{
+  a.val[0] += (uint64_t)b.val[0] * c;
+  a.val[1] += (uint64_t)b.val[1] * c;
+  return a;
+}
+
+/* vst1.64: two lanes to p */
+static inline void vst1q_u64(uint64_t *p, uint64x2_t v)
+{
+  p[0] = v.val[0];
+  p[1] = v.val[1];
+}
+
+#endif
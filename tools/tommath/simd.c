@@ -0,0 +1,122 @@
+/* Compare the vector comba columns with the scalar loops
+ *
+ * The library is compiled into this file so the vector unit can be switched
+ * off between two runs of the same multiplication.  Build it for the 28-bit
+ * digits the vector kernels are for:
+ *
+ *    make simd         the kernel of this host [AVX2 on x86-64, NEON on ARM]
+ *    make simd-neon    the NEON kernel on any host, through neon/arm_neon.h
+ *    ./simd [rounds]
+ *
+ * Every operand size the comba routines take is multiplied, multiplied for the
+ * high digits only [from several starting digits] and squared, with random
+ * digits and with every digit at its largest, and the digits from both paths
+ * must match exactly.  The exit status is nonzero on the first difference.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tommath.c"
+
+#ifdef AWS_MP_COMBA_SIMD
+
+static ulong64 s_state = 0x9E3779B97F4A7C15ULL;
+
+static ulong64 s_next(void)
+{
+  s_state ^= s_state << 13;
+  s_state ^= s_state >> 7;
+  s_state ^= s_state << 17;
+  return s_state;
+}
+
+/* a = n random digits [every one AWS_MP_MASK if full], the top one nonzero */
+static void s_digits(aws_mp_int *a, int n, int full)
+{
+  int ix;
+
+  if (aws_mp_grow(a, n) != AWS_MP_OKAY) {
+    fprintf(stderr, "out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  aws_mp_zero(a);
+  for (ix = 0; ix < n; ix++) {
+    a->dp[ix] = full ? AWS_MP_MASK : (aws_mp_digit)(s_next() & AWS_MP_MASK);
+  }
+  a->dp[n - 1] |= 1;
+  a->used = n;
+}
+
+/* the product both ways, "op" 0 multiplies to digs digits, 1 from digs up, 2 squares */
+static int s_same(int op, aws_mp_int *a, aws_mp_int *b, int digs, aws_mp_int *r, aws_mp_int *s)
+{
+  int err;
+
+  s_mp_comba_unit = 0;
+  err = op == 0 ? aws_fast_s_mp_mul_digs(a, b, r, digs) :
+        op == 1 ? aws_fast_s_mp_mul_high_digs(a, b, r, digs) : aws_fast_s_mp_sqr(a, r);
+  s_mp_comba_unit = 1;
+  if (err == AWS_MP_OKAY) {
+    err = op == 0 ? aws_fast_s_mp_mul_digs(a, b, s, digs) :
+          op == 1 ? aws_fast_s_mp_mul_high_digs(a, b, s, digs) : aws_fast_s_mp_sqr(a, s);
+  }
+  if (err != AWS_MP_OKAY) {
+    fprintf(stderr, "error %d\n", err);
+    exit(EXIT_FAILURE);
+  }
+  return aws_mp_cmp(r, s) == AWS_MP_EQ;
+}
+
+int main(int argc, char **argv)
+{
+  static const char *names[] = { "mul_digs", "mul_high_digs", "sqr" };
+  aws_mp_int a, b, r, s;
+  int        rounds, round, an, bn, full, digs, op, checked = 0;
+
+  rounds = argc > 1 ? atoi(argv[1]) : 1;
+  if (s_mp_comba_lookup() == 0) {
+    printf("no vector unit on this CPU, nothing to compare\n");
+    return EXIT_SUCCESS;
+  }
+  if (aws_mp_init_multi(&a, &b, &r, &s, NULL) != AWS_MP_OKAY) {
+    return EXIT_FAILURE;
+  }
+
+  for (round = 0; round < rounds; round++) {
+    for (full = 0; full < 2; full++) {
+      for (an = 1; an < 256; an++) {
+        /* the shorter operand below 256 digits, the product below AWS_MP_WARRAY */
+        bn = 1 + (int)(s_next() % (ulong64)(an < 64 ? 255 : AWS_MP_WARRAY - an - 2));
+        s_digits(&a, an, full);
+        s_digits(&b, bn, full);
+        for (op = 0; op < 3; op++) {
+          if (op == 2 && (2 * an + 1 >= AWS_MP_WARRAY || an >= 128)) {
+            continue;
+          }
+          digs = op == 2 ? 0 : (int)(s_next() % (ulong64)(an + bn + 2));
+          if (op == 0 && (s_next() & 1)) {
+            digs = an + bn + 1;
+          }
+          if (!s_same(op, &a, &b, digs, &r, &s)) {
+            printf("%s differs: %d by %d digits, digs %d%s\n", names[op], an, bn, digs,
+                   full ? ", all digits set" : "");
+            return EXIT_FAILURE;
+          }
+          ++checked;
+        }
+      }
+    }
+  }
+  printf("%d products, vector and scalar columns agree\n", checked);
+
+  aws_mp_clear_multi(&a, &b, &r, &s, NULL);
+  return EXIT_SUCCESS;
+}
+#else
+int main(void)
+{
+  printf("no vector comba columns in this build [28-bit digits on x86-64 or ARM with NEON]\n");
+  return EXIT_SUCCESS;
+}
+#endif
@@ -0,0 +1,192 @@
+/* Time the phases of an SRP sign-in against a local verifier
+ *
+ * Both ends of the handshake run here on the tommath calls the SRP helper
+ * makes, for the 3072-bit group with g = 2, so a slower sign-in shows up
+ * without a device or a network:
+ *
+ *    make srp
+ *    ./srp [handshakes] > run.json
+ *
+ * The phases follow the Objective-C benchmark in tools/srp, which
+ * TopcoderMobileAppTests runs: publicA [a and g^a], challenge [b and
+ * B = k*v + g^b], calculateS [the client's (B - k*g^x)^(a + u*x), the
+ * modular half of its completeAuthentication phase] and verify [the server's
+ * (A*v^u)^b], each reported as p50 and p99 in microseconds.  The hashes k, u and x are SHA-256
+ * outputs in the library, here they are random 256-bit numbers, as are a and
+ * b; the key derivation and the signature are left out.  The exit status is
+ * nonzero if the two ends ever get different values of S.
+ */
+#include "aws_tommath.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SRP_PHASES 4
+
+static const char *s_phases[SRP_PHASES] = { "publicA", "challenge", "calculateS", "verify" };
+
+static const char *s_n_hex =
+  "FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22514A08798E3404DDEF9519B3CD3A431B"
+  "302B0A6DF25F14374FE1356D6D51C245E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F24117C4B1FE6"
+  "49286651ECE45B3DC2007CB8A163BF0598DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F356208552BB9ED529077096966D"
+  "670C354E4ABC9804F1746C08CA18217C32905E462E36CE3BE39E772C180E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF695581718"
+  "3995497CEA956AE515D2261898FA051015728E5A8AAAC42DAD33170D04507A33A85521ABDF1CBA64ECFB850458DBEF0A8AEA71575D060C7D"
+  "B3970F85A6E1E4C7ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06D98A0864D87602733EC86A64521F2B18177B200C"
+  "BBE117577A615D6C770988C0BAD946E208E24FA074E5AB3143DB5BFCE0FD108E4B82D120A93AD2CAFFFFFFFFFFFFFFFF";
+
+static double s_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* fixed secrets, the same on every run */
+static ulong64 s_state = 0x9E3779B97F4A7C15ULL;
+
+static ulong64 s_next(void)
+{
+  s_state ^= s_state << 13;
+  s_state ^= s_state >> 7;
+  s_state ^= s_state << 17;
+  return s_state;
+}
+
+/* a = random 256-bit number, the size of a hash and of the secrets */
+static int s_rand256(aws_mp_int *a)
+{
+  unsigned char buf[32];
+  int           ix;
+
+  for (ix = 0; ix < (int)sizeof(buf); ix++) {
+    buf[ix] = (unsigned char)s_next();
+  }
+  return aws_mp_read_unsigned_bin(a, buf, (int)sizeof(buf));
+}
+
+static int s_cmp_double(const void *a, const void *b)
+{
+  double x = *(const double *)a, y = *(const double *)b;
+
+  return (x > y) - (x < y);
+}
+
+/* the nearest rank p-th percentile of n sorted samples */
+static double s_percentile(const double *t, int n, double p)
+{
+  int rank = (int)(p * n + 0.999999);
+
+  return t[rank > 0 ? rank - 1 : 0];
+}
+
+int main(int argc, char **argv)
+{
+  aws_mp_int     N, g, k, v, x, a, A, b, B, u, e, S, T;
+  aws_mp_mod_ctx ctx;
+  aws_mp_comb    comb;
+  double        *t[SRP_PHASES], now, last;
+  int            count = 200, round, phase, err;
+
+  if (argc > 1 && (count = atoi(argv[1])) < 1) {
+    fprintf(stderr, "usage: %s [handshakes]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  for (phase = 0; phase < SRP_PHASES; phase++) {
+    if ((t[phase] = malloc(sizeof(double) * (size_t)count)) == NULL) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  /* the group context the helper sets up once per process */
+  if ((err = aws_mp_init_multi(&N, &g, &k, &v, &x, &a, &A, &b, &B, &u, &e, &S, &T, NULL)) != AWS_MP_OKAY ||
+      (err = aws_mp_read_radix(&N, s_n_hex, 16)) != AWS_MP_OKAY ||
+      (err = aws_mp_set_int(&g, 2)) != AWS_MP_OKAY ||
+      (err = aws_mp_mod_ctx_init_mode(&ctx, &N, AWS_MP_REDUCE_MONTGOMERY)) != AWS_MP_OKAY ||
+      (err = aws_mp_comb_init(&comb, &g, &ctx, 256, 6)) != AWS_MP_OKAY) {
+    fprintf(stderr, "setup: %s\n", aws_mp_error_to_string(err));
+    return EXIT_FAILURE;
+  }
+
+  /* the user's registration, v = g^x */
+  if ((err = s_rand256(&k)) != AWS_MP_OKAY ||
+      (err = s_rand256(&x)) != AWS_MP_OKAY ||
+      (err = aws_mp_exptmod_comb_ct(&comb, &x, &v)) != AWS_MP_OKAY) {
+    fprintf(stderr, "registration: %s\n", aws_mp_error_to_string(err));
+    return EXIT_FAILURE;
+  }
+
+  for (round = 0; round < count; round++) {
+    last = s_now();
+
+    /* client: a and A = g^a */
+    if ((err = s_rand256(&a)) != AWS_MP_OKAY ||
+        (err = aws_mp_mod(&a, &N, &a)) != AWS_MP_OKAY ||
+        (err = aws_mp_exptmod_comb_ct(&comb, &a, &A)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+    now = s_now();
+    t[0][round] = now - last;
+    last = now;
+
+    /* server: b and B = (k*v + g^b) % N */
+    if ((err = s_rand256(&b)) != AWS_MP_OKAY ||
+        (err = aws_mp_exptmod_comb_ct(&comb, &b, &B)) != AWS_MP_OKAY ||
+        (err = aws_mp_mul(&k, &v, &T)) != AWS_MP_OKAY ||
+        (err = aws_mp_add(&T, &B, &B)) != AWS_MP_OKAY ||
+        (err = aws_mp_mod(&B, &N, &B)) != AWS_MP_OKAY ||
+        (err = s_rand256(&u)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+    now = s_now();
+    t[1][round] = now - last;
+    last = now;
+
+    /* client, as calculateSrpS: S = ((B - k*g^x) % N)^(a + u*x) */
+    if ((err = aws_mp_exptmod_comb_ct(&comb, &x, &T)) != AWS_MP_OKAY ||
+        (err = aws_mp_mulmod_ctx(&k, &T, &ctx, &T)) != AWS_MP_OKAY ||
+        (err = aws_mp_sub(&B, &T, &T)) != AWS_MP_OKAY ||
+        (err = aws_mp_mod(&T, &N, &T)) != AWS_MP_OKAY ||
+        (err = aws_mp_mul(&u, &x, &e)) != AWS_MP_OKAY ||
+        (err = aws_mp_add(&e, &a, &e)) != AWS_MP_OKAY ||
+        (err = aws_mp_exptmod_multi(&T, &e, 1, &ctx, &S)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+    now = s_now();
+    t[2][round] = now - last;
+    last = now;
+
+    /* server: S = (A * v^u)^b */
+    if ((err = aws_mp_exptmod_multi(&v, &u, 1, &ctx, &T)) != AWS_MP_OKAY ||
+        (err = aws_mp_mulmod_ctx(&A, &T, &ctx, &T)) != AWS_MP_OKAY ||
+        (err = aws_mp_exptmod_ct(&T, &b, &N, &T)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+    }
+    now = s_now();
+    t[3][round] = now - last;
+
+    if (aws_mp_cmp(&S, &T) != AWS_MP_EQ) {
+      fprintf(stderr, "handshake %d: the client and the server disagree on S\n", round);
+      return EXIT_FAILURE;
+    }
+  }
+
+  printf("{\"digit_bit\": %d, \"handshakes\": %d, \"phases\": [\n", AWS_DIGIT_BIT, count);
+  for (phase = 0; phase < SRP_PHASES; phase++) {
+    qsort(t[phase], (size_t)count, sizeof(double), s_cmp_double);
+    printf("  {\"phase\": \"%s\", \"p50_us\": %.1f, \"p99_us\": %.1f}%s\n", s_phases[phase],
+           s_percentile(t[phase], count, 0.50) * 1e6, s_percentile(t[phase], count, 0.99) * 1e6,
+           phase + 1 < SRP_PHASES ? "," : "");
+    free(t[phase]);
+  }
+  printf("]}\n");
+
+  aws_mp_comb_clear(&comb);
+  aws_mp_mod_ctx_clear(&ctx);
+  aws_mp_clear_multi(&N, &g, &k, &v, &x, &a, &A, &b, &B, &u, &e, &S, &T, NULL);
+  return EXIT_SUCCESS;
+
+LBL_ERR:
+  fprintf(stderr, "handshake %d: %s\n", round, aws_mp_error_to_string(err));
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,156 @@
+/* Check the client's SRP S against the server's for the 3072 and 6144-bit groups
+ *
+ *    make srps
+ *    ./srps
+ *
+ * calculateSrpS() [the C half of AWSCognitoIdentityProviderSrpHelper] is
+ * compiled in as it ships.  For each group [RFC 5054's 3072-bit one with g = 2,
+ * the one the helper ships, and the 6144-bit one with g = 5, which is above
+ * AWS_MP_MONTGOMERY_DIGS so aws_mp_exptmod_multi() turns it down] and with
+ * no context, a Montgomery context and a context and comb table, S =
+ * ((B - k*g^x) % N)^(a + u*x) must equal the server's (A*v^u)^b for
+ * SRPS_ROUNDS random secrets.  k, u, x, a and b are random 256-bit numbers.
+ *
+ * The exit status is nonzero on the first mismatch or error.
+ */
+#include "AWSCognitoIdentityProviderSrpMath.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SRPS_ROUNDS 8
+
+static const char s_n3072_hex[] =
+  "FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22514A08798E3404DDEF9519B3CD3A431B"
+  "302B0A6DF25F14374FE1356D6D51C245E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F24117C4B1FE6"
+  "49286651ECE45B3DC2007CB8A163BF0598DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F356208552BB9ED529077096966D"
+  "670C354E4ABC9804F1746C08CA18217C32905E462E36CE3BE39E772C180E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF695581718"
+  "3995497CEA956AE515D2261898FA051015728E5A8AAAC42DAD33170D04507A33A85521ABDF1CBA64ECFB850458DBEF0A8AEA71575D060C7D"
+  "B3970F85A6E1E4C7ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06D98A0864D87602733EC86A64521F2B18177B200C"
+  "BBE117577A615D6C770988C0BAD946E208E24FA074E5AB3143DB5BFCE0FD108E4B82D120A93AD2CAFFFFFFFFFFFFFFFF";
+
+static const char s_n6144_hex[] =
+  "FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22514A08798E3404DDEF9519B3CD3A431B"
+  "302B0A6DF25F14374FE1356D6D51C245E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F24117C4B1FE6"
+  "49286651ECE45B3DC2007CB8A163BF0598DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F356208552BB9ED529077096966D"
+  "670C354E4ABC9804F1746C08CA18217C32905E462E36CE3BE39E772C180E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF695581718"
+  "3995497CEA956AE515D2261898FA051015728E5A8AAAC42DAD33170D04507A33A85521ABDF1CBA64ECFB850458DBEF0A8AEA71575D060C7D"
+  "B3970F85A6E1E4C7ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06D98A0864D87602733EC86A64521F2B18177B200C"
+  "BBE117577A615D6C770988C0BAD946E208E24FA074E5AB3143DB5BFCE0FD108E4B82D120A92108011A723C12A787E6D788719A10BDBA5B26"
+  "99C327186AF4E23C1A946834B6150BDA2583E9CA2AD44CE8DBBBC2DB04DE8EF92E8EFC141FBECAA6287C59474E6BC05D99B2964FA090C3A2"
+  "233BA186515BE7ED1F612970CEE2D7AFB81BDD762170481CD0069127D5B05AA993B4EA988D8FDDC186FFB7DC90A6C08F4DF435C934028492"
+  "36C3FAB4D27C7026C1D4DCB2602646DEC9751E763DBA37BDF8FF9406AD9E530EE5DB382F413001AEB06A53ED9027D831179727B0865A8918"
+  "DA3EDBEBCF9B14ED44CE6CBACED4BB1BDB7F1447E6CC254B332051512BD7AF426FB8F401378CD2BF5983CA01C64B92ECF032EA15D1721D03"
+  "F482D7CE6E74FEF6D55E702F46980C82B5A84031900B1C9E59E7C97FBEC7E8F323A97A7E36CC88BE0F1D45B7FF585AC54BD407B22B4154AA"
+  "CC8F6D7EBF48E1D814CC5ED20F8037E0A79715EEF29BE32806A1D58BB7C5DA76F550AA3D8A1FBFF0EB19CCB1A313D55CDA56C9EC2EF29632"
+  "387FE8D76E3C0468043E8F663F4860EE12BF2D5B0B7474D6E694F91E6DCC4024FFFFFFFFFFFFFFFF";
+
+static const struct {
+  const char *name, *n_hex;
+  int         g;
+} s_groups[] = {
+  { "3072-bit", s_n3072_hex, 2 },
+  { "6144-bit", s_n6144_hex, 5 },
+};
+
+static const char *s_setups[] = { "no context", "Montgomery context", "context and comb" };
+
+/* fixed secrets, the same on every run */
+static ulong64 s_state = 0x9E3779B97F4A7C15ULL;
+
+static ulong64 s_next(void)
+{
+  s_state ^= s_state << 13;
+  s_state ^= s_state >> 7;
+  s_state ^= s_state << 17;
+  return s_state;
+}
+
+/* a = random 256-bit number, the size of a hash and of the secrets */
+static int s_rand256(aws_mp_int *a)
+{
+  unsigned char buf[32];
+  int           ix;
+
+  for (ix = 0; ix < 32; ix++) {
+    buf[ix] = (unsigned char)s_next();
+  }
+  return aws_mp_read_unsigned_bin(a, buf, 32);
+}
+
+int main(void)
+{
+  aws_mp_int     N, g, k, x, u, a, b, v, A, B, S, T, t;
+  aws_mp_mod_ctx ctx;
+  aws_mp_comb    comb;
+  int            grp, setup, round, err, have_ctx, have_comb;
+
+  if (aws_mp_init_multi(&N, &g, &k, &x, &u, &a, &b, &v, &A, &B, &S, &T, &t, NULL) != AWS_MP_OKAY) {
+    fprintf(stderr, "out of memory\n");
+    return EXIT_FAILURE;
+  }
+
+  for (grp = 0; grp < (int)(sizeof(s_groups) / sizeof(s_groups[0])); grp++) {
+    if (aws_mp_read_radix(&N, s_groups[grp].n_hex, 16) != AWS_MP_OKAY ||
+        aws_mp_set_int(&g, (unsigned long)s_groups[grp].g) != AWS_MP_OKAY) {
+      fprintf(stderr, "%s: setup failed\n", s_groups[grp].name);
+      return EXIT_FAILURE;
+    }
+    have_ctx  = aws_mp_mod_ctx_init_mode(&ctx, &N, AWS_MP_REDUCE_MONTGOMERY) == AWS_MP_OKAY;
+    have_comb = have_ctx && aws_mp_comb_init(&comb, &g, &ctx, 256, 6) == AWS_MP_OKAY;
+
+    /* does the group need the fallback? */
+    if (have_ctx && s_rand256(&x) == AWS_MP_OKAY) {
+      err = aws_mp_exptmod_multi(&g, &x, 1, &ctx, &t);
+      printf("%s group, %d digits: exptmod_multi %s\n", s_groups[grp].name, N.used,
+             err == AWS_MP_VAL ? "turns it down, S falls back to exptmod" : "takes it");
+    }
+
+    for (setup = 0; setup < 3; setup++) {
+      if ((setup >= 1 && !have_ctx) || (setup == 2 && !have_comb)) {
+        printf("%s group, %s: not available, skipped\n", s_groups[grp].name, s_setups[setup]);
+        continue;
+      }
+      for (round = 0; round < SRPS_ROUNDS; round++) {
+        /* the server's side: v = g^x, A = g^a, B = k*v + g^b, S = (A*v^u)^b */
+        if ((err = s_rand256(&k)) != AWS_MP_OKAY || (err = s_rand256(&x)) != AWS_MP_OKAY ||
+            (err = s_rand256(&u)) != AWS_MP_OKAY || (err = s_rand256(&a)) != AWS_MP_OKAY ||
+            (err = s_rand256(&b)) != AWS_MP_OKAY ||
+            (err = aws_mp_exptmod(&g, &x, &N, &v)) != AWS_MP_OKAY ||
+            (err = aws_mp_exptmod(&g, &a, &N, &A)) != AWS_MP_OKAY ||
+            (err = aws_mp_exptmod(&g, &b, &N, &t)) != AWS_MP_OKAY ||
+            (err = aws_mp_mul(&k, &v, &B)) != AWS_MP_OKAY ||
+            (err = aws_mp_add(&B, &t, &B)) != AWS_MP_OKAY ||
+            (err = aws_mp_mod(&B, &N, &B)) != AWS_MP_OKAY ||
+            (err = aws_mp_exptmod(&v, &u, &N, &t)) != AWS_MP_OKAY ||
+            (err = aws_mp_mulmod(&A, &t, &N, &t)) != AWS_MP_OKAY ||
+            (err = aws_mp_exptmod(&t, &b, &N, &T)) != AWS_MP_OKAY) {
+          fprintf(stderr, "%s group: server side failed, %s\n", s_groups[grp].name, aws_mp_error_to_string(err));
+          return EXIT_FAILURE;
+        }
+
+        /* the client's */
+        err = calculateSrpS(&B, &k, &g, &x, &a, &u, &N, setup >= 1 ? &ctx : NULL, setup == 2 ? &comb : NULL, &S);
+        if (err != AWS_MP_OKAY) {
+          printf("%s group, %s: calculateSrpS failed, %s\n", s_groups[grp].name, s_setups[setup],
+                 aws_mp_error_to_string(err));
+          return EXIT_FAILURE;
+        }
+        if (aws_mp_cmp(&S, &T) != AWS_MP_EQ) {
+          printf("%s group, %s: the client's S differs from the server's\n", s_groups[grp].name, s_setups[setup]);
+          return EXIT_FAILURE;
+        }
+      }
+      printf("%s group, %s: %d handshakes agree on S\n", s_groups[grp].name, s_setups[setup], SRPS_ROUNDS);
+    }
+
+    if (have_comb) {
+      aws_mp_comb_clear(&comb);
+    }
+    if (have_ctx) {
+      aws_mp_mod_ctx_clear(&ctx);
+    }
+  }
+
+  aws_mp_clear_multi(&N, &g, &k, &x, &u, &a, &b, &v, &A, &B, &S, &T, &t, NULL);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,202 @@
+/* Tune the Karatsuba, Toom-Cook, transform and recursive division cutoffs for the build machine
+ *
+ * Build it with the same compiler and flags as the library, then run it on the
+ * machine [or one like it] the library will run on:
+ *
+ *    make tune
+ *    ./tune $LTM/aws_tommath_cutoffs.h
+ *
+ * and build the library with AWS_MP_TUNED_CUTOFFS defined to use the result.
+ * Without an argument the header is written to stdout, the progress always
+ * goes to stderr.
+ *
+ * For every size the time of aws_mp_mul/aws_mp_sqr is taken with the faster
+ * algorithm switched off and with it used for the top level split only.  The
+ * cutoff is the first size from which the split wins AWS_TUNE_STREAK times
+ * in a row, Toom-Cook is measured on top of the Karatsuba cutoff just found
+ * and the transforms on top of Toom-Cook, in steps of 1/64 of the size from
+ * there on [one cutoff for both, found on multiplications].
+ * Division is timed the same way, a 2n digit number by an n digit one, with
+ * the multiplication cutoffs found before in effect.  An algorithm that never
+ * wins up to the largest size tried is written out as AWS_MP_CUTOFF_OFF.
+ */
+#include "aws_tommath.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define AWS_TUNE_STREAK   4      /* sizes in a row the split has to win */
+#define AWS_TUNE_MAX      1000   /* largest size tried, in digits */
+#define AWS_TUNE_NTT_MAX  8000   /* largest size tried for the transforms */
+#define AWS_TUNE_TRIALS   7      /* the best of this many runs counts */
+
+static double s_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void s_rand(aws_mp_int *a, int digits)
+{
+  int ix;
+
+  aws_mp_zero(a);
+  if (aws_mp_grow(a, digits) != AWS_MP_OKAY) {
+    fprintf(stderr, "out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (ix = 0; ix < digits; ix++) {
+    a->dp[ix] = ((aws_mp_digit)rand() ^ ((aws_mp_digit)rand() << 15) ^ ((aws_mp_digit)rand() << 30) ^
+                 ((aws_mp_digit)rand() << 45)) & AWS_MP_MASK;
+  }
+  a->dp[digits - 1] |= 1;
+  a->used = digits;
+}
+
+#define AWS_TUNE_MUL      0
+#define AWS_TUNE_SQR      1
+#define AWS_TUNE_DIV      2
+
+/* seconds per aws_mp_mul/aws_mp_sqr of two "size" digit numbers [or aws_mp_div of a
+ * 2*size digit one by a "size" digit one] under the given cutoffs */
+static double s_time(aws_mp_cutoffs *cut, int op, int size)
+{
+  aws_mp_int a, b, c, d;
+  double     best, t;
+  int        trial, n, ix;
+
+  if (aws_mp_set_cutoffs(cut) != AWS_MP_OKAY || aws_mp_init_multi(&a, &b, &c, &d, NULL) != AWS_MP_OKAY) {
+    fprintf(stderr, "setup failed\n");
+    exit(EXIT_FAILURE);
+  }
+  s_rand(&a, (op == AWS_TUNE_DIV) ? 2 * size : size);
+  s_rand(&b, size);
+
+  /* enough multiplications per trial to be well above the clock resolution */
+  n = 1 + 4000000 / (size * size);
+
+  best = 1e30;
+  for (trial = 0; trial < AWS_TUNE_TRIALS; trial++) {
+    t = s_now();
+    for (ix = 0; ix < n; ix++) {
+      if (op == AWS_TUNE_DIV) {
+          aws_mp_div(&a, &b, &c, &d);
+      } else if (op == AWS_TUNE_SQR) {
+          aws_mp_sqr(&a, &c);
+      } else {
+          aws_mp_mul(&a, &b, &c);
+      }
+    }
+    t = (s_now() - t) / n;
+    if (t < best) {
+      best = t;
+    }
+  }
+
+  aws_mp_clear_multi(&a, &b, &c, &d, NULL);
+  return best;
+}
+
+/* first size from which setting *field to the size beats leaving it off, trying
+ * the sizes from lo to hi 1/step of the size apart
+ * [digit by digit when that is below one]
+ */
+static int s_tune(aws_mp_cutoffs *cut, int *field, int op, int lo, int hi, int step, const char *name)
+{
+  double slow, fast;
+  int    size, streak, first, found;
+
+  streak = first = 0;
+  found  = AWS_MP_CUTOFF_OFF;
+  for (size = lo; size <= hi; size += AWS_MAX(1, size / step)) {
+    *field = AWS_MP_CUTOFF_OFF;
+    slow = s_time(cut, op, size);
+    *field = size;
+    fast = s_time(cut, op, size);
+
+    if (fast < slow) {
+      if (streak++ == 0) {
+        first = size;
+      }
+      if (streak == AWS_TUNE_STREAK) {
+        found = first;
+        break;
+      }
+    } else {
+      streak = 0;
+    }
+
+    /* the sizes far from the crossover don't need a close look */
+    if (streak == 0 && fast > 1.2 * slow) {
+      size += size / 16;
+    }
+  }
+  if (found == AWS_MP_CUTOFF_OFF) {
+    fprintf(stderr, "%-14s off\n", name);
+  } else {
+    fprintf(stderr, "%-14s %d\n", name, found);
+  }
+
+  *field = found;
+  return found;
+}
+
+static void s_define(FILE *out, const char *name, int cutoff)
+{
+  if (cutoff == AWS_MP_CUTOFF_OFF) {
+    fprintf(out, "#define %-29s  AWS_MP_CUTOFF_OFF\n", name);
+  } else {
+    fprintf(out, "#define %-29s  %d\n", name, cutoff);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  aws_mp_cutoffs cut, best;
+  FILE          *out;
+
+  srand(0x1234);
+
+  /* Karatsuba against the comba/baseline routines, no Toom-Cook at all */
+  cut.karatsuba_mul = cut.karatsuba_sqr = AWS_MP_CUTOFF_OFF;
+  cut.toom_mul      = cut.toom_sqr      = AWS_MP_CUTOFF_OFF;
+  cut.div_recursive = AWS_MP_CUTOFF_OFF;
+  cut.ntt           = AWS_MP_CUTOFF_OFF;
+  best.karatsuba_mul = s_tune(&cut, &cut.karatsuba_mul, AWS_TUNE_MUL, AWS_MP_KARATSUBA_MIN + 6, AWS_TUNE_MAX,
+                              AWS_TUNE_MAX + 1, "karatsuba mul");
+  best.karatsuba_sqr = s_tune(&cut, &cut.karatsuba_sqr, AWS_TUNE_SQR, AWS_MP_KARATSUBA_MIN + 6, AWS_TUNE_MAX,
+                              AWS_TUNE_MAX + 1, "karatsuba sqr");
+
+  /* Toom-Cook against Karatsuba */
+  best.toom_mul = s_tune(&cut, &cut.toom_mul, AWS_TUNE_MUL, AWS_MIN(best.karatsuba_mul, AWS_TUNE_MAX), AWS_TUNE_MAX,
+                         AWS_TUNE_MAX + 1, "toom mul");
+  best.toom_sqr = s_tune(&cut, &cut.toom_sqr, AWS_TUNE_SQR, AWS_MIN(best.karatsuba_sqr, AWS_TUNE_MAX), AWS_TUNE_MAX,
+                         AWS_TUNE_MAX + 1, "toom sqr");
+
+  /* the transforms against Toom-Cook */
+  best.ntt = s_tune(&cut, &cut.ntt, AWS_TUNE_MUL, AWS_MIN(best.toom_mul, AWS_TUNE_MAX), AWS_TUNE_NTT_MAX,
+                    64, "ntt");
+
+  /* recursive division against schoolbook, on top of the multiplication just tuned */
+  best.div_recursive = s_tune(&cut, &cut.div_recursive, AWS_TUNE_DIV, AWS_MP_DIV_RECURSIVE_MIN + 4, AWS_TUNE_MAX,
+                              AWS_TUNE_MAX + 1, "div recursive");
+
+  out = stdout;
+  if (argc > 1 && (out = fopen(argv[1], "w")) == NULL) {
+    perror(argv[1]);
+    return EXIT_FAILURE;
+  }
+  fprintf(out, "/* generated by tools/tommath/tune.c, %d-bit digits */\n", AWS_DIGIT_BIT);
+  s_define(out, "AWS_MP_KARATSUBA_MUL_DEFAULT", best.karatsuba_mul);
+  s_define(out, "AWS_MP_KARATSUBA_SQR_DEFAULT", best.karatsuba_sqr);
+  s_define(out, "AWS_MP_TOOM_MUL_DEFAULT", best.toom_mul);
+  s_define(out, "AWS_MP_TOOM_SQR_DEFAULT", best.toom_sqr);
+  s_define(out, "AWS_MP_DIV_RECURSIVE_DEFAULT", best.div_recursive);
+  s_define(out, "AWS_MP_NTT_DEFAULT", best.ntt);
+  if (out != stdout) {
+    fclose(out);
+  }
+  return EXIT_SUCCESS;
+}